@@ -0,0 +1,316 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <limits>
+# include <string>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/core/graph/cpp_graph.hpp>
+# include <cppad/local/graph/double_text.hpp>
+
+// documentation for this routine is in the file below
+# include <cppad/local/graph/csrc_writer.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+// text for a double constant using the fewest digits that convert back to it
+std::string csrc_double(double value)
+{   if( value != value )
+        return "NAN";
+    if( value == std::numeric_limits<double>::infinity() )
+        return "INFINITY";
+    if( value == - std::numeric_limits<double>::infinity() )
+        return "(-INFINITY)";
+    std::string result = CppAD::local::graph::double_text(value).c_str();
+    // make sure the C compiler sees a floating point constant
+    if( result.find_first_of(".eE") == std::string::npos )
+        result += ".0";
+    if( value < 0.0 )
+        result = "(" + result + ")";
+    return result;
+}
+
+// C function corresponding to a unary graph operator
+const char* csrc_unary(CppAD::graph::graph_op_enum op_enum)
+{   using namespace CppAD::graph;
+    switch( op_enum )
+    {   case abs_graph_op:   return "fabs";
+        case acos_graph_op:  return "acos";
+        case acosh_graph_op: return "acosh";
+        case asin_graph_op:  return "asin";
+        case asinh_graph_op: return "asinh";
+        case atan_graph_op:  return "atan";
+        case atanh_graph_op: return "atanh";
+        case cos_graph_op:   return "cos";
+        case cosh_graph_op:  return "cosh";
+        case erf_graph_op:   return "erf";
+        case erfc_graph_op:  return "erfc";
+        case exp_graph_op:   return "exp";
+        case expm1_graph_op: return "expm1";
+        case log1p_graph_op: return "log1p";
+        case log_graph_op:   return "log";
+        case sign_graph_op:  return "cppad_sign";
+        case sin_graph_op:   return "sin";
+        case sinh_graph_op:  return "sinh";
+        case sqrt_graph_op:  return "sqrt";
+        case tan_graph_op:   return "tan";
+        case tanh_graph_op:  return "tanh";
+        default:             break;
+    }
+    return CPPAD_NULL;
+}
+
+// is a graph operator supported by csrc_writer
+bool csrc_supported(CppAD::graph::graph_op_enum op_enum)
+{   using namespace CppAD::graph;
+    switch( op_enum )
+    {   case add_graph_op:
+        case azmul_graph_op:
+        case cexp_eq_graph_op:
+        case cexp_le_graph_op:
+        case cexp_lt_graph_op:
+        case comp_eq_graph_op:
+        case comp_le_graph_op:
+        case comp_lt_graph_op:
+        case comp_ne_graph_op:
+        case div_graph_op:
+        case mul_graph_op:
+        case pow_graph_op:
+        case print_graph_op:
+        case sub_graph_op:
+        case sum_graph_op:
+        return true;
+
+        default:
+        break;
+    }
+    return csrc_unary(op_enum) != CPPAD_NULL;
+}
+
+// report an error in the graph (this check is done in all builds)
+bool csrc_error(const std::string& msg)
+{   bool known       = true;
+    int  line        = __LINE__;
+    const char* file = __FILE__;
+    const char* exp  = "csrc_supported(op_enum)";
+    CppAD::ErrorHandler::Call( known, line, file, exp, msg.c_str() );
+    return false;
+}
+
+} // END_EMPTY_NAMESPACE
+
+bool CppAD::local::graph::csrc_writer(
+    std::ostream&                             os                     ,
+    const cpp_graph&                          graph_obj              ,
+    const std::string&                        function_name          )
+{   using std::string;
+    using CppAD::cpp_graph;
+    using CppAD::vector;
+    using namespace CppAD::graph;
+    // --------------------------------------------------------------------
+    if( op_name2enum.size() == 0 )
+    {   CPPAD_ASSERT_KNOWN( ! CppAD::thread_alloc::in_parallel() ,
+            "call to set_operator_info in parallel mode"
+        );
+        set_operator_info();
+    }
+    // --------------------------------------------------------------------
+    const size_t n_dynamic_ind  = graph_obj.n_dynamic_ind_get();
+    const size_t n_variable_ind = graph_obj.n_variable_ind_get();
+    const size_t n_constant     = graph_obj.constant_vec_size();
+    const size_t n_usage        = graph_obj.operator_vec_size();
+    const size_t n_dependent    = graph_obj.dependent_vec_size();
+    const size_t nx             = n_dynamic_ind + n_variable_ind;
+    //
+    // check for operators that are not supported and determine the
+    // number of nodes and which helper functions are used
+    bool   use_sign  = false;
+    bool   use_azmul = false;
+    size_t n_node    = 1 + nx + n_constant;
+    cpp_graph::const_iterator check_itr;
+    for(size_t op_index = 0; op_index < n_usage; ++op_index)
+    {   if( op_index == 0 )
+            check_itr = graph_obj.begin();
+        else
+            ++check_itr;
+        cpp_graph::const_iterator::value_type itr_value = *check_itr;
+        graph_op_enum op_enum = itr_value.op_enum;
+        if( op_enum == discrete_graph_op ) return csrc_error(
+            "to_csrc: function contains a discrete function call"
+        );
+        if( op_enum == atom_graph_op ) return csrc_error(
+            "to_csrc: function contains an atomic function call"
+        );
+        if( ! csrc_supported(op_enum) ) return csrc_error(
+            "to_csrc: function contains the operator "
+            + std::string( op_enum2name[op_enum] ) + " which is not supported"
+        );
+        use_sign  |= op_enum == sign_graph_op;
+        use_azmul |= op_enum == azmul_graph_op;
+        n_node    += itr_value.n_result;
+    }
+    // -----------------------------------------------------------------------
+    os << "/* C source code generated by CppAD for the function "
+       << graph_obj.function_name_get() << " */\n";
+    os << "# include <stddef.h>\n";
+    os << "# include <math.h>\n";
+    os << "# ifdef __cplusplus\n";
+    os << "extern \"C\" {\n";
+    os << "# endif\n";
+    if( use_sign )
+    {   os << "static double cppad_sign(double x)\n";
+        os << "{   if( x > 0.0 ) return 1.0;\n";
+        os << "    if( x < 0.0 ) return -1.0;\n";
+        os << "    return 0.0;\n";
+        os << "}\n";
+    }
+    if( use_azmul )
+    {   os << "static double cppad_azmul(double x, double y)\n";
+        os << "{   if( x == 0.0 ) return 0.0;\n";
+        os << "    return x * y;\n";
+        os << "}\n";
+    }
+    os << "int " << function_name
+       << "(size_t nx, const double* x, size_t ny, double* y)\n";
+    os << "{   size_t i;\n";
+    os << "    double v[" << n_node << "];\n";
+    os << "    if( nx != " << nx << " ) return 1;\n";
+    os << "    if( ny != " << n_dependent << " ) return 2;\n";
+    os << "    /* independent dynamic parameters and variables */\n";
+    os << "    for(i = 0; i < nx; ++i)\n";
+    os << "        v[i + 1] = x[i];\n";
+    os << "    /* constants */\n";
+    for(size_t i = 0; i < n_constant; ++i)
+    {   os << "    v[" << 1 + nx + i << "] = ";
+        os << csrc_double( graph_obj.constant_vec_get(i) ) << ";\n";
+    }
+    os << "    /* operators */\n";
+    //
+    // index of the next result node
+    size_t i_result = 1 + nx + n_constant;
+    cpp_graph::const_iterator graph_itr;
+    for(size_t op_index = 0; op_index < n_usage; ++op_index)
+    {   if( op_index == 0 )
+            graph_itr = graph_obj.begin();
+        else
+            ++graph_itr;
+        cpp_graph::const_iterator::value_type itr_value = *graph_itr;
+        graph_op_enum         op_enum  = itr_value.op_enum;
+        const vector<size_t>& arg      = *itr_value.arg_node_ptr;
+        size_t                n_arg    = arg.size();
+        //
+        const char* binary   = CPPAD_NULL;
+        const char* compare  = CPPAD_NULL;
+        switch( op_enum )
+        {
+            // --------------------------------------------------------------
+            // operators that do not have a result
+            case comp_eq_graph_op:
+            case comp_le_graph_op:
+            case comp_lt_graph_op:
+            case comp_ne_graph_op:
+            case print_graph_op:
+            CPPAD_ASSERT_UNKNOWN( itr_value.n_result == 0 );
+            break;
+
+            // --------------------------------------------------------------
+            case add_graph_op:
+            binary = " + ";
+            break;
+
+            case div_graph_op:
+            binary = " / ";
+            break;
+
+            case mul_graph_op:
+            binary = " * ";
+            break;
+
+            case sub_graph_op:
+            binary = " - ";
+            break;
+
+            case azmul_graph_op:
+            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+            os << "    v[" << i_result << "] = cppad_azmul(";
+            os << "v[" << arg[0] << "], v[" << arg[1] << "]);\n";
+            break;
+
+            case pow_graph_op:
+            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+            os << "    v[" << i_result << "] = pow(";
+            os << "v[" << arg[0] << "], v[" << arg[1] << "]);\n";
+            break;
+
+            // --------------------------------------------------------------
+            case cexp_eq_graph_op:
+            compare = " == ";
+            break;
+
+            case cexp_le_graph_op:
+            compare = " <= ";
+            break;
+
+            case cexp_lt_graph_op:
+            compare = " < ";
+            break;
+
+            // --------------------------------------------------------------
+            case sum_graph_op:
+            os << "    v[" << i_result << "] = ";
+            if( n_arg == 0 )
+                os << "0.0";
+            for(size_t j = 0; j < n_arg; ++j)
+            {   if( j > 0 )
+                    os << " + ";
+                os << "v[" << arg[j] << "]";
+            }
+            os << ";\n";
+            break;
+
+            // --------------------------------------------------------------
+            default:
+            {   const char* name = csrc_unary(op_enum);
+                CPPAD_ASSERT_UNKNOWN( name != CPPAD_NULL );
+                CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+                os << "    v[" << i_result << "] = " << name;
+                os << "(v[" << arg[0] << "]);\n";
+            }
+            break;
+        }
+        if( binary != CPPAD_NULL )
+        {   CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+            os << "    v[" << i_result << "] = ";
+            os << "v[" << arg[0] << "]" << binary << "v[" << arg[1] << "];\n";
+        }
+        if( compare != CPPAD_NULL )
+        {   CPPAD_ASSERT_UNKNOWN( n_arg == 4 );
+            os << "    v[" << i_result << "] = ";
+            os << "v[" << arg[0] << "]" << compare << "v[" << arg[1] << "] ? ";
+            os << "v[" << arg[2] << "] : v[" << arg[3] << "];\n";
+        }
+        i_result += itr_value.n_result;
+    }
+    CPPAD_ASSERT_UNKNOWN( i_result == n_node );
+    //
+    os << "    /* dependent variables */\n";
+    for(size_t i = 0; i < n_dependent; ++i)
+    {   os << "    y[" << i << "] = v[";
+        os << graph_obj.dependent_vec_get(i) << "];\n";
+    }
+    os << "    return 0;\n";
+    os << "}\n";
+    os << "# ifdef __cplusplus\n";
+    os << "}\n";
+    os << "# endif\n";
+    return true;
+}
@@ -19,17 +19,33 @@ CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
 // BEGIN_CPPAD_LOCAL_GRAPH_NAMESPACE
 namespace CppAD { namespace local { namespace graph {
 
+// maximum number of characters before the current character that are
+// kept for error reporting
+static const size_t json_lexer_n_context = 1024;
+
+// first_context
+// index of the first character that may be used for error reporting
+static size_t first_context(size_t buffer_start, size_t index)
+{   size_t first = buffer_start;
+    if( index > json_lexer_n_context && first < index - json_lexer_n_context )
+        first = index - json_lexer_n_context;
+    return first;
+}
+
 // report_error
 void json_lexer::report_error(
     const std::string& expected ,
     const std::string& found    )
-{   size_t pos = index_;
+{   size_t first = first_context(buffer_start_, index_);
+    size_t pos   = index_;
     size_t count_newline = 0;
-    while(0 < pos && count_newline < 2 )
+    while(first < pos && count_newline < 2 )
     {   --pos;
-        count_newline += json_[pos] == '\n';
+        count_newline += get_char(pos) == '\n';
     }
-    std::string recent_input = json_.substr( pos, index_ - pos + 1);
+    std::string recent_input;
+    for(size_t i = pos; i <= index_ && have_char(i); ++i)
+        recent_input.push_back( get_char(i) );
 
     std::string msg = "Error occurred while parsing Json AD graph";
     if( function_name_ != "" )
@@ -52,12 +68,47 @@ void json_lexer::report_error(
     ErrorHandler::Call(known, line, file, exp, msg.c_str());
 }
 
+// have_char
+bool json_lexer::have_char(size_t index)
+{   if( index < buffer_start_ + json_->size() )
+        return true;
+    if( is_ == CPPAD_NULL )
+        return false;
+    //
+    // number of characters to read from the stream at a time
+    const size_t n_chunk = 65536;
+    while( buffer_start_ + buffer_.size() <= index )
+    {   // discard characters before the previous line and characters
+        // that are too far back to be used for error reporting
+        // (the newline before the previous line is also kept)
+        size_t keep  = prev_line_start_;
+        if( keep > 0 )
+            --keep;
+        size_t first = first_context(buffer_start_, index_);
+        if( keep < first )
+            keep = first;
+        buffer_.erase(0, keep - buffer_start_);
+        buffer_start_ = keep;
+        //
+        // read the next chunk
+        size_t size = buffer_.size();
+        buffer_.resize(size + n_chunk);
+        is_->read(&buffer_[size], std::streamsize(n_chunk) );
+        buffer_.resize( size + size_t( is_->gcount() ) );
+        if( buffer_.size() == size )
+            return false;
+    }
+    return true;
+}
+
 // next_index
 void json_lexer::next_index(void)
-{   CPPAD_ASSERT_UNKNOWN( index_ < json_.size() );
-    if( json_[index_] == '\n' )
+{   CPPAD_ASSERT_UNKNOWN( have_char(index_) );
+    if( get_char(index_) == '\n' )
     {   ++line_number_;
-        char_number_ = 0;
+        char_number_     = 0;
+        prev_line_start_ = line_start_;
+        line_start_      = index_ + 1;
     }
     ++index_;
     ++char_number_;
@@ -65,19 +116,44 @@ void json_lexer::next_index(void)
 
 // skip_white_space
 void json_lexer::skip_white_space(void)
-{  while( index_ < json_.size() && isspace( json_[index_] ) )
+{  while( have_char(index_) && isspace( get_char(index_) ) )
         next_index();
 }
 
 // constructor
 json_lexer::json_lexer(const std::string& json)
 :
-json_(json),
+json_(&json),
+is_(CPPAD_NULL),
+buffer_(""),
+buffer_start_(0),
 index_(0),
+line_start_(0),
+prev_line_start_(0),
 line_number_(1),
 char_number_(1),
 token_(""),
 function_name_("")
+{   initialize(); }
+
+// constructor
+json_lexer::json_lexer(std::istream& is)
+:
+json_(&buffer_),
+is_(&is),
+buffer_(""),
+buffer_start_(0),
+index_(0),
+line_start_(0),
+prev_line_start_(0),
+line_number_(1),
+char_number_(1),
+token_(""),
+function_name_("")
+{   initialize(); }
+
+// initialize
+void json_lexer::initialize(void)
 {   // make sure op_name2enum has been initialized
     if( op_name2enum.size() == 0 )
     {   CPPAD_ASSERT_KNOWN( ! thread_alloc::in_parallel() ,
@@ -87,13 +163,13 @@ function_name_("")
     }
 
     skip_white_space();
-    if( index_ < json_.size() )
-        token_ = json_[index_];
+    if( have_char(index_) )
+        token_ = get_char(index_);
     if( token_ != "{" )
     {   std::string expected = "'{'";
         std::string found    = "'";
-        if( index_ < json_.size() )
-            found += json_[index_];
+        if( have_char(index_) )
+            found += get_char(index_);
         found += "'";
         report_error(expected, found);
     }
@@ -128,14 +204,14 @@ double json_lexer::token2double(void) const
 // check_next_char
 void json_lexer::check_next_char(char ch)
 {   // advance to next character
-    if( index_ < json_.size() )
+    if( have_char(index_) )
         next_index();
     skip_white_space();
     //
     bool ok = false;
-    if( index_ < json_.size() )
+    if( have_char(index_) )
     {   token_.resize(1);
-        token_[0] = json_[index_];
+        token_[0] = get_char(index_);
         ok = (token_[0] == ch) | (ch == '\0');
     }
     if( ! ok )
@@ -147,8 +223,8 @@ void json_lexer::check_next_char(char ch)
         }
         //
         std::string found = "'";
-        if( index_ < json_.size() )
-            found += json_[index_];;
+        if( have_char(index_) )
+            found += get_char(index_);
         found += "'";
         report_error(expected, found);
     }
@@ -157,29 +233,29 @@ void json_lexer::check_next_char(char ch)
 // check_next_string
 void json_lexer::check_next_string(const std::string& expected)
 {   // advance to next character
-    bool found_first_quote = index_ < json_.size();
+    bool found_first_quote = have_char(index_);
     if( found_first_quote )
     {   next_index();
         skip_white_space();
-        found_first_quote = index_ < json_.size();
+        found_first_quote = have_char(index_);
     }
     // check for "
     if( found_first_quote )
-        found_first_quote = json_[index_] == '"';
+        found_first_quote = get_char(index_) == '"';
     //
     // set value of token
     token_.resize(0);
     if( found_first_quote )
     {   next_index();
-        while( index_ < json_.size() && json_[index_] != '"' )
-        {   token_.push_back( json_[index_] );
+        while( have_char(index_) && get_char(index_) != '"' )
+        {   token_.push_back( get_char(index_) );
             next_index();
         }
     }
     // check for "
     bool found_second_quote = false;
-    if( found_first_quote && index_ < json_.size() )
-        found_second_quote = json_[index_] == '"';
+    if( found_first_quote && have_char(index_) )
+        found_second_quote = get_char(index_) == '"';
     //
     bool ok = found_first_quote & found_second_quote;
     if( ok & (expected != "" ) )
@@ -197,8 +273,8 @@ void json_lexer::check_next_string(const std::string& expected)
         std::string found;
         if( ! found_first_quote )
         {   found = "'";
-            if( index_ < json_.size() )
-                found += json_[index_];
+            if( have_char(index_) )
+                found += get_char(index_);
             found += "'";
         }
         else
@@ -214,29 +290,29 @@ void json_lexer::check_next_string(const std::string& expected)
 // next_non_neg_int
 void json_lexer::next_non_neg_int(void)
 {   // advance to next character
-    bool ok = index_ < json_.size();
+    bool ok = have_char(index_);
     if( ok )
     {   next_index();
         skip_white_space();
-        ok = index_ < json_.size();
+        ok = have_char(index_);
     }
     if( ok )
-        ok = std::isdigit( json_[index_] );
+        ok = std::isdigit( get_char(index_) );
     if( ! ok )
     {   std::string expected_token = "non-negative integer";
         std::string found = "'";
-        if( index_ < json_.size() )
-            found += json_[index_];
+        if( have_char(index_) )
+            found += get_char(index_);
         found += "'";
         report_error(expected_token, found);
     }
     //
     token_.resize(0);
     while( ok )
-    {   token_.push_back( json_[index_] );
-        ok = index_ + 1 < json_.size();
+    {   token_.push_back( get_char(index_) );
+        ok = have_char(index_ + 1);
         if( ok )
-            ok = isdigit( json_[index_ + 1] );
+            ok = isdigit( get_char(index_ + 1) );
         if( ok )
             next_index();
     }
@@ -245,14 +321,14 @@ void json_lexer::next_non_neg_int(void)
 // next_float
 void json_lexer::next_float(void)
 {   // advance to next character
-    bool ok = index_ < json_.size();
+    bool ok = have_char(index_);
     if( ok )
     {   next_index();
         skip_white_space();
-        ok = index_ < json_.size();
+        ok = have_char(index_);
     }
     if( ok )
-    {   char ch = json_[index_];
+    {   char ch = get_char(index_);
         ok = std::isdigit(ch);
         ok |= (ch == '.') | (ch == '+') | (ch == '-');
         ok |= (ch == 'e') | (ch == 'E');
@@ -260,18 +336,18 @@ void json_lexer::next_float(void)
     if( ! ok )
     {   std::string expected_token = "floating point number";
         std::string found = "'";
-        if( index_ < json_.size() )
-            found += json_[index_];
+        if( have_char(index_) )
+            found += get_char(index_);
         found += "'";
         report_error(expected_token, found);
     }
     //
     token_.resize(0);
     while( ok )
-    {   token_.push_back( json_[index_] );
-        ok = index_ + 1 < json_.size();
+    {   token_.push_back( get_char(index_) );
+        ok = have_char(index_ + 1);
         if( ok )
-        {   char ch  = json_[index_ + 1];
+        {   char ch  = get_char(index_ + 1);
             ok  = isdigit(ch);
             ok |= (ch == '.') | (ch == '+') | (ch == '-');
             ok |= (ch == 'e') | (ch == 'E');
@@ -20,10 +20,14 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 // documentation for this routine is in the file below
 # include <cppad/local/graph/json_parser.hpp>
 
-void CppAD::local::graph::json_parser(
-    const std::string& json      ,
-    cpp_graph&         graph_obj )
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+// parse the graph using the specified lexer
+void json_parser_lexer(
+    CppAD::local::graph::json_lexer& json_lexer ,
+    CppAD::cpp_graph&                graph_obj  )
 {   using std::string;
+    using namespace CppAD::local::graph;
     //
     //
     // match_any_string
@@ -37,8 +41,7 @@ void CppAD::local::graph::json_parser(
     CppAD::vector<graph_op_enum> op_code2enum(1);
     //
     // -----------------------------------------------------------------------
-    // json_lexer constructor checks for { at beginning
-    CppAD::local::graph::json_lexer json_lexer(json);
+    // json_lexer constructor checked for { at beginning
     //
     // "function_name" : function_name
     json_lexer.check_next_string("function_name");
@@ -345,3 +348,20 @@ void CppAD::local::graph::json_parser(
     //
     return;
 }
+} // END_EMPTY_NAMESPACE
+
+void CppAD::local::graph::json_parser(
+    const std::string& json      ,
+    cpp_graph&         graph_obj )
+{   // json_lexer constructor checks for { at beginning
+    CppAD::local::graph::json_lexer json_lexer(json);
+    json_parser_lexer(json_lexer, graph_obj);
+}
+
+void CppAD::local::graph::json_parser(
+    std::istream&      is        ,
+    cpp_graph&         graph_obj )
+{   // json_lexer constructor checks for { at beginning
+    CppAD::local::graph::json_lexer json_lexer(is);
+    json_parser_lexer(json_lexer, graph_obj);
+}
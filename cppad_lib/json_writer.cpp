@@ -10,23 +10,103 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 
+# include <cstdio>
+# include <cstdlib>
 # include <cppad/local/pod_vector.hpp>
+# include <cppad/local/graph/double_text.hpp>
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/core/graph/cpp_graph.hpp>
 
 // documentation for this routine is in the file below
 # include <cppad/local/graph/json_writer.hpp>
 
-void CppAD::local::graph::json_writer(
-    std::string&                              json                   ,
-    const cpp_graph&                          graph_obj              )
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+// Buffered output for the Json writer. Single quotes are converted to
+// double quotes so the source code below does not need to escape them.
+class json_buffer {
+private:
+    // size of the buffer
+    static const size_t capacity_ = 65536;
+    // output stream (null if output is to a string)
+    std::ostream* os_;
+    // output string (null if output is to a stream)
+    std::string*  str_;
+    // characters that have not yet been flushed
+    // (on the heap so a json_buffer does not use much stack)
+    CppAD::local::pod_vector<char> buffer_;
+    // number of characters in buffer_
+    size_t        size_;
+public:
+    json_buffer(std::ostream* os, std::string* str)
+    : os_(os), str_(str), buffer_(capacity_), size_(0)
+    { }
+    ~json_buffer(void)
+    {   flush(); }
+    // move the characters in the buffer to the output
+    void flush(void)
+    {   if( os_ != CPPAD_NULL )
+            os_->write(buffer_.data(), std::streamsize(size_) );
+        else
+            str_->append(buffer_.data(), size_);
+        size_ = 0;
+    }
+    // output one character
+    json_buffer& operator<<(char ch)
+    {   if( size_ == capacity_ )
+            flush();
+        buffer_[size_++] = ch == '\'' ? '"' : ch;
+        return *this;
+    }
+    // output a '\0' terminated string
+    json_buffer& operator<<(const char* text)
+    {   while( *text != '\0' )
+            *this << *text++;
+        return *this;
+    }
+    // output a string
+    json_buffer& operator<<(const std::string& text)
+    {   for(size_t i = 0; i < text.size(); ++i)
+            *this << text[i];
+        return *this;
+    }
+    // output a non-negative integer
+    json_buffer& operator<<(size_t value)
+    {   char digit[32];
+        size_t n_digit = 0;
+        do
+        {   digit[n_digit++] = char( '0' + value % 10 );
+            value /= 10;
+        }
+        while( value > 0 );
+        while( n_digit > 0 )
+            *this << digit[--n_digit];
+        return *this;
+    }
+    // output a double using the fewest digits that convert back to value
+    // (the output does not depend on the C locale)
+    json_buffer& operator<<(double value)
+    {   CppAD::local::graph::double_text text(value);
+        return *this << text.c_str();
+    }
+};
+
+// write a graph to a buffer
+void json_buffer_writer(
+    json_buffer&                              json                   ,
+    const CppAD::cpp_graph&                   graph_obj              )
 {   using std::string;
+    using CppAD::cpp_graph;
+    using CppAD::vector;
+    using CppAD::local::pod_vector;
+    using namespace CppAD::graph;
+    using namespace CppAD::local::graph;
     // --------------------------------------------------------------------
-    if( local::graph::op_name2enum.size() == 0 )
-    {   CPPAD_ASSERT_KNOWN( ! thread_alloc::in_parallel() ,
+    if( op_name2enum.size() == 0 )
+    {   CPPAD_ASSERT_KNOWN( ! CppAD::thread_alloc::in_parallel() ,
             "call to set_operator_info in parallel mode"
         );
-        local::graph::set_operator_info();
+        set_operator_info();
     }
     // --------------------------------------------------------------------
     const string&  function_name( graph_obj.function_name_get() );
@@ -54,13 +134,13 @@ void CppAD::local::graph::json_writer(
     }
     // ----------------------------------------------------------------------
     // output: starting '{' for this graph
-    json = "{\n";
+    json << "{\n";
     //
     // output: function_name
-    json += "'function_name' : '" + function_name + "',\n";
+    json << "'function_name' : '" << function_name << "',\n";
     //
     // output: op_define_vec
-    json += "'op_define_vec' : [ " + to_string(n_define) + ", [\n";
+    json << "'op_define_vec' : [ " << n_define << ", [\n";
     size_t count_define = 0;
     for(size_t i = 0; i < n_graph_op; ++i)
     {   if( is_graph_op_used[i] )
@@ -68,32 +148,32 @@ void CppAD::local::graph::json_writer(
             const string name = op_enum2name[i];
             size_t op_code    = graph_code[i];
             size_t n_arg      = op_enum2fixed_n_arg[i];
-            json += "{ 'op_code':" + to_string(op_code);
-            json += ", 'name':'" + name + "'";
+            json << "{ 'op_code':" << op_code;
+            json << ", 'name':'" << name << "'";
             if( n_arg != 0 )
-                json += ", 'n_arg':" + to_string(n_arg);
-            json += " }";
+                json << ", 'n_arg':" << n_arg;
+            json << " }";
             if( count_define < n_define )
-                json += ",\n";
+                json << ",\n";
         }
     }
-    json += " ]\n] ,\n";
+    json << " ]\n] ,\n";
     //
     // output: n_dynamic_ind
-    json += "'n_dynamic_ind' : " + to_string( n_dynamic_ind ) + ",\n";
+    json << "'n_dynamic_ind' : " << n_dynamic_ind << ",\n";
     //
     // output: n_variable_ind
-    json += "'n_variable_ind' : " + to_string( n_variable_ind ) + ",\n";
+    json << "'n_variable_ind' : " << n_variable_ind << ",\n";
     //
     // output: constant_vec
     size_t n_constant = graph_obj.constant_vec_size();
-    json += "'constant_vec' : [ " + to_string(n_constant) + ", [\n";
+    json << "'constant_vec' : [ " << n_constant << ", [\n";
     for(size_t i = 0; i < n_constant; ++i)
-    {   json += to_string( graph_obj.constant_vec_get(i) );
+    {   json << graph_obj.constant_vec_get(i);
         if( i + 1 < n_constant )
-            json += ",\n";
+            json << ",\n";
     }
-    json += " ] ],\n";
+    json << " ] ],\n";
     // -----------------------------------------------------------------------
     //
     // defined here to avoid memory re-allocation for each operator
@@ -103,7 +183,7 @@ void CppAD::local::graph::json_writer(
     cpp_graph::const_iterator graph_itr;
     //
     // output: op_usage_vec
-    json += "'op_usage_vec' : [ " + to_string(n_usage) + ", [\n";
+    json << "'op_usage_vec' : [ " << n_usage << ", [\n";
     for(size_t op_index = 0; op_index < n_usage; ++op_index)
     {   // op_enum, str_index, n_result, arg_node
         if( op_index == 0 )
@@ -128,14 +208,14 @@ void CppAD::local::graph::json_writer(
             // --------------------------------------------------------------
             // sum
             case sum_graph_op:
-            json += "[ " + to_string(op_code) + ", 1, ";
-            json += to_string(n_arg) + ", [ ";
+            json << "[ " << op_code << ", 1, ";
+            json << n_arg << ", [ ";
             for(size_t j = 0; j < n_arg; ++j)
-            {   json += to_string( arg[j] );
+            {   json << arg[j];
                 if( j + 1 < n_arg )
-                    json += ", ";
+                    json << ", ";
             }
-            json += "] ]";
+            json << "] ]";
             break;
 
             // --------------------------------------------------------------
@@ -143,19 +223,19 @@ void CppAD::local::graph::json_writer(
             case atom_graph_op:
             {   size_t name_index = str_index[0];
                 string name = graph_obj.atomic_name_vec_get(name_index);
-                json += "[ " + to_string(op_code) + ", ";
-                json += "'" + name + "', ";
+                json << "[ " << op_code << ", ";
+                json << "'" << name << "', ";
             }
-            json += to_string(n_result) + ", ";
-            json += to_string(n_arg) + ", [";
+            json << n_result << ", ";
+            json << n_arg << ", [";
             for(size_t j = 0; j < n_arg; ++j)
-            {   json += to_string( arg[j] );
+            {   json << arg[j];
                 if( j + 1 < n_arg )
-                    json += ", ";
+                    json << ", ";
                  else
-                    json += " ]";
+                    json << " ]";
             }
-            json += " ]";
+            json << " ]";
             break;
 
             // --------------------------------------------------------------
@@ -166,9 +246,9 @@ void CppAD::local::graph::json_writer(
             case comp_le_graph_op:
             CPPAD_ASSERT_UNKNOWN( n_result == 0 );
             CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            json += "[ " + to_string(op_code) + ", 0, 2, [ ";
-            json += to_string( arg[0] ) + ", ";
-            json += to_string( arg[1] ) + " ] ]";
+            json << "[ " << op_code << ", 0, 2, [ ";
+            json << arg[0] << ", ";
+            json << arg[1] << " ] ]";
             break;
 
             // --------------------------------------------------------------
@@ -178,12 +258,12 @@ void CppAD::local::graph::json_writer(
             CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
             {   size_t name_index = str_index[0];
                 string name = graph_obj.discrete_name_vec_get(name_index);
-                json += "[ " + to_string(op_code) + ", ";
-                json += "'" + name + "', ";
+                json << "[ " << op_code << ", ";
+                json << "'" << name << "', ";
             }
-            json += to_string(n_result) + ", ";
-            json += to_string(n_arg) + ", [ ";
-            json += to_string( arg[0] ) + " ] ]";
+            json << n_result << ", ";
+            json << n_arg << ", [ ";
+            json << arg[0] << " ] ]";
             break;
             // --------------------------------------------------------------
             // print_op
@@ -194,11 +274,11 @@ void CppAD::local::graph::json_writer(
                 size_t after_index  = str_index[1];
                 string before  = graph_obj.print_text_vec_get(before_index);
                 string after   = graph_obj.print_text_vec_get(after_index);
-                json += "[ " + to_string(op_code) + ", ";
-                json += "'" + before + "', ";
-                json += "'" + after + "', 0, 2, [ ";
-                json += to_string( arg[0] ) + ", ";
-                json += to_string( arg[1] ) + " ] ]";
+                json << "[ " << op_code << ", ";
+                json << "'" << before << "', ";
+                json << "'" << after << "', 0, 2, [ ";
+                json << arg[0] << ", ";
+                json << arg[1] << " ] ]";
             }
             break;
 
@@ -206,38 +286,53 @@ void CppAD::local::graph::json_writer(
             default:
             CPPAD_ASSERT_UNKNOWN( n_result == 1 );
             CPPAD_ASSERT_UNKNOWN( op_enum2fixed_n_arg[op_enum] == n_arg );
-            json += "[ " + to_string(op_code) + ", ";
+            json << "[ " << op_code << ", ";
             for(size_t j = 0; j < n_arg; ++j)
-            {   json += to_string( arg[j] );
+            {   json << arg[j];
                 if( j + 1 < n_arg )
-                    json += ", ";
+                    json << ", ";
                  else
-                    json += " ]";
+                    json << " ]";
             }
             break;
 
         } // end switch
         if( op_index + 1 < n_usage )
-            json += ",\n";
+            json << ",\n";
     }
-    json += "\n] ],\n";
+    json << "\n] ],\n";
     // ----------------------------------------------------------------------
     // output: dependent_vec
     size_t n_dependent = graph_obj.dependent_vec_size();
-    json += "'dependent_vec' : [ " + to_string(n_dependent) + ", [ ";
+    json << "'dependent_vec' : [ " << n_dependent << ", [ ";
     for(size_t i = 0; i < n_dependent; ++i)
-    {   json += to_string( graph_obj.dependent_vec_get(i) );
+    {   json << graph_obj.dependent_vec_get(i);
         if( i + 1 < n_dependent )
-            json += ", ";
+            json << ", ";
     }
-    json += " ] ]\n";
+    json << " ] ]\n";
     //
     // output: ending '}' for this graph
-    json += "}\n";
-    // ----------------------------------------------------------------------
-    // Convert the single quote to double quote
-    for(size_t i = 0; i < json.size(); ++i)
-        if( json[i] == '\'' ) json[i] = '"';
+    json << "}\n";
     //
     return;
 }
+
+} // END_EMPTY_NAMESPACE
+
+void CppAD::local::graph::json_writer(
+    std::string&                              json                   ,
+    const cpp_graph&                          graph_obj              )
+{   json.clear();
+    json_buffer buffer(CPPAD_NULL, &json);
+    json_buffer_writer(buffer, graph_obj);
+    buffer.flush();
+}
+
+void CppAD::local::graph::json_writer(
+    std::ostream&                             os                     ,
+    const cpp_graph&                          graph_obj              )
+{   json_buffer buffer(&os, CPPAD_NULL);
+    json_buffer_writer(buffer, graph_obj);
+    buffer.flush();
+}
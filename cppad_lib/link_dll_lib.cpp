@@ -0,0 +1,75 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# ifdef _WIN32
+# include <windows.h>
+# else
+# include <dlfcn.h>
+# endif
+
+// documentation for this class is in the file below
+# include <cppad/utility/link_dll_lib.hpp>
+
+CppAD::link_dll_lib::link_dll_lib(
+    const std::string& dll_file, std::string& err_msg
+) : handle_(CPPAD_NULL)
+{   err_msg = "";
+# ifdef _WIN32
+    handle_ = reinterpret_cast<void*>( LoadLibraryA( dll_file.c_str() ) );
+    if( handle_ == CPPAD_NULL )
+        err_msg = "link_dll_lib: cannot load " + dll_file;
+# else
+    handle_ = dlopen( dll_file.c_str(), RTLD_LAZY );
+    if( handle_ == CPPAD_NULL )
+    {   err_msg = "link_dll_lib: ";
+        const char* dl_error = dlerror();
+        if( dl_error != CPPAD_NULL )
+            err_msg += dl_error;
+        else
+            err_msg += "cannot load " + dll_file;
+    }
+# endif
+}
+
+CppAD::link_dll_lib::~link_dll_lib(void)
+{   if( handle_ != CPPAD_NULL )
+    {
+# ifdef _WIN32
+        FreeLibrary( reinterpret_cast<HMODULE>(handle_) );
+# else
+        dlclose(handle_);
+# endif
+    }
+}
+
+void* CppAD::link_dll_lib::operator()(
+    const std::string& function_name, std::string& err_msg
+) const
+{   err_msg = "";
+    if( handle_ == CPPAD_NULL )
+    {   err_msg = "link_dll_lib: the library was not loaded";
+        return CPPAD_NULL;
+    }
+    void* fun_ptr;
+# ifdef _WIN32
+    fun_ptr = reinterpret_cast<void*>( GetProcAddress(
+        reinterpret_cast<HMODULE>(handle_), function_name.c_str()
+    ) );
+# else
+    // clear any previous error
+    dlerror();
+    fun_ptr = dlsym(handle_, function_name.c_str() );
+# endif
+    if( fun_ptr == CPPAD_NULL )
+        err_msg = "link_dll_lib: cannot find " + function_name;
+    return fun_ptr;
+}
@@ -0,0 +1,94 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin base_simd.cpp$$
+$spell
+    simd
+$$
+
+$section Using AD<simd_double<N>>: Example and Test$$
+
+$head Purpose$$
+The type $codei%simd_double<%N%>%$$, defined in $cref base_simd.hpp$$,
+meets the requirements specified by $cref base_require$$.
+This example evaluates a function, and its derivative,
+at four values of the independent variables using one sweep.
+The function contains a $cref CondExp$$ that chooses a different
+case for some of the lanes.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/example/base_simd.hpp>
+# include <cppad/cppad.hpp>
+
+namespace {
+    // f(x) = x[0] * x[1] if x[0] < x[1], otherwise exp(x[0]) - x[1]
+    template <class Scalar>
+    Scalar f_template(const Scalar& x0, const Scalar& x1)
+    {   return CppAD::CondExpLt(x0, x1, x0 * x1, exp(x0) - x1); }
+}
+
+bool base_simd(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    typedef CppAD::simd_double<4>  simd4;
+    typedef CppAD::AD<simd4>       a_simd4;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // record the function
+    size_t n = 2, m = 1;
+    CPPAD_TESTVECTOR(a_simd4) ax(n), ay(m);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = f_template(ax[0], ax[1]);
+    CppAD::ADFun<simd4> f(ax, ay);
+
+    // four scenarios for the independent variables
+    CPPAD_TESTVECTOR(simd4) x(n), y(m), jac(m * n);
+    for(size_t ell = 0; ell < 4; ++ell)
+    {   x[0][ell] = 0.5 * double(ell);
+        x[1][ell] = 0.75;
+    }
+
+    // evaluate the function and its derivative for all the scenarios
+    y   = f.Forward(0, x);
+    jac = f.Jacobian(x);
+
+    // check each scenario
+    for(size_t ell = 0; ell < 4; ++ell)
+    {   double x0 = x[0][ell];
+        double x1 = x[1][ell];
+        ok &= NearEqual(y[0][ell], f_template(x0, x1), eps99, eps99);
+        if( x0 < x1 )
+        {   ok &= NearEqual(jac[0][ell], x1, eps99, eps99);
+            ok &= NearEqual(jac[1][ell], x0, eps99, eps99);
+        }
+        else
+        {   ok &= NearEqual(jac[0][ell], std::exp(x0), eps99, eps99);
+            ok &= NearEqual(jac[1][ell], -1.0, eps99, eps99);
+        }
+    }
+
+    // comparisons are true if they are true for every lane
+    simd4 zero(0.0), one(1.0);
+    one[0] = 0.0;
+    ok &= zero <= one;
+    ok &= ! (zero < one);
+    ok &= zero != one;
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,112 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin binary_io.cpp$$
+$spell
+    Cpp
+$$
+
+$section Binary Representation of an ADFun Object: Example and Test$$
+
+$head Discussion$$
+This example writes the binary representation to a string stream.
+Normally it would be written to, and read from, a file.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <sstream>
+
+bool binary_io(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // independent dynamic parameter vector
+    size_t np = 1;
+    CPPAD_TESTVECTOR(AD<double>) ap(np);
+    ap[0] = 2.0;
+
+    // independent variable vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables, dynamic parameters, start recording
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+
+    // a VecAD object with index that depends on the independent variables
+    CppAD::VecAD<double> av(2);
+    AD<double> azero(0), aone(1);
+    av[azero] = ax[0];
+    av[aone]  = ax[1];
+    AD<double> aindex = CppAD::CondExpLt(ax[0], ax[1], azero, aone);
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = exp( ax[0] ) * ax[1] + ap[0];
+    ay[1] = av[aindex] * ax[0];
+    ay[2] = sin( ap[0] );
+
+    // create f: x -> y, stop recording, and optimize
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+
+    // write the binary representation of f
+    std::stringstream stream(
+        std::ios::in | std::ios::out | std::ios::binary
+    );
+    f.to_binary(stream);
+
+    // read it into g
+    CppAD::ADFun<double> g;
+    g.from_binary(stream);
+    ok &= g.size_op()  == f.size_op();
+    ok &= g.size_var() == f.size_var();
+    ok &= g.size_par() == f.size_par();
+    ok &= g.size_dyn_ind() == np;
+    ok &= g.Domain() == n;
+    ok &= g.Range()  == m;
+
+    // change the dynamic parameter and compute function values
+    CPPAD_TESTVECTOR(double) p(np), x(n), y(m), check(m);
+    p[0] = 3.0;
+    x[0] = 3.0;
+    x[1] = 2.0;
+    f.new_dynamic(p);
+    g.new_dynamic(p);
+    y     = g.Forward(0, x);
+    check = f.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+    ok &= NearEqual(y[1], x[1] * x[0], eps, eps);
+    ok &= NearEqual(y[2], std::sin(p[0]), eps, eps);
+
+    // derivative values
+    CPPAD_TESTVECTOR(double) jac, jac_check;
+    jac       = g.Jacobian(x);
+    jac_check = f.Jacobian(x);
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= NearEqual(jac[k], jac_check[k], eps, eps);
+
+    return ok;
+}
+// END C++
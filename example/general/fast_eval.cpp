@@ -0,0 +1,112 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fast_eval.cpp$$
+$spell
+    Cpp
+$$
+
+$section Pre-Decoded Evaluation: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool fast_eval(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables and starting recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = exp( ax[0] ) * ax[1];
+    ay[1] = CppAD::CondExpLt(ax[0], ax[1], ax[0] - ax[1], ax[1] / ax[0]);
+    ay[2] = pow(ax[0], 2.0) + sin( ax[1] );
+    if( ax[0] < ax[1] )
+        ay[2] += 1.0;
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // g is a copy of f that does not use the pre-decoded operations
+    CppAD::ADFun<double> g;
+    g = f;
+
+    // pre-decode the operations in f
+    ok &= f.prepare_fast_eval();
+
+    // zero order forward (the comparison is not the same as when recorded)
+    CPPAD_TESTVECTOR(double) x(n), y(m), check(m);
+    x[0] = 2.0;
+    x[1] = 1.0;
+    y     = f.Forward(0, x);
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+    ok &= f.compare_change_number() == 1;
+    ok &= f.compare_change_number() == g.compare_change_number();
+
+    // first order forward (uses the standard routines)
+    CPPAD_TESTVECTOR(double) dx(n), dy(m);
+    dx[0] = 1.0;
+    dx[1] = 2.0;
+    dy    = f.Forward(1, dx);
+    check = g.Forward(1, dx);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(dy[i], check[i], eps, eps);
+
+    // first and second order reverse
+    CPPAD_TESTVECTOR(double) w(m), dw, dw_check;
+    for(size_t i = 0; i < m; i++)
+        w[i] = double(i + 1);
+    dw       = f.Reverse(1, w);
+    dw_check = g.Reverse(1, w);
+    for(size_t j = 0; j < n; j++)
+        ok &= NearEqual(dw[j], dw_check[j], eps, eps);
+    dw.resize(2 * n);
+    dw_check.resize(2 * n);
+    dw       = f.Reverse(2, w);
+    dw_check = g.Reverse(2, w);
+    for(size_t j = 0; j < 2 * n; j++)
+        ok &= NearEqual(dw[j], dw_check[j], eps, eps);
+
+    // a function that uses VecAD operations cannot be pre-decoded
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    AD<double> azero(0);
+    av[azero] = ax[0];
+    ay[0] = av[azero];
+    ay[1] = ax[1];
+    ay[2] = ax[0] * ax[1];
+    CppAD::ADFun<double> h(ax, ay);
+    ok &= ! h.prepare_fast_eval();
+    y = h.Forward(0, x);
+    ok &= NearEqual(y[0], x[0], eps, eps);
+    ok &= NearEqual(y[2], x[0] * x[1], eps, eps);
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,103 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_batch.cpp$$
+$spell
+    Cpp
+$$
+
+$section Forward Mode: Example and Test of Multiple Points$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool forward_batch(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables and starting recording
+    CppAD::Independent(ax);
+
+    // a VecAD vector that is indexed by a variable
+    CppAD::VecAD<double> av(2);
+    AD<double> azero(0), aone(1);
+    av[azero] = ax[0];
+    av[aone]  = ax[1];
+    AD<double> aindex = CppAD::CondExpLt(ax[0], ax[1], aone, azero);
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = exp( ax[0] ) * ax[1];
+    ay[1] = CppAD::CondExpLt(ax[0], ax[1], ax[0] - ax[1], ax[1] / ax[0]);
+    ay[2] = av[aindex] + 2.0;
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // values of x at N points; xN[ N * j + k ] is x_j at the k-th point
+    size_t N = 5;
+    CPPAD_TESTVECTOR(double) xN(N * n), yN;
+    for(size_t k = 0; k < N; k++)
+    {   xN[ N * 0 + k ] = double(k + 1);
+        xN[ N * 1 + k ] = double(N - k);
+    }
+
+    // evaluate f(x) at all the points using one sweep
+    yN = f.forward_batch(N, xN);
+    ok &= size_t( yN.size() ) == N * m;
+
+    // check the results
+    for(size_t k = 0; k < N; k++)
+    {   double x0 = xN[ N * 0 + k ];
+        double x1 = xN[ N * 1 + k ];
+        //
+        double check = exp(x0) * x1;
+        ok &= NearEqual(yN[ N * 0 + k ], check, eps, eps);
+        //
+        if( x0 < x1 )
+            check = x0 - x1;
+        else
+            check = x1 / x0;
+        ok &= NearEqual(yN[ N * 1 + k ], check, eps, eps);
+        //
+        if( x0 < x1 )
+            check = x1 + 2.0;
+        else
+            check = x0 + 2.0;
+        ok &= NearEqual(yN[ N * 2 + k ], check, eps, eps);
+    }
+
+    // The zero order Taylor coefficients stored in f are not affected
+    CPPAD_TESTVECTOR(double) x(n), y;
+    ok &= f.size_order() == 1;
+    for(size_t j = 0; j < n; j++)
+        x[j] = xN[ N * j + 0 ];
+    y   = f.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], yN[ N * i + 0 ], eps, eps);
+
+    return ok;
+}
+// END C++
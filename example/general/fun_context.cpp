@@ -0,0 +1,118 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_context.cpp$$
+$spell
+    Cpp
+$$
+
+$section Sharing One ADFun Object Between Contexts: Example and Test$$
+
+$head Discussion$$
+This example uses two contexts, at two different argument values,
+and the same $code ADFun$$ object.
+In a multi-threading program,
+each context would be used by a different thread.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool fun_context(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables and starting recording
+    CppAD::Independent(ax);
+
+    // a VecAD object with index that depends on the independent variables
+    CppAD::VecAD<double> av(2);
+    AD<double> azero(0), aone(1);
+    av[azero] = ax[0];
+    av[aone]  = ax[1];
+    AD<double> aindex = CppAD::CondExpLt(ax[0], ax[1], azero, aone);
+
+    // range space vector
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = exp( ax[0] ) * ax[1];
+    ay[1] = av[aindex] * ax[0];
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // two contexts that share the operation sequence in f
+    CppAD::fun_context<double> context_1(f), context_2(f);
+    ok &= context_1.size_order() == 0;
+
+    // zero order forward at two different points
+    CPPAD_TESTVECTOR(double) x1(n), x2(n), y1(m), y2(m), check(m);
+    x1[0] = 1.0;
+    x1[1] = 2.0;
+    x2[0] = 3.0;
+    x2[1] = 2.0;
+    y1 = context_1.Forward(0, x1);
+    y2 = context_2.Forward(0, x2);
+    ok &= context_1.size_order() == 1;
+    //
+    // check values (x1[0] < x1[1] and x2[0] > x2[1])
+    ok &= NearEqual(y1[0], exp(x1[0]) * x1[1], eps, eps);
+    ok &= NearEqual(y1[1], x1[0] * x1[0], eps, eps);
+    ok &= NearEqual(y2[0], exp(x2[0]) * x2[1], eps, eps);
+    ok &= NearEqual(y2[1], x2[1] * x2[0], eps, eps);
+
+    // first order forward in each context
+    CPPAD_TESTVECTOR(double) dx(n), dy1(m), dy2(m);
+    dx[0] = 1.0;
+    dx[1] = 0.0;
+    dy1 = context_1.Forward(1, dx);
+    dy2 = context_2.Forward(1, dx);
+    ok &= context_1.size_order() == 2;
+
+    // the same results using f at the second point
+    check = f.Forward(0, x2);
+    check = f.Forward(1, dx);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(dy2[i], check[i], eps, eps);
+
+    // second order reverse in first context
+    CPPAD_TESTVECTOR(double) w(m), dw(2 * n), dw_check(2 * n);
+    w[0] = 1.0;
+    w[1] = 2.0;
+    dw = context_1.Reverse(2, w);
+
+    // the same results using f at the first point
+    check    = f.Forward(0, x1);
+    check    = f.Forward(1, dx);
+    dw_check = f.Reverse(2, w);
+    for(size_t j = 0; j < 2 * n; j++)
+        ok &= NearEqual(dw[j], dw_check[j], eps, eps);
+
+    // free the memory in the contexts
+    context_1.clear();
+    context_2.clear();
+    ok &= context_1.size_order() == 0;
+
+    return ok;
+}
+// END C++
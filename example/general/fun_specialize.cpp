@@ -0,0 +1,125 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_specialize.cpp$$
+$spell
+    Cpp
+$$
+
+$section Specialize an ADFun Object: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool fun_specialize(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // independent dynamic parameter vector
+    size_t np = 2;
+    CPPAD_TESTVECTOR(AD<double>) ap(np);
+    ap[0] = 1.0;
+    ap[1] = 2.0;
+
+    // independent variable vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables, dynamic parameters, start recording
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+
+    // range space vector
+    // if p[0] < p[1], y[0] = exp(x[0]) * p[0], otherwise y[0] = sin(x[1])
+    // y[1] = (p[0] * p[1]) * x[1]
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    AD<double> aexp = exp( ax[0] ) * ap[0];
+    AD<double> asin = sin( ax[1] );
+    ay[0] = CppAD::CondExpLt(ap[0], ap[1], aexp, asin);
+    ay[1] = ( ap[0] * ap[1] ) * ax[1];
+
+    // create f: x -> y and stop recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // a specialization of f (not yet valid)
+    CppAD::fun_specialize<double> spec(f);
+    ok &= ! spec.valid();
+
+    // create the specialized function g for p[0] < p[1]
+    CPPAD_TESTVECTOR(double) p(np), x(n), y(m), check(m);
+    x[0] = 0.5;
+    x[1] = 1.5;
+    ok &= spec.update(x);
+    ok &= spec.valid();
+    CppAD::ADFun<double>& g( spec.fun() );
+    ok &= g.size_dyn_ind() == 0;
+    ok &= g.size_var() < f.size_var();
+
+    // values of g
+    x[0] = 0.7;
+    x[1] = 0.3;
+    y    = g.Forward(0, x);
+    ok &= NearEqual(y[0], exp(x[0]) * 1.0, eps, eps);
+    ok &= NearEqual(y[1], 2.0 * x[1], eps, eps);
+
+    // new_dynamic with the same values does not invalidate g
+    p[0] = 1.0;
+    p[1] = 2.0;
+    f.new_dynamic(p);
+    ok &= spec.valid();
+    ok &= ! spec.update(x);
+
+    // change the dynamic parameters so that p[0] > p[1]
+    p[0] = 3.0;
+    p[1] = 2.0;
+    f.new_dynamic(p);
+    ok &= ! spec.valid();
+    ok &= spec.update(x);
+    ok &= spec.valid();
+
+    // compare values of f and g
+    y     = g.Forward(0, x);
+    check = f.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+    ok &= NearEqual(y[0], sin(x[1]), eps, eps);
+
+    // compare derivatives of f and g
+    CPPAD_TESTVECTOR(double) jac, jac_check;
+    jac       = g.Jacobian(x);
+    jac_check = f.Jacobian(x);
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= NearEqual(jac[k], jac_check[k], eps, eps);
+
+    // a specialization at a nan value is valid for the same nan value
+    p[0] = CppAD::nan(0.0);
+    f.new_dynamic(p);
+    ok &= ! spec.valid();
+    ok &= spec.update(x);
+    ok &= spec.valid();
+    f.new_dynamic(p);
+    ok &= spec.valid();
+    ok &= ! spec.update(x);
+
+    return ok;
+}
+// END C++
@@ -111,6 +111,8 @@ extern bool atanh(void);
 extern bool azmul(void);
 extern bool base2ad(void);
 extern bool base_require(void);
+extern bool base_simd(void);
+extern bool binary_io(void);
 extern bool capacity_order(void);
 extern bool change_param(void);
 extern bool check_for_nan(void);
@@ -124,11 +126,17 @@ extern bool erfc(void);
 extern bool exp(void);
 extern bool expm1(void);
 extern bool fabs(void);
+extern bool fast_eval(void);
+extern bool forward_batch(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
+extern bool hes_vec(void);
 extern bool fun_assign(void);
+extern bool fun_context(void);
+extern bool fun_specialize(void);
 extern bool interp_onetape(void);
 extern bool interp_retape(void);
+extern bool level_eval(void);
 extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
@@ -145,6 +153,7 @@ extern bool pow(void);
 extern bool pow_int(void);
 extern bool print_for(void);
 extern bool rev_checkpoint(void);
+extern bool reverse_dir(void);
 extern bool reverse_one(void);
 extern bool reverse_three(void);
 extern bool reverse_two(void);
@@ -152,7 +161,9 @@ extern bool rosen_34(void);
 extern bool runge_45(void);
 extern bool seq_property(void);
 extern bool sign(void);
+extern bool slot_eval(void);
 extern bool taylor_ode(void);
+extern bool update_eval(void);
 extern bool vec_ad(void);
 // END_SORT_THIS_LINE_MINUS_1
 
@@ -230,6 +241,8 @@ int main(void)
     Run( azmul,             "azmul"            );
     Run( base2ad,           "base2ad"          );
     Run( base_require,      "base_require"     );
+    Run( base_simd,         "base_simd"        );
+    Run( binary_io,         "binary_io"        );
     Run( capacity_order,    "capacity_order"   );
     Run( change_param,      "change_param"     );
     Run( compare_change,    "compare_change"   );
@@ -240,11 +253,17 @@ int main(void)
     Run( exp,               "exp"              );
     Run( expm1,             "expm1"            );
     Run( fabs,              "fabs"             );
+    Run( fast_eval,         "fast_eval"        );
+    Run( forward_batch,     "forward_batch"    );
     Run( forward_dir,       "forward_dir"      );
     Run( forward_order,     "forward_order"    );
+    Run( hes_vec,           "hes_vec"          );
     Run( fun_assign,        "fun_assign"       );
+    Run( fun_context,       "fun_context"      );
+    Run( fun_specialize,    "fun_specialize"   );
     Run( interp_onetape,    "interp_onetape"   );
     Run( interp_retape,     "interp_retape"    );
+    Run( level_eval,        "level_eval"       );
     Run( log,               "log"              );
     Run( log10,             "log10"            );
     Run( log1p,             "log1p"            );
@@ -258,6 +277,7 @@ int main(void)
     Run( pow,               "pow"              );
     Run( pow_int,           "pow_int"          );
     Run( rev_checkpoint,    "rev_checkpoint"   );
+    Run( reverse_dir,       "reverse_dir"      );
     Run( reverse_one,       "reverse_one"      );
     Run( reverse_three,     "reverse_three"    );
     Run( reverse_two,       "reverse_two"      );
@@ -265,7 +285,9 @@ int main(void)
     Run( runge_45,        "runge_45"       );
     Run( seq_property,      "seq_property"     );
     Run( sign,              "sign"             );
+    Run( slot_eval,         "slot_eval"        );
     Run( taylor_ode,        "ode_taylor"       );
+    Run( update_eval,       "update_eval"      );
     Run( vec_ad,            "vec_ad"           );
     // END_SORT_THIS_LINE_MINUS_1
 # ifndef CPPAD_DEBUG_AND_RELEASE
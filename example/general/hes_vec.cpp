@@ -0,0 +1,111 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin hes_vec.cpp$$
+$spell
+    Cpp
+    Hessian
+    vec
+$$
+
+$section Hessian Times a Batch of Vectors: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool hes_vec(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; j++)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and starting recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    // y_0 = x_0 * x_1 * x_2 ,  y_1 = exp(x_0) + x_1 * x_1
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = exp( ax[0] ) + ax[1] * ax[1];
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // argument value and weights
+    CPPAD_TESTVECTOR(double) x(n), w(m);
+    x[0] = 0.5;
+    x[1] = 1.5;
+    x[2] = 2.5;
+    w[0] = 2.0;
+    w[1] = 3.0;
+
+    // Hessian of w_0 * y_0 + w_1 * y_1
+    double H[3][3];
+    H[0][0] = w[1] * exp( x[0] );
+    H[0][1] = H[1][0] = w[0] * x[2];
+    H[0][2] = H[2][0] = w[0] * x[1];
+    H[1][1] = w[1] * 2.0;
+    H[1][2] = H[2][1] = w[0] * x[0];
+    H[2][2] = 0.0;
+
+    // batch of K vectors, the k-th vector is v[k * n + j], j = 0, ..., n-1
+    size_t K = 2;
+    CPPAD_TESTVECTOR(double) v(K * n), hv(K * n);
+    for(size_t k = 0; k < K; k++)
+    {   for(size_t j = 0; j < n; j++)
+            v[k * n + j] = double(k + 1) / double(j + 1);
+    }
+    hv = f.hes_vec(x, w, v);
+    ok &= size_t( hv.size() ) == K * n;
+
+    // check the products
+    for(size_t k = 0; k < K; k++)
+    {   for(size_t i = 0; i < n; i++)
+        {   double check = 0.0;
+            for(size_t j = 0; j < n; j++)
+                check += H[i][j] * v[k * n + j];
+            ok &= NearEqual(hv[k * n + i], check, eps99, eps99);
+        }
+    }
+
+    // another call at the same x without repeating the zero order sweep
+    // (a single vector is a batch with K = 1)
+    CPPAD_TESTVECTOR(double) e(n), he(n);
+    for(size_t j = 0; j < n; j++)
+        e[j] = 0.0;
+    e[2] = 1.0;
+    he = f.hes_vec(w, e);
+    for(size_t i = 0; i < n; i++)
+        ok &= NearEqual(he[i], H[i][2], eps99, eps99);
+
+    // a different x using the zero order sweep done by Forward(0, x)
+    x[0] = -1.0;
+    f.Forward(0, x);
+    he   = f.hes_vec(w, e);
+    ok  &= NearEqual(he[0], w[0] * x[1], eps99, eps99);
+    ok  &= NearEqual(he[1], w[0] * x[0], eps99, eps99);
+    ok  &= NearEqual(he[2], 0.0,         eps99, eps99);
+
+    return ok;
+}
+// END C++
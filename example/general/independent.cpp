@@ -86,6 +86,17 @@ bool Test(void)
     ok &= NearEqual(dy[0] ,   1.,  eps99 , eps99);
     ok &= NearEqual(dy[1] , x[0],  eps99 , eps99);
 
+    // record the same function again using f as a hint for its size
+    CppAD::Independent(X, f);
+    Y[0] = X[0] + X[1];
+    Y[1] = X[0] * X[1];
+    CppAD::ADFun<double> g(X, Y);
+    ok &= g.size_op() == f.size_op();
+    ok &= g.size_par() == f.size_par();
+    y = g.Forward(0, x);
+    ok &= NearEqual(y[0] , 3.,  eps99 , eps99);
+    ok &= NearEqual(y[1] , 2.,  eps99 , eps99);
+
     return ok;
 }
 } // End of empty namespace -------------------------------------------
@@ -0,0 +1,107 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin level_eval.cpp$$
+$spell
+    Cpp
+$$
+
+$section Forward and Reverse Using Multiple Threads: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool level_eval(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 100. * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    // (n is large enough so that the sum below is divided among threads)
+    size_t n = 3000;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; j++)
+        ax[j] = double(j + 1) / double(n);
+
+    // declare independent variables and starting recording
+    CppAD::Independent(ax);
+
+    // the first component of y is a sum of terms that do not depend on
+    // each other, the second component is a conditional expression
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    AD<double> asum = 0.0;
+    for(size_t j = 0; j < n; j++)
+        asum += sin(ax[j]) * ax[j] + exp( ax[j] / 2.0 );
+    ay[0] = asum;
+    ay[1] = CppAD::CondExpLt(ax[0], ax[1], ax[0] * ax[1], ax[0] - ax[1]);
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // optimization creates a cumulative summation operator for asum
+    f.optimize();
+
+    // g is a copy of f that only uses one thread
+    CppAD::ADFun<double> g;
+    g = f;
+
+    // determine the levels for f
+    ok &= f.size_level() == 0;
+    ok &= f.prepare_level_eval();
+    //
+    // the terms in the sum are computed in a few levels
+    ok &= 0 < f.size_level() && f.size_level() < 10;
+
+    // point at which to evaluate f and weight vector for reverse mode
+    CPPAD_TESTVECTOR(double) x(n), w(m), y(m), check(m), dw(n), dw_check(n);
+    for(size_t j = 0; j < n; j++)
+        x[j] = double(j + 2) / double(n);
+    w[0] = 2.0;
+    w[1] = 3.0;
+    //
+    check    = g.Forward(0, x);
+    dw_check = g.Reverse(1, w);
+    //
+    // parallel_ad must be called before using more than one thread
+    CppAD::parallel_ad<double>();
+    for(size_t n_thread = 1; n_thread <= 4; n_thread *= 2)
+    {   // zero order forward mode
+        y = f.forward_level(x, n_thread);
+        for(size_t i = 0; i < m; i++)
+            ok &= NearEqual(y[i], check[i], eps, eps);
+        ok &= f.size_order() == 1;
+        //
+        // first order reverse mode
+        dw = f.reverse_level(w, n_thread);
+        for(size_t j = 0; j < n; j++)
+            ok &= NearEqual(dw[j], dw_check[j], eps, eps);
+    }
+
+    // the zero order Taylor coefficients correspond to x,
+    // so first order forward mode can be used at this point
+    CPPAD_TESTVECTOR(double) dx(n), dy(m), dy_check(m);
+    for(size_t j = 0; j < n; j++)
+        dx[j] = 1.0;
+    dy       = f.Forward(1, dx);
+    dy_check = g.Forward(1, dx);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(dy[i], dy_check[i], eps, eps);
+
+    return ok;
+}
+// END C++
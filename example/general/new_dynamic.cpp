@@ -112,6 +112,22 @@ bool new_dynamic(void)
     ok   &= f.size_order() == 2;
     check = (dynamic[2] + x[1])*(dynamic[0] + 2.0 + x[0] + dynamic[1] + x[0]);
     ok  &= NearEqual(dy[0] , check, eps, eps);
+
+    // only change the value of dynamic[0]; i.e., only the dependent
+    // dynamic parameter adependent_dyn is re-computed
+    CPPAD_TESTVECTOR(size_t) changed(1);
+    CPPAD_TESTVECTOR(double) value(1);
+    changed[0] = 0;
+    value[0]   = 5.0;
+    dynamic[0] = value[0];
+    f.new_dynamic(changed, value);
+    ok  &= f.size_order() == 0;
+    //
+    y    = f.Forward(0, x);
+    check  = dynamic[0] + 2.0 + x[0];
+    check *= dynamic[1] + x[0];
+    check *= dynamic[2] + x[1];
+    ok  &= NearEqual(y[0] , check, eps, eps);
     //
     return ok;
 }
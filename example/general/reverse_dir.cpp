@@ -0,0 +1,116 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_dir.cpp$$
+$spell
+    Cpp
+$$
+
+$section Reverse Mode: Example and Test of Multiple Directions$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool reverse_dir(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // domain space vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables and starting recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = sin( ax[0] );
+    ay[2] = exp( ax[1] ) + ax[0];
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // zero order forward mode
+    CPPAD_TESTVECTOR(double) x(n);
+    x[0] = 0.3;
+    x[1] = 0.7;
+    f.Forward(0, x);
+
+    // use one reverse sweep to compute all the rows of the Jacobian;
+    // i.e., direction ell has weight one for y_ell and zero otherwise
+    size_t r = m;
+    CPPAD_TESTVECTOR(double) w(r * m), dw(r * n);
+    for(size_t i = 0; i < m; i++)
+    {   for(size_t ell = 0; ell < r; ell++)
+            w[r * i + ell] = double( i == ell );
+    }
+    dw = f.Reverse(1, r, w);
+    ok &= size_t( dw.size() ) == r * n;
+
+    // check the Jacobian; dw[r * j + ell] is partial of y_ell w.r.t. x_j
+    ok &= NearEqual(dw[r * 0 + 0], x[1],         eps, eps);
+    ok &= NearEqual(dw[r * 1 + 0], x[0],         eps, eps);
+    ok &= NearEqual(dw[r * 0 + 1], cos(x[0]),    eps, eps);
+    ok &= NearEqual(dw[r * 1 + 1], 0.0,          eps, eps);
+    ok &= NearEqual(dw[r * 0 + 2], 1.0,          eps, eps);
+    ok &= NearEqual(dw[r * 1 + 2], exp(x[1]),    eps, eps);
+
+    // first order forward mode in the direction x1
+    CPPAD_TESTVECTOR(double) x1(n);
+    x1[0] = 1.0;
+    x1[1] = 0.0;
+    f.Forward(1, x1);
+
+    // two directions for second order reverse, each using all orders
+    // of the weights; i.e., w.size() == r * m * q
+    size_t q = 2;
+    r        = 2;
+    w.resize(r * m * q);
+    dw.resize(r * n * q);
+    for(size_t i = 0; i < m; i++)
+    {   for(size_t k = 0; k < q; k++)
+        {   w[r * (i * q + k) + 0] = double(i + k + 1);
+            w[r * (i * q + k) + 1] = double(i) - double(k);
+        }
+    }
+    dw = f.Reverse(q, r, w);
+    ok &= size_t( dw.size() ) == r * n * q;
+
+    // check that the result is the same as r separate calls to Reverse
+    CPPAD_TESTVECTOR(double) w_ell(m * q), dw_ell(n * q);
+    for(size_t ell = 0; ell < r; ell++)
+    {   for(size_t i = 0; i < m; i++)
+        {   for(size_t k = 0; k < q; k++)
+                w_ell[i * q + k] = w[r * (i * q + k) + ell];
+        }
+        dw_ell = f.Reverse(q, w_ell);
+        for(size_t j = 0; j < n; j++)
+        {   for(size_t k = 0; k < q; k++)
+            {   double check = dw_ell[j * q + k];
+                double value = dw[r * (j * q + k) + ell];
+                ok &= NearEqual(value, check, eps, eps);
+            }
+        }
+    }
+    return ok;
+}
+// END C++
@@ -159,6 +159,13 @@ bool seq_property(void)
     sum += nvecad     * sizeof(CPPAD_TAPE_ADDR_TYPE);
     ok &= f.size_op_seq() == sum;
 
+    // constant parameter hash table: the phantom parameter, 0, 1 for v,
+    // 0 for the index I, 2 for w + 2, and 1 for y[0] were put in the
+    // recording, but only 0, 1, and 2 are in the table
+    ok &= f.size_con_par_put()   == 6;
+    ok &= f.size_con_par_probe() >= f.size_con_par_put();
+    ok &= f.size_con_par_slot()  >= 2 * 3;
+
     return ok;
 }
 
@@ -0,0 +1,124 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin slot_eval.cpp$$
+$spell
+    Cpp
+$$
+
+$section Zero Order Forward Using Slots: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool slot_eval(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // dynamic parameter vector
+    size_t nd = 1;
+    CPPAD_TESTVECTOR(AD<double>) adyn(nd);
+    adyn[0] = 2.0;
+
+    // domain space vector
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+
+    // declare independent variables and starting recording
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, adyn);
+
+    // a long chain of operations where each result is only used
+    // by the next few operations
+    AD<double> asum = 0.0;
+    AD<double> aterm = ax[0];
+    size_t n_term = 50;
+    for(size_t k = 0; k < n_term; ++k)
+    {   aterm = sin(aterm) * ax[1] + adyn[0];
+        asum += pow(aterm, 2.0) - aterm;
+    }
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = asum;
+    ay[1] = CppAD::CondExpLt(ax[0], ax[1], ax[0] - ax[1], ax[1] / ax[0]);
+    ay[2] = ax[0];
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // optimization creates cumulative summation operators for asum
+    f.optimize();
+
+    // g is a copy of f that does not use slots
+    CppAD::ADFun<double> g;
+    g = f;
+
+    // assign the variables in f to slots
+    ok &= f.size_slot() == 0;
+    ok &= f.prepare_slot_eval();
+    ok &= 0 < f.size_slot();
+    ok &= f.size_slot() < f.size_var();
+
+    // f does not store Taylor coefficients
+    CPPAD_TESTVECTOR(double) x(n), y(m), check(m);
+    x[0] = 2.0;
+    x[1] = 1.0;
+    y     = f.forward_slot(x);
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+    ok &= f.size_order() == 0;
+
+    // change the dynamic parameter
+    CPPAD_TESTVECTOR(double) dyn(nd);
+    dyn[0] = 3.0;
+    f.new_dynamic(dyn);
+    g.new_dynamic(dyn);
+    y     = f.forward_slot(x);
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+
+    // the slots are copied by assignment
+    CppAD::ADFun<double> h;
+    h = f;
+    ok &= h.size_slot() == f.size_slot();
+
+    // a function that uses VecAD operations cannot use slots
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    AD<double> azero(0);
+    av[azero] = ax[0];
+    ay[0] = av[azero];
+    ay[1] = ax[1];
+    ay[2] = ax[0] * ax[1];
+    h.Dependent(ax, ay);
+    ok &= ! h.prepare_slot_eval();
+    ok &= h.size_slot() == 0;
+    y = h.forward_slot(x);
+    ok &= NearEqual(y[0], x[0], eps, eps);
+    ok &= NearEqual(y[2], x[0] * x[1], eps, eps);
+
+    return ok;
+}
+// END C++
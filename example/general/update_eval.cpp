@@ -0,0 +1,157 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin update_eval.cpp$$
+$spell
+    Cpp
+$$
+
+$section Zero Order Forward When Only Some Arguments Change: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool update_eval(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+
+    // dynamic parameter vector
+    size_t nd = 1;
+    CPPAD_TESTVECTOR(AD<double>) adyn(nd);
+    adyn[0] = 2.0;
+
+    // domain space vector
+    size_t n = 4;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; j++)
+        ax[j] = double(j + 1);
+
+    // declare independent variables and starting recording
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, adyn);
+
+    // each of the first three components of y only depends on one
+    // component of x, the last component depends on all of them
+    size_t m = 4;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    AD<double> asum = 0.0;
+    for(size_t i = 0; i < m - 1; i++)
+    {   ay[i] = adyn[0] * sin(ax[i]) + exp(ax[i]);
+        asum += ay[i];
+    }
+    ay[m-1] = CppAD::CondExpLt(ax[0], ax[3], asum, asum * ax[3]);
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // optimization creates cumulative summation operators for asum
+    f.optimize();
+
+    // g is a copy of f that does not use forward_update
+    CppAD::ADFun<double> g;
+    g = f;
+
+    // determine the users of each variable in f
+    ok &= f.prepare_update_eval();
+
+    // zero order forward at the starting point
+    CPPAD_TESTVECTOR(double) x(n), y(m), check(m);
+    for(size_t j = 0; j < n; j++)
+        x[j] = double(j + 1) / 2.0;
+    y = f.Forward(0, x);
+
+    // change one component of x
+    CPPAD_TESTVECTOR(size_t) changed(1);
+    CPPAD_TESTVECTOR(double) value(1);
+    changed[0] = 1;
+    value[0]   = 3.0;
+    x[1]       = value[0];
+    y          = f.forward_update(changed, value);
+    check      = g.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+
+    // change two components of x so that the conditional expression
+    // uses the other case
+    changed.resize(2);
+    value.resize(2);
+    changed[0] = 3;
+    value[0]   = -1.0;
+    changed[1] = 0;
+    value[1]   = 0.5;
+    x[3]       = value[0];
+    x[0]       = value[1];
+    y          = f.forward_update(changed, value);
+    check      = g.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+
+    // the zero order Taylor coefficients correspond to the new point,
+    // so first order reverse mode can be used at this point
+    ok &= f.size_order() == 1;
+    CPPAD_TESTVECTOR(double) w(m), dw(n), dw_check(n);
+    for(size_t i = 0; i < m; i++)
+        w[i] = double(i + 1);
+    dw       = f.Reverse(1, w);
+    dw_check = g.Reverse(1, w);
+    for(size_t j = 0; j < n; j++)
+        ok &= NearEqual(dw[j], dw_check[j], eps, eps);
+
+    // after a change to the dynamic parameters, zero order forward
+    // must be used before forward_update
+    CPPAD_TESTVECTOR(double) dyn(nd);
+    dyn[0] = 3.0;
+    f.new_dynamic(dyn);
+    g.new_dynamic(dyn);
+    y          = f.Forward(0, x);
+    changed.resize(1);
+    value.resize(1);
+    changed[0] = 2;
+    value[0]   = 4.0;
+    x[2]       = value[0];
+    y          = f.forward_update(changed, value);
+    check      = g.Forward(0, x);
+    for(size_t i = 0; i < m; i++)
+        ok &= NearEqual(y[i], check[i], eps, eps);
+
+    // a function that uses VecAD operations uses Forward(0, x)
+    CPPAD_TESTVECTOR(AD<double>) au(2), av(2);
+    au[0] = 1.0;
+    au[1] = 2.0;
+    CppAD::Independent(au);
+    CppAD::VecAD<double> avec(2);
+    AD<double> azero(0);
+    avec[azero] = au[0];
+    av[0] = avec[azero];
+    av[1] = au[0] * au[1];
+    CppAD::ADFun<double> h(au, av);
+    ok &= ! h.prepare_update_eval();
+    CPPAD_TESTVECTOR(double) u(2), v(2);
+    u[0] = 3.0;
+    u[1] = 4.0;
+    v    = h.Forward(0, u);
+    changed[0] = 1;
+    value[0]   = 5.0;
+    v    = h.forward_update(changed, value);
+    ok  &= NearEqual(v[0], u[0], eps, eps);
+    ok  &= NearEqual(v[1], u[0] * value[0], eps, eps);
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,101 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin csrc_fun.cpp$$
+$spell
+    csrc
+    fun
+$$
+
+$section Compiled C Source Code Version of an ADFun: Example and Test$$
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/core/csrc_fun.hpp>
+# include <cstdio>
+
+bool csrc_fun(void)
+{   bool ok = true;
+    using CppAD::vector;
+    using CppAD::AD;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // f(x) = [ x[0] * x[1]        ]
+    //        [ sin(x[1])          ]
+    //        [ x[2] * x[2] / x[0] ]
+    size_t n = 3, m = 3;
+    vector< AD<double> > ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = sin(ax[1]);
+    ay[2] = ax[2] * ax[2] / ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // compiled version of f
+    std::string file_prefix = "csrc_fun_example";
+    std::string options     = "reverse_one sparse_jac";
+    vector<double> x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 0.5 / double(j + 1);
+    CppAD::csrc_fun cfun(file_prefix, f, x, options);
+    ok &= cfun.Domain() == n;
+    ok &= cfun.Range()  == m;
+    //
+    // zero order forward
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(n - j);
+    vector<double> y     = cfun.Forward(0, x);
+    vector<double> check = f.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= CppAD::NearEqual(y[i], check[i], eps99, eps99);
+    //
+    // first order reverse
+    vector<double> w(m);
+    for(size_t i = 0; i < m; ++i)
+        w[i] = double(i + 2);
+    vector<double> dw = cfun.Reverse(1, w);
+    check = f.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= CppAD::NearEqual(dw[j], check[j], eps99, eps99);
+    //
+    // sparse Jacobian
+    typedef CppAD::sparse_rc< std::vector<size_t> > sparse_rc;
+    const sparse_rc& pattern = cfun.jac_pattern();
+    size_t nnz = pattern.nnz();
+    ok &= nnz == 5;
+    vector<double> val(nnz);
+    cfun.sparse_jac(x, val);
+    vector<double> jac = f.Jacobian(x);
+    for(size_t k = 0; k < nnz; ++k)
+    {   size_t i = pattern.row()[k];
+        size_t j = pattern.col()[k];
+        ok &= CppAD::NearEqual(val[k], jac[i * n + j], eps99, eps99);
+    }
+    //
+    // the C source files are removed once the library is created
+    // (the library is removed when cfun is destroyed)
+    std::string csrc_file = file_prefix + "_forward_zero.c";
+    std::FILE*  fp        = std::fopen( csrc_file.c_str(), "r" );
+    ok &= fp == CPPAD_NULL;
+    if( fp != CPPAD_NULL )
+        std::fclose(fp);
+    //
+    return ok;
+}
+// END C++
@@ -32,6 +32,7 @@ extern bool atom_op(void);
 extern bool azmul_op(void);
 extern bool cexp_op(void);
 extern bool comp_op(void);
+extern bool csrc_fun(void);
 extern bool discrete_op(void);
 extern bool div_op(void);
 extern bool mul_op(void);
@@ -40,6 +41,7 @@ extern bool print_op(void);
 extern bool sub_op(void);
 extern bool sum_op(void);
 extern bool switch_var_dyn(void);
+extern bool to_csrc(void);
 extern bool unary_op(void);
 // END_SORT_THIS_LINE_MINUS_1
 
@@ -58,6 +60,7 @@ int main(void)
     Run( azmul_op,             "azmul_op"        );
     Run( cexp_op,              "cexp_op"         );
     Run( comp_op,              "comp_op"         );
+    Run( csrc_fun,             "csrc_fun"        );
     Run( div_op,               "div_op"          );
     Run( discrete_op,          "discrete_op"     );
     Run( mul_op,               "mul_op"          );
@@ -66,6 +69,7 @@ int main(void)
     Run( sub_op,               "sub_op"          );
     Run( sum_op,               "sum_op"          );
     Run( switch_var_dyn,       "switch_var_dyn"  );
+    Run( to_csrc,              "to_csrc"         );
     Run( unary_op,             "unary_op"        );
     // END_SORT_THIS_LINE_MINUS_1
 
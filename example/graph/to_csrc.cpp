@@ -0,0 +1,117 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin to_csrc.cpp$$
+$spell
+    csrc
+    dll
+    lib
+$$
+
+$section Convert an ADFun Object to C Source Code: Example and Test$$
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/utility/create_dll_lib.hpp>
+# include <cppad/utility/link_dll_lib.hpp>
+# include <fstream>
+# include <cstdio>
+
+bool to_csrc(void)
+{   bool ok = true;
+    using CppAD::vector;
+    using CppAD::AD;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // f(p, x) = [ p[0] * sin(x[0]) + x[1]       ]
+    //           [ x[0] < x[1] ? x[0] : exp(x[1]) ]
+    size_t np = 1, nx = 2, ny = 2;
+    vector< AD<double> > ap(np), ax(nx), ay(ny);
+    ap[0] = 2.0;
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    size_t abort_op_index = 0;
+    bool   record_compare = false;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+    ay[0] = ap[0] * sin(ax[0]) + ax[1];
+    ay[1] = CppAD::CondExpLt(ax[0], ax[1], ax[0], exp(ax[1]));
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // optimizing creates a conditional skip operator that is not needed
+    // in the C source code
+    f.optimize();
+    //
+    // C source code for f
+    std::string csrc_file = "to_csrc_example.c";
+    std::ofstream os( csrc_file.c_str() );
+    ok &= f.to_csrc(os, "to_csrc_example");
+    os.close();
+    //
+    // create a dynamic link library containing the function
+    std::string dll_file = "to_csrc_example.so";
+    vector<std::string> csrc_files(1);
+    csrc_files[0] = csrc_file;
+    std::map<std::string, std::string> options;
+    std::string err_msg = CppAD::create_dll_lib(dll_file, csrc_files, options);
+    ok &= err_msg == "";
+    if( ! ok )
+        return ok;
+    //
+    // load the library and get a pointer to the function
+    CppAD::link_dll_lib dll_linker("./" + dll_file, err_msg);
+    ok &= err_msg == "";
+    if( ! ok )
+        return ok;
+    void* fun_ptr = dll_linker("to_csrc_example", err_msg);
+    ok &= err_msg == "";
+    if( ! ok )
+        return ok;
+    typedef int (*function_ptr)(size_t, const double*, size_t, double*);
+    function_ptr to_csrc_example = reinterpret_cast<function_ptr>(fun_ptr);
+    //
+    // evaluate the compiled function for both cases of the conditional
+    for(size_t i_case = 0; i_case < 2; ++i_case)
+    {   // dynamic parameters come before variables in x
+        vector<double> p(np), x(nx), px(np + nx), y(ny);
+        p[0] = 3.0;
+        x[0] = 0.25;
+        x[1] = 0.75 - double(i_case);
+        px[0] = p[0];
+        px[1] = x[0];
+        px[2] = x[1];
+        int flag = to_csrc_example(np + nx, px.data(), ny, y.data());
+        ok &= flag == 0;
+        //
+        // check against zero order forward mode
+        f.new_dynamic(p);
+        vector<double> check = f.Forward(0, x);
+        ok &= CppAD::NearEqual(y[0], check[0], eps99, eps99);
+        ok &= CppAD::NearEqual(y[1], check[1], eps99, eps99);
+    }
+    //
+    // check for incorrect sizes
+    vector<double> px(np + nx), y(ny);
+    ok &= to_csrc_example(nx, px.data(), ny, y.data()) == 1;
+    ok &= to_csrc_example(np + nx, px.data(), nx + 1, y.data()) == 2;
+    //
+    // remove the files created by this example
+    std::remove( csrc_file.c_str() );
+    std::remove( dll_file.c_str() );
+    //
+    return ok;
+}
+// END C++
@@ -24,6 +24,7 @@ $end
 */
 // BEGIN C++
 # include <cppad/cppad.hpp>
+# include <sstream>
 
 bool from_json(void)
 {   bool ok = true;
@@ -76,6 +77,15 @@ bool from_json(void)
     ok &= jac[0] == 2.0 * (p[0] + x[0] + x[1]);
     ok &= jac[1] == 2.0 * (p[0] + x[0] + x[1]);
     //
+    // Read the same graph from a stream
+    std::istringstream is(json);
+    CppAD::ADFun<double> fun_is;
+    fun_is.from_json(is);
+    fun_is.new_dynamic(p);
+    vector<double> y_is = fun_is.Forward(0, x);
+    ok &= y_is[0] == y[0];
+    ok &= fun_is.size_op() == fun.size_op();
+    //
     return ok;
 }
 // END C++
@@ -24,6 +24,7 @@ $end
 */
 // BEGIN C++
 # include <cppad/cppad.hpp>
+# include <sstream>
 
 bool to_json(void)
 {   bool ok = true;
@@ -95,6 +96,11 @@ bool to_json(void)
     // should be derivative of f
     ok &= z[0] == x[1];
     ok &= z[1] == x[0] + 2.0 * x[1];
+    // ------------------------------------------------------------------------
+    // Write Json graph to a stream (same as the string version)
+    std::ostringstream os;
+    g.to_json(os);
+    ok &= os.str() == g.to_json();
     //
     return ok;
 }
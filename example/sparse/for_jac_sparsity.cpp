@@ -116,6 +116,51 @@ bool for_jac_sparsity(void)
         ok &= (f.size_forward_set() == 0);
         ok &= (f.size_forward_bool() > 0);
     }
+    //
+    // a larger function: g_i (x) = x_i * x_{i+1}, i = 0, ..., N-2
+    size_t N = 200;
+    CPPAD_TESTVECTOR(AD<double>) aX(N), aY(N - 1);
+    for(size_t j = 0; j < N; j++)
+        aX[j] = 0.;
+    CppAD::Independent(aX);
+    for(size_t i = 0; i < N - 1; i++)
+        aY[i] = aX[i] * aX[i + 1];
+    CppAD::ADFun<double> g(aX, aY);
+    //
+    // sparsity pattern for the N by N identity matrix
+    sparsity identity(N, N, N);
+    for(size_t k = 0; k < N; k++)
+        identity.set(k, k, k);
+    //
+    // Compute the columns of the Jacobian in blocks of 64 columns
+    // (4 blocks) using two threads
+    // (parallel_ad must be called before using more than one thread)
+    CppAD::parallel_ad<double>();
+    transpose         = false;
+    size_t block_bits = 64;
+    size_t n_thread   = 2;
+    g.for_jac_sparsity(
+        identity, transpose, dependency, internal_bool, pattern_out,
+        block_bits, n_thread
+    );
+    nnz  = pattern_out.nnz();
+    ok  &= nnz == 2 * (N - 1);
+    ok  &= pattern_out.nr() == N - 1;
+    ok  &= pattern_out.nc() == N;
+    {   // check results
+        const SizeVector& row( pattern_out.row() );
+        const SizeVector& col( pattern_out.col() );
+        SizeVector row_major = pattern_out.row_major();
+        for(size_t k = 0; k < nnz; k++)
+        {   size_t i = k / 2;
+            ok &= row[ row_major[k] ] == i;
+            ok &= col[ row_major[k] ] == i + k % 2;
+        }
+        //
+        // the sparsity patterns for the variables are not stored
+        ok &= (g.size_forward_set() == 0);
+        ok &= (g.size_forward_bool() == 0);
+    }
     return ok;
 }
 // END C++
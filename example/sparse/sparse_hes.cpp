@@ -105,6 +105,20 @@ bool sparse_hes(void)
     {   ij = row[k] * n + col[k];
         ok &= val[k] == check[ij];
     }
+    //
+    // compute the Hessian using a different thread for each color
+    // (parallel_ad must be called before using more than one thread)
+    CppAD::parallel_ad<double>();
+    size_t n_thread = 2;
+    n_sweep = f.sparse_hes(
+        x, w, subset, hes_pattern, coloring, work, n_thread
+    );
+    ok &= n_sweep == 2;
+    const d_vector val_thread( subset.val() );
+    for(size_t k = 0; k < nnz; k++)
+    {   ij = row[k] * n + col[k];
+        ok &= val_thread[k] == check[ij];
+    }
     return ok;
 }
 // END C++
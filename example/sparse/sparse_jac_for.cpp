@@ -151,6 +151,37 @@ bool sparse_jac_for(void)
     ok &= col_row3[1] == 2;
     ok &= val_row3[1] == x[2];
     //
+    // compute entire Jacobian using a different thread for each color
+    // (parallel_ad must be called before using more than one thread)
+    CppAD::parallel_ad<double>();
+    group_max       = 1;
+    size_t n_thread = 2;
+    work.clear();
+    n_color = f.sparse_jac_for(
+        group_max, x, subset, pattern_jac, coloring, work, n_thread
+    );
+    ok &= n_color == 2;
+    const d_vector val_thread( subset.val() );
+    for(size_t k = 0; k < nnz; k++)
+        ok &= val_thread[ col_major[k] ] == check_val[k];
+    //
+    // compute the Jacobian directly in compressed sparse column format
+    // (col_ptr and row_ind only need to be computed once)
+    s_vector col_ptr, row_ind, csc_order;
+    pattern_jac.get_csc(col_ptr, row_ind, csc_order);
+    d_vector csc_val(nnz);
+    n_color = f.sparse_jac_for(group_max, x,
+        pattern_jac, pattern_jac, coloring, work, "csc", csc_val, n_thread
+    );
+    ok &= n_color == 2;
+    for(size_t j = 0; j < n; j++)
+    {   for(size_t ell = col_ptr[j]; ell < col_ptr[j+1]; ell++)
+        {   ok &= check_col[ell] == j;
+            ok &= check_row[ell] == row_ind[ell];
+            ok &= csc_val[ell]   == check_val[ell];
+        }
+    }
+    //
     return ok;
 }
 // END C++
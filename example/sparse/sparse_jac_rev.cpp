@@ -131,6 +131,46 @@ bool sparse_jac_rev(void)
         ok &= val[ row_major[k] ] == check_val[k];
     }
     //
+    // test computing all the colors in one reverse sweep
+    size_t group_max = 2;
+    n_sweep = f.sparse_jac_rev(
+        group_max, x, subset, pattern_jac, coloring, work
+    );
+    ok &= n_sweep == 2;
+    const d_vector val_group( subset.val() );
+    for(size_t k = 0; k < nnz; k++)
+        ok &= val_group[ row_major[k] ] == check_val[k];
+    //
+    // test computing each color using a different thread
+    // (parallel_ad must be called before using more than one thread)
+    CppAD::parallel_ad<double>();
+    group_max       = 1;
+    size_t n_thread = 2;
+    n_sweep = f.sparse_jac_rev(
+        group_max, x, subset, pattern_jac, coloring, work, n_thread
+    );
+    ok &= n_sweep == 2;
+    const d_vector val_thread( subset.val() );
+    for(size_t k = 0; k < nnz; k++)
+        ok &= val_thread[ row_major[k] ] == check_val[k];
+    //
+    // compute the Jacobian directly in compressed sparse row format
+    // (row_ptr and col_ind only need to be computed once)
+    s_vector row_ptr, col_ind, csr_order;
+    pattern_jac.get_csr(row_ptr, col_ind, csr_order);
+    d_vector csr_val(nnz);
+    n_sweep = f.sparse_jac_rev(group_max, x,
+        pattern_jac, pattern_jac, coloring, work, "csr", csr_val
+    );
+    ok &= n_sweep == 2;
+    for(size_t i = 0; i < m; i++)
+    {   for(size_t ell = row_ptr[i]; ell < row_ptr[i+1]; ell++)
+        {   ok &= check_row[ell] == i;
+            ok &= check_col[ell] == col_ind[ell];
+            ok &= csr_val[ell]   == check_val[ell];
+        }
+    }
+    //
     // compute non-zero in col 3 only, nr = m, nc = n, nnz = 2
     sparse_rc<s_vector> pattern_col3(m, n, 2);
     pattern_col3.set(0, 1, 3);    // row[0] = 1, col[0] = 3
@@ -86,6 +86,39 @@ bool sparse_rc(void)
     {   ok &= target.row()[k] == row[k];
         ok &= target.col()[k] == col[k];
     }
+
+    // change to the sparsity pattern for a 2 by 3 matrix
+    // [ x 0 x ]
+    // [ 0 x x ]
+    pattern.resize(2, 3, 4);
+    pattern.set(0, 1, 2);
+    pattern.set(1, 0, 2);
+    pattern.set(2, 1, 1);
+    pattern.set(3, 0, 0);
+
+    // compressed sparse row format (order is empty so it is computed)
+    SizeVector row_ptr, col_ind, order;
+    pattern.get_csr(row_ptr, col_ind, order);
+    ok &= row_ptr.size() == 3 && col_ind.size() == 4;
+    ok &= row_ptr[0] == 0 && row_ptr[1] == 2 && row_ptr[2] == 4;
+    ok &= col_ind[0] == 0 && col_ind[1] == 2;
+    ok &= col_ind[2] == 1 && col_ind[3] == 2;
+    ok &= order[0] == 3 && order[1] == 1 && order[2] == 2 && order[3] == 0;
+
+    // a second call uses order without sorting again
+    pattern.get_csr(row_ptr, col_ind, order);
+    ok &= col_ind[0] == 0 && col_ind[3] == 2;
+
+    // compressed sparse column format
+    SizeVector col_ptr, row_ind;
+    order.clear();
+    pattern.get_csc(col_ptr, row_ind, order);
+    ok &= col_ptr.size() == 4 && row_ind.size() == 4;
+    ok &= col_ptr[0] == 0 && col_ptr[1] == 1;
+    ok &= col_ptr[2] == 2 && col_ptr[3] == 4;
+    ok &= row_ind[0] == 0 && row_ind[1] == 1;
+    ok &= row_ind[2] == 0 && row_ind[3] == 1;
+
     return ok;
 }
 
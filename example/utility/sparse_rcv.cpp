@@ -91,6 +91,26 @@ bool sparse_rcv(void)
         ok &= target.col()[k] == col[k];
         ok &= target.val()[k] == val[k];
     }
+
+    // compressed sparse row format
+    SizeVector  row_ptr, col_ind, row_major;
+    ValueVector csr_val;
+    matrix.get_csr(row_ptr, col_ind, csr_val, row_major);
+    ok &= row_ptr.size() == nr + 1;
+    for(size_t i = 0; i <= nr; i++)
+        ok &= row_ptr[i] == i;
+    for(size_t k = 0; k < nnz; k++)
+    {   ok &= col_ind[k] == k;
+        ok &= csr_val[k] == double(k);
+    }
+
+    // after changing the values, row_major does not need to be recomputed
+    for(size_t k = 0; k < nnz; k++)
+        matrix.set(nnz - k - 1, double(2 * k));
+    matrix.get_csr(row_ptr, col_ind, csr_val, row_major);
+    for(size_t k = 0; k < nnz; k++)
+        ok &= csr_val[k] == double(2 * k);
+
     return ok;
 }
 
@@ -846,6 +846,7 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
 
     // dimension cskip_op vector to number of operators
     g.cskip_op_.resize( rec.num_op_rec() );
+    g.cskip_op_any_ = true;
 
     // independent variables in g: (x, u)
     size_t s = f_abs_res.size();
@@ -64,6 +64,14 @@ private :
         bool       record_compare ,
         ADVector&  dynamic
     );
+    template <class ADVector, class Base2, class RecBase>
+    friend void Independent(
+        ADVector&                     x              ,
+        size_t                        abort_op_index ,
+        bool                          record_compare ,
+        ADVector&                     dynamic        ,
+        const ADFun<Base2, RecBase>&  hint
+    );
 
     // one argument functions
     friend bool Constant  <Base> (const AD<Base>    &u);
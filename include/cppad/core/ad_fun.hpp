@@ -41,8 +41,12 @@ derivative values, and other values related to the corresponding function.
 $childtable%
     omh/adfun.omh%
     include/cppad/core/optimize.hpp%
+    include/cppad/core/fun_specialize.hpp%
     include/cppad/core/fun_check.hpp%
-    include/cppad/core/check_for_nan.hpp
+    include/cppad/core/check_for_nan.hpp%
+    include/cppad/core/fun_context.hpp%
+    include/cppad/core/graph/to_csrc.hpp%
+    include/cppad/core/csrc_fun.hpp
 %$$
 
 $end
@@ -70,6 +74,10 @@ template <class Base, class RecBase>
 class ADFun {
     // ADFun<Base> must be a friend of ADFun< AD<Base> > for base2ad to work.
     template <class Base2, class RecBase2> friend class ADFun;
+    // fun_context evaluates the operation sequence in this object
+    template <class Base2, class RecBase2> friend class fun_context;
+    // fun_specialize uses the dynamic parameters in this object
+    template <class Base2, class RecBase2> friend class fun_specialize;
 private:
     // ------------------------------------------------------------
     // Private member variables
@@ -133,6 +141,9 @@ private:
     /// Set during forward pass of order zero
     local::pod_vector<bool> cskip_op_;
 
+    /// if false, all the elements of cskip_op_ are false
+    bool cskip_op_any_;
+
     /// Variable on the tape corresponding to each vecad load operation
     /// (if zero, the operation corresponds to a parameter).
     local::pod_vector<addr_t> load_op2var_;
@@ -165,6 +176,62 @@ private:
     template <class ADvector>
     void Dependent(local::ADTape<Base> *tape, const ADvector &y);
 
+    // evaluate the color groups for a sparse Jacobian using multiple threads
+    // (doxygen in cppad/core/sparse_jac.hpp)
+    template <class SizeVector, class ValueDest>
+    void sparse_jac_thread(
+        bool                                 forward   ,
+        size_t                               group_max ,
+        size_t                               n_color   ,
+        size_t                               n_thread  ,
+        const vector<size_t>&                color     ,
+        const vector<size_t>&                order     ,
+        const sparse_rc<SizeVector>&         subset    ,
+        ValueDest&                           dest
+    );
+
+    // sparse Jacobian using forward mode, values stored by dest
+    // (doxygen in cppad/core/sparse_jac.hpp)
+    template <class SizeVector, class BaseVector, class ValueDest>
+    size_t sparse_jac_for_dest(
+        size_t                               group_max ,
+        const BaseVector&                    x         ,
+        const sparse_rc<SizeVector>&         subset    ,
+        const sparse_rc<SizeVector>&         pattern   ,
+        const std::string&                   coloring  ,
+        sparse_jac_work&                     work      ,
+        ValueDest&                           dest      ,
+        size_t                               n_thread
+    );
+
+    // sparse Jacobian using reverse mode, values stored by dest
+    // (doxygen in cppad/core/sparse_jac.hpp)
+    template <class SizeVector, class BaseVector, class ValueDest>
+    size_t sparse_jac_rev_dest(
+        size_t                               group_max ,
+        const BaseVector&                    x         ,
+        const sparse_rc<SizeVector>&         subset    ,
+        const sparse_rc<SizeVector>&         pattern   ,
+        const std::string&                   coloring  ,
+        sparse_jac_work&                     work      ,
+        ValueDest&                           dest      ,
+        size_t                               n_thread
+    );
+
+    // evaluate the colors for a sparse Hessian using multiple threads
+    // (doxygen in cppad/core/sparse_hes.hpp)
+    template <class SizeVector, class BaseVector>
+    void sparse_hes_thread(
+        const BaseVector&                    w         ,
+        size_t                               n_color   ,
+        size_t                               n_thread  ,
+        const vector<size_t>&                row       ,
+        const vector<size_t>&                col       ,
+        const vector<size_t>&                color     ,
+        const vector<size_t>&                order     ,
+        sparse_rcv<SizeVector, BaseVector>&  subset
+    );
+
     // vector of bool version of ForSparseJac
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -309,6 +376,7 @@ public:
 
     // create from Json or C++ AD graph
     void from_json(const std::string& json);
+    void from_json(std::istream& is);
     void from_graph(const cpp_graph& graph_obj);
     void from_graph(
         const cpp_graph&    graph_obj  ,
@@ -318,8 +386,18 @@ public:
 
     // create a Json or C++ AD graph
     std::string to_json(void);
+    void to_json(std::ostream& os);
     void to_graph(cpp_graph& graph_obj);
 
+    // C source code for zero order forward mode
+    // (doxygen in cppad/core/graph/to_csrc.hpp)
+    bool to_csrc(std::ostream& os, const std::string& function_name);
+
+    // binary representation of this function
+    // (doxygen in cppad/core/binary_io.hpp)
+    void to_binary(std::ostream& os) const;
+    void from_binary(std::istream& is);
+
     // create ADFun< AD<Base> > from this ADFun<Base>
     // (doxygen in cppad/core/base2ad.hpp)
     ADFun< AD<Base>, RecBase > base2ad(void) const;
@@ -346,6 +424,10 @@ public:
     template <class BaseVector>
     void new_dynamic(const BaseVector& dynamic);
 
+    /// new_dynamic user API, only some of the dynamic parameters change
+    template <class SizeVector, class BaseVector>
+    void new_dynamic(const SizeVector& changed, const BaseVector& value);
+
     /// forward mode user API, one order multiple directions.
     template <class BaseVector>
     BaseVector Forward(size_t q, size_t r, const BaseVector& x);
@@ -356,10 +438,19 @@ public:
         size_t q, const BaseVector& xq, std::ostream& s = std::cout
     );
 
+    /// zero order forward mode at multiple points
+    /// (doxygen in cppad/core/forward/forward_batch.hpp)
+    template <class BaseVector>
+    BaseVector forward_batch(size_t N, const BaseVector& xN);
+
     /// reverse mode sweep
     template <class BaseVector>
     BaseVector Reverse(size_t p, const BaseVector &v);
 
+    /// reverse mode sweep for multiple weight directions
+    template <class BaseVector>
+    BaseVector Reverse(size_t p, size_t r, const BaseVector &v);
+
     // forward Jacobian sparsity pattern
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -426,17 +517,52 @@ public:
     // (doxygen in cppad/core/sparse_jac.hpp)
     template <class SizeVector, class BaseVector>
     size_t sparse_jac_for(
-        size_t                               group_max ,
-        const BaseVector&                    x         ,
-        sparse_rcv<SizeVector, BaseVector>&  subset    ,
-        const sparse_rc<SizeVector>&         pattern   ,
-        const std::string&                   coloring  ,
-        sparse_jac_work&                     work
+        size_t                               group_max    ,
+        const BaseVector&                    x            ,
+        sparse_rcv<SizeVector, BaseVector>&  subset       ,
+        const sparse_rc<SizeVector>&         pattern      ,
+        const std::string&                   coloring     ,
+        sparse_jac_work&                     work         ,
+        size_t                               n_thread = 1
+    );
+    template <class SizeVector, class BaseVector>
+    size_t sparse_jac_for(
+        size_t                               group_max    ,
+        const BaseVector&                    x            ,
+        const sparse_rc<SizeVector>&         subset       ,
+        const sparse_rc<SizeVector>&         pattern      ,
+        const std::string&                   coloring     ,
+        sparse_jac_work&                     work         ,
+        const std::string&                   layout       ,
+        BaseVector&                          val          ,
+        size_t                               n_thread = 1
     );
 
     // compute sparse Jacobian using reverse mode
     // (doxygen in cppad/core/sparse_jac.hpp)
     template <class SizeVector, class BaseVector>
+    size_t sparse_jac_rev(
+        size_t                               group_max    ,
+        const BaseVector&                    x            ,
+        sparse_rcv<SizeVector, BaseVector>&  subset       ,
+        const sparse_rc<SizeVector>&         pattern      ,
+        const std::string&                   coloring     ,
+        sparse_jac_work&                     work         ,
+        size_t                               n_thread = 1
+    );
+    template <class SizeVector, class BaseVector>
+    size_t sparse_jac_rev(
+        size_t                               group_max    ,
+        const BaseVector&                    x            ,
+        const sparse_rc<SizeVector>&         subset       ,
+        const sparse_rc<SizeVector>&         pattern      ,
+        const std::string&                   coloring     ,
+        sparse_jac_work&                     work         ,
+        const std::string&                   layout       ,
+        BaseVector&                          val          ,
+        size_t                               n_thread = 1
+    );
+    template <class SizeVector, class BaseVector>
     size_t sparse_jac_rev(
         const BaseVector&                    x        ,
         sparse_rcv<SizeVector, BaseVector>&  subset   ,
@@ -449,12 +575,13 @@ public:
     // (doxygen in cppad/core/sparse_hes.hpp)
     template <class SizeVector, class BaseVector>
     size_t sparse_hes(
-        const BaseVector&                    x        ,
-        const BaseVector&                    w        ,
-        sparse_rcv<SizeVector, BaseVector>&  subset   ,
-        const sparse_rc<SizeVector>&         pattern  ,
-        const std::string&                   coloring ,
-        sparse_hes_work&                     work
+        const BaseVector&                    x            ,
+        const BaseVector&                    w            ,
+        sparse_rcv<SizeVector, BaseVector>&  subset       ,
+        const sparse_rc<SizeVector>&         pattern      ,
+        const std::string&                   coloring     ,
+        sparse_hes_work&                     work         ,
+        size_t                               n_thread = 1
     );
 
     // compute sparsity pattern using subgraphs
@@ -476,7 +603,9 @@ public:
         bool                         transpose        ,
         bool                         dependency       ,
         bool                         internal_bool    ,
-        sparse_rc<SizeVector>&       pattern_out
+        sparse_rc<SizeVector>&       pattern_out      ,
+        size_t                       block_bits = 0   ,
+        size_t                       n_thread   = 1
     );
 
     // reverse mode Jacobian sparsity pattern
@@ -627,6 +756,18 @@ public:
     size_t size_dyn_arg(void) const
     {   return play_.num_dynamic_arg(); }
 
+    /// number of constant parameters put in the recording
+    size_t size_con_par_put(void) const
+    {   return play_.num_con_par_put(); }
+
+    /// number of slots examined in the constant parameter hash table
+    size_t size_con_par_probe(void) const
+    {   return play_.num_con_par_probe(); }
+
+    /// number of slots in the constant parameter hash table
+    size_t size_con_par_slot(void) const
+    {   return play_.num_con_par_slot(); }
+
     /// number taylor coefficient orders calculated
     size_t size_order(void) const
     {   return num_order_taylor_; }
@@ -643,6 +784,34 @@ public:
     size_t size_var(void) const
     {   return num_var_tape_; }
 
+    /// number of bytes in the indices used by the pre-decoded operations
+    /// (zero if not prepared)
+    size_t size_fast_index(void) const
+    {   if( play_.fast_vec().size() == 0 )
+            return 0;
+        switch( play_.fast_addr() )
+        {   case local::play::unsigned_short_enum:
+            return sizeof(unsigned short);
+
+            case local::play::unsigned_int_enum:
+            return sizeof(unsigned int);
+
+            default:
+            break;
+        }
+        return sizeof(size_t);
+    }
+
+    /// number of slots used by forward_slot (zero if not prepared)
+    size_t size_slot(void) const
+    {   return play_.num_slot(); }
+
+    /// number of levels used by forward_level (zero if not prepared)
+    size_t size_level(void) const
+    {   size_t n_start = play_.level_start().size();
+        return n_start == 0 ? 0 : n_start - 1;
+    }
+
     /// number of VecAD indices in the operation sequence
     size_t size_VecAD(void) const
     {   return play_.num_var_vecad_ind_rec(); }
@@ -732,6 +901,18 @@ public:
         const SizeVector_t &I ,
         const SizeVector_t &J );
 
+    /// Hessian of a weighted sum of range components times vectors
+    /// (doxygen in cppad/core/hes_vec.hpp)
+    template <class BaseVector>
+    BaseVector hes_vec(
+        const BaseVector& x ,
+        const BaseVector& w ,
+        const BaseVector& v );
+    template <class BaseVector>
+    BaseVector hes_vec(
+        const BaseVector& w ,
+        const BaseVector& v );
+
     /// calculate sparse Jacobians
     template <class BaseVector>
     BaseVector SparseJacobian(
@@ -788,6 +969,40 @@ public:
     // (see doxygen documentation in optimize.hpp)
     void optimize( const std::string& options = "" );
 
+    // pre-decode the tape for zero order forward and reverse mode
+    // (see doxygen documentation in fast_eval.hpp)
+    bool prepare_fast_eval(void);
+
+    // assign the variables to re-usable slots for forward_slot
+    // (see doxygen documentation in slot_eval.hpp)
+    bool prepare_slot_eval(void);
+
+    // zero order forward mode using the slots
+    template <class BaseVector>
+    BaseVector forward_slot(const BaseVector& x);
+
+    // determine the users of each variable for forward_update
+    // (see doxygen documentation in update_eval.hpp)
+    bool prepare_update_eval(void);
+
+    // zero order forward mode when only some of the arguments change
+    template <class SizeVector, class BaseVector>
+    BaseVector forward_update(
+        const SizeVector& changed, const BaseVector& value
+    );
+
+    // divide the operations into levels for forward_level and reverse_level
+    // (see doxygen documentation in level_eval.hpp)
+    bool prepare_level_eval(void);
+
+    // zero order forward mode using multiple threads
+    template <class BaseVector>
+    BaseVector forward_level(const BaseVector& x, size_t n_thread);
+
+    // first order reverse mode using multiple threads
+    template <class BaseVector>
+    BaseVector reverse_level(const BaseVector& w, size_t n_thread);
+
     // create abs-normal representation of the function f(x)
     void abs_normal_fun( ADFun& g, ADFun& a ) const;
 
@@ -848,7 +1063,13 @@ public:
 # include <cppad/local/sweep/forward0.hpp>
 # include <cppad/local/sweep/forward1.hpp>
 # include <cppad/local/sweep/forward2.hpp>
+# include <cppad/local/sweep/forward0_batch.hpp>
+# include <cppad/local/sweep/fast_eval.hpp>
+# include <cppad/local/sweep/slot_eval.hpp>
+# include <cppad/local/sweep/update_eval.hpp>
+# include <cppad/local/sweep/level_eval.hpp>
 # include <cppad/local/sweep/reverse.hpp>
+# include <cppad/local/sweep/reverse_dir.hpp>
 # include <cppad/local/sweep/for_jac.hpp>
 # include <cppad/local/sweep/rev_jac.hpp>
 # include <cppad/local/sweep/rev_hes.hpp>
@@ -871,5 +1092,9 @@ public:
 # include <cppad/core/abs_normal_fun.hpp>
 # include <cppad/core/graph/from_json.hpp>
 # include <cppad/core/graph/to_json.hpp>
+# include <cppad/core/graph/to_csrc.hpp>
+# include <cppad/core/binary_io.hpp>
+# include <cppad/core/fun_context.hpp>
+# include <cppad/core/fun_specialize.hpp>
 
 # endif
@@ -80,6 +80,7 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     // bool values
     fun.has_been_optimized_        = has_been_optimized_;
     fun.check_for_nan_             = check_for_nan_;
+    fun.cskip_op_any_              = cskip_op_any_;
     //
     // size_t values
     fun.compare_change_count_      = compare_change_count_;
@@ -33,6 +33,12 @@ $codei%AD<%Base%>%$$ operations.
 A hashing function is used to reduce number of values stored in this table;
 for example, it is not necessary to store the value 3.0 every
 time it is used as a $cref/parameter/con_dyn_var/Parameter/$$.
+(For some $icode Base$$ types, the recording uses a hash code with more
+values; see
+$cref/constant parameter hash table
+    /seq_property
+    /Constant Parameter Hash Table
+/$$.)
 
 $head Default$$
 The default hashing function works with the set of bits that correspond
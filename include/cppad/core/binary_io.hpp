@@ -0,0 +1,287 @@
+# ifndef CPPAD_CORE_BINARY_IO_HPP
+# define CPPAD_CORE_BINARY_IO_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/binary_io.hpp>
+
+/*
+------------------------------------------------------------------------------
+$begin binary_io$$
+$spell
+    os
+    const
+    std
+    ostream
+    istream
+    json
+    bool
+    sizeof
+    addr_t
+    discrete
+    VecAD
+$$
+
+$section Binary Representation of an ADFun Object$$
+
+$head Syntax$$
+$icode%fun%.to_binary(%os%)
+%$$
+$icode%fun%.from_binary(%is%)
+%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_TO_BINARY%// END_TO_BINARY%1
+%$$
+$srcthisfile%
+    0%// BEGIN_FROM_BINARY%// END_FROM_BINARY%1
+%$$
+
+$head Purpose$$
+The $cref json_ad_graph$$ and $cref cpp_ad_graph$$ representations
+of a function are portable, but converting to and from them
+requires parsing and re-recording the operation sequence.
+In addition, the operation sequence may be different after
+such a conversion; e.g., it may need to be optimized again.
+The binary representation is the memory for the operation sequence in
+$icode fun$$; i.e., the operators, their arguments,
+the parameters, the dynamic parameter operators, the strings used by
+$cref PrintFor$$ operations, and the $cref VecAD$$ vectors.
+Each of these vectors is written and read as one block of memory,
+so a function can be recorded (and optimized) once and then loaded
+quickly by other programs.
+
+$head fun$$
+is the $cref/ADFun/adfun/$$ object.
+It is $code const$$ for $code to_binary$$.
+For $code from_binary$$,
+upon return it contains the operation sequence that was read
+and its other properties are the same as after a call to $cref Dependent$$.
+In particular, it does not contain any
+$cref/Taylor coefficients/size_order/$$.
+
+$head Base$$
+is the type corresponding to this $cref/ADFun/adfun/$$ object;
+i.e., its calculations are done using the type $icode Base$$.
+It must be plain old data; e.g., $code float$$ or $code double$$.
+
+$head RecBase$$
+in the prototype above, $icode RecBase$$ is the same type as $icode Base$$.
+
+$head os$$
+The binary representation of $icode fun$$ is written to this stream.
+It should be opened in binary mode; e.g.,
+$codei%
+    std::ofstream %os%(%file_name%, std::ios::binary)
+%$$
+
+$head is$$
+The binary representation of $icode fun$$ is read from this stream.
+It should be opened in binary mode; e.g.,
+$codei%
+    std::ifstream %is%(%file_name%, std::ios::binary)
+%$$
+
+$head Format$$
+The binary representation uses the native byte order and sizes
+for the machine.
+It starts with a header that identifies the format and its version,
+the byte order, $code sizeof(size_t)$$,
+the size of the tape address type
+$cref/addr_t/cmake/cppad_tape_addr_type/$$,
+the size of the operator code type,
+$codei%sizeof(%Base%)%$$, and the number of operator codes.
+The $code bool$$ values are stored as bytes that are zero or one.
+If the header read by $code from_binary$$ is different from the one that
+$code to_binary$$ would write using the current program,
+an error is generated.
+
+$head Errors$$
+The input to $code from_binary$$ comes from outside the program.
+For this reason, its errors are reported using the $cref ErrorHandler$$
+even when $code NDEBUG$$ is defined; e.g.,
+an input that is not a CppAD binary representation, an input that ends
+before the operation sequence is complete,
+vector lengths that are not consistent,
+a $code bool$$ value that is not zero or one,
+or an index that is out of range.
+The length of each vector is checked against the rest of the input
+before its memory is allocated.
+Each operator argument is checked to be less than the number of
+parameters, or less than the index of the operator's first result
+variable, depending on the argument type.
+Each parameter argument to a dynamic parameter operator is checked to be
+less than the index of the dynamic parameter it computes.
+The $cref atomic$$ and $cref discrete$$ function indices are checked
+against the number of such functions in the program reading the input.
+If the error handler returns, $icode fun$$ is not changed by the call.
+
+$head Restrictions$$
+The $cref atomic$$ and $cref discrete$$ functions are identified by
+an index that is specific to a program.
+If $icode fun$$ uses such functions, the program that reads the binary
+representation must create the same functions, in the same order,
+as the program that wrote it.
+
+$children%
+    example/general/binary_io.cpp
+%$$
+$head Example$$
+The file $cref binary_io.cpp$$ is an example and test of this operation.
+
+$end
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file core/binary_io.hpp
+Write and read the binary representation of an ADFun object.
+*/
+
+/*!
+Write the binary representation of this function.
+
+\param os
+is the stream that the binary representation is written to.
+*/
+// BEGIN_TO_BINARY
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::to_binary(std::ostream& os) const
+// END_TO_BINARY
+{   CPPAD_ASSERT_KNOWN( local::is_pod<Base>(),
+        "to_binary: Base is not plain old data"
+    );
+    CPPAD_ASSERT_KNOWN( num_var_tape_ > 0,
+        "to_binary: this function does not have an operation sequence"
+    );
+    local::pod_vector<char> name( function_name_.size() );
+    for(size_t i = 0; i < function_name_.size(); ++i)
+        name[i] = function_name_[i];
+    //
+    local::binary_header_write<Base>(os);
+    local::binary_write_vec(os, name);
+    local::binary_write_bool(os, has_been_optimized_);
+    local::binary_write_vec(os, ind_taddr_);
+    local::binary_write_vec(os, dep_taddr_);
+    local::binary_write_vec_bool(os, dep_parameter_);
+    play_.write_binary(os);
+    //
+    CPPAD_ASSERT_KNOWN( os.good(),
+        "to_binary: error while writing to the output stream"
+    );
+}
+
+/*!
+Read the binary representation of a function into this object.
+
+\param is
+is the stream that the binary representation is read from.
+It must have been written by to_binary.
+*/
+// BEGIN_FROM_BINARY
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::from_binary(std::istream& is)
+// END_FROM_BINARY
+{   CPPAD_ASSERT_KNOWN( local::is_pod<Base>(),
+        "from_binary: Base is not plain old data"
+    );
+    // Read into temporaries so that this object does not change when
+    // there is an error in the input. The errors are reported using
+    // ErrorHandler::Call because they do not depend on this program.
+    if( ! local::binary_header_read<Base>(is) )
+        return;
+    local::pod_vector<char>   name;
+    bool                      has_been_optimized;
+    local::pod_vector<size_t> ind_taddr, dep_taddr;
+    local::pod_vector<bool>   dep_parameter;
+    bool ok = local::binary_read_vec(is, name);
+    ok = ok && local::binary_read_bool(is, has_been_optimized);
+    ok = ok && local::binary_read_vec(is, ind_taddr);
+    ok = ok && local::binary_read_vec(is, dep_taddr);
+    ok = ok && local::binary_read_vec_bool(is, dep_parameter);
+    if( ! ok )
+        return;
+    //
+    const char* msg = "from_binary: input is not a valid operation sequence";
+    if( dep_taddr.size() != dep_parameter.size() )
+    {   local::binary_error(msg);
+        return;
+    }
+    local::player<Base> play;
+    if( ! play.read_binary(is, ind_taddr.size() ) )
+        return;
+    //
+    // independent variables are the InvOp operators that follow BeginOp
+    // (read_binary checked that these operators are InvOp)
+    size_t num_var = play.num_var_rec();
+    for(size_t j = 0; j < ind_taddr.size(); ++j)
+    {   if( ind_taddr[j] != j + 1 )
+        {   local::binary_error(msg);
+            return;
+        }
+    }
+    for(size_t i = 0; i < dep_taddr.size(); ++i)
+    {   if( dep_taddr[i] >= num_var )
+        {   local::binary_error(msg);
+            return;
+        }
+    }
+    //
+    // function_name_
+    function_name_.clear();
+    if( name.size() > 0 )
+        function_name_ = std::string( name.data(), name.size() );
+    //
+    // has_been_optimized_, ind_taddr_, dep_taddr_, dep_parameter_, play_
+    has_been_optimized_ = has_been_optimized;
+    ind_taddr_.swap(ind_taddr);
+    dep_taddr_.swap(dep_taddr);
+    dep_parameter_.swap(dep_parameter);
+    play_.swap(play);
+    //
+    // bool values in this object except check_for_nan_
+    base2ad_return_value_      = false;
+    //
+    // size_t values in this object
+    compare_change_count_      = 1;
+    compare_change_number_     = 0;
+    compare_change_op_index_   = 0;
+    num_order_taylor_          = 0;
+    cap_order_taylor_          = 0;
+    num_direction_taylor_      = 0;
+    num_var_tape_              = play_.num_var_rec();
+    //
+    // taylor_
+    taylor_.resize(0);
+    //
+    // cskip_op_ (elements are not initialized)
+    cskip_op_.resize( play_.num_op_rec() );
+    cskip_op_any_ = true;
+    //
+    // load_op2var_
+    load_op2var_.resize( play_.num_var_load_rec() );
+    //
+    // for_jac_sparse_pack_, for_jac_sparse_set_
+    for_jac_sparse_pack_.resize(0, 0);
+    for_jac_sparse_set_.resize(0,0);
+    //
+    // resize subgraph_info_
+    subgraph_info_.resize(
+        ind_taddr_.size(),   // n_dep
+        dep_taddr_.size(),   // n_ind
+        play_.num_op_rec(),  // n_op
+        play_.num_var_rec()  // n_var
+    );
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,499 @@
+# ifndef CPPAD_CORE_CSRC_FUN_HPP
+# define CPPAD_CORE_CSRC_FUN_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin csrc_fun$$
+$spell
+    csrc
+    cppad
+    hpp
+    dll
+    lib
+    const
+    jac
+    rc
+    val
+    nnz
+    std
+    fun
+    ok
+    NDEBUG
+    xq
+    dw
+$$
+
+$section Compiled C Source Code Version of an ADFun Object$$
+
+$head Syntax$$
+$codei%# include <cppad/cppad.hpp>
+# include <cppad/core/csrc_fun.hpp>
+%$$
+$codei%csrc_fun %cfun%(%file_prefix%, %f%, %x%, %options%)
+%$$
+$icode%n% = %cfun%.Domain()
+%$$
+$icode%m% = %cfun%.Range()
+%$$
+$icode%y% = %cfun%.Forward(0, %x%)
+%$$
+$icode%dw% = %cfun%.Reverse(1, %w%)
+%$$
+$icode%pattern% = %cfun%.jac_pattern()
+%$$
+$icode%cfun%.sparse_jac(%x%, %val%)%$$
+
+$head Purpose$$
+Uses $cref to_csrc$$ to create C source code for zero order forward mode,
+first order reverse mode, and a sparse Jacobian of a function,
+compiles the source into a dynamic link library using $cref create_dll_lib$$,
+and loads the library using $cref link_dll_lib$$.
+The derivatives are converted to source code by recording them
+as functions using $cref base2ad$$ and then $cref optimize$$.
+The program must be linked with the $code cppad_lib$$ library
+which in turn uses the system library for dynamic linking.
+This header is not included by $code cppad/cppad.hpp$$
+and it must be included after $code cppad/cppad.hpp$$.
+
+$head file_prefix$$
+This $code const std::string&$$ is the prefix for the files that
+are created. The C source files are
+$icode%file_prefix%_forward_zero.c%$$,
+$icode%file_prefix%_reverse_one.c%$$, and
+$icode%file_prefix%_sparse_jac.c%$$
+(only the files for the requested $icode options$$ are created).
+The dynamic link library is $icode%file_prefix%.so%$$
+($icode%file_prefix%.dll%$$ on Windows).
+If the prefix does not contain the $code /$$ character,
+the files are in the current working directory.
+The C source files are removed once the library is created
+and the library is removed when $icode cfun$$ is destroyed,
+unless $icode options$$ contains $code keep_files$$.
+
+$head f$$
+This $code ADFun<double>&$$ object is the function that is converted.
+It must not have any $cref/dynamic parameters/Independent/dynamic/$$
+and it must satisfy the $cref/to_csrc/to_csrc/Restrictions/$$ restrictions.
+It is not $code const$$ because its Jacobian sparsity pattern is computed
+when $icode options$$ contains $code sparse_jac$$.
+
+$head x$$
+The derivatives of $icode f$$ are recorded using the
+argument value $icode x$$ which has size $icode%f%.Domain()%$$.
+The function and its derivatives must not be $code nan$$ at this point.
+Other than that, the source code does not depend on $icode x$$
+(because comparison operators are not included).
+
+$head options$$
+This $code const std::string&$$ is a space separated list of the
+derivatives that are included
+(zero order forward mode is always included):
+
+$subhead reverse_one$$
+If this word is present, $icode%cfun%.Reverse%$$ can be used.
+
+$subhead sparse_jac$$
+If this word is present, $icode%cfun%.jac_pattern%$$ and
+$icode%cfun%.sparse_jac%$$ can be used.
+
+$subhead keep_files$$
+If this word is present, the C source files and the library
+are not removed; see $icode file_prefix$$.
+
+$head cfun$$
+This object cannot be copied.
+If the source code cannot be created, compiled, or loaded,
+an error is reported using $cref ErrorHandler$$
+(even when $code NDEBUG$$ is defined)
+and the constructor returns without creating the functions.
+The dynamic link library is unloaded when it is destroyed.
+Its memory is not allocated using $cref thread_alloc$$,
+so it can be a static object that is still in use when
+$cref/free_all/ta_free_all/$$ is called.
+
+$head Vector$$
+In the syntax above, the vectors $icode x$$, $icode y$$,
+$icode w$$, $icode dw$$, and $icode val$$ have the same type
+$icode Vector$$ which is a $cref SimpleVector$$ with elements of type
+$code double$$.
+
+$head Domain$$
+The return value $icode n$$ is the domain space dimension for $icode f$$.
+
+$head Range$$
+The return value $icode m$$ is the range space dimension for $icode f$$.
+
+$head Forward$$
+The vector $icode x$$ has size $icode n$$
+and the return value $icode y$$ has size $icode m$$.
+It is the value of the function $latex f(x)$$.
+The value of $icode x$$ is also stored in $icode cfun$$ for use by
+$icode%cfun%.Reverse%$$.
+
+$head Reverse$$
+The vector $icode w$$ has size $icode m$$
+and the return value $icode dw$$ has size $icode n$$.
+It is the value of $latex w^\R{T} f^{(1)} (x)$$
+where $icode x$$ is the value in the previous call to
+$icode%cfun%.Forward%$$.
+
+$head jac_pattern$$
+The return value $icode pattern$$ has prototype
+$codei%
+    const sparse_rc< std::vector<size_t> >& %pattern%
+%$$
+It is the sparsity pattern for the Jacobian of $icode f$$.
+
+$head sparse_jac$$
+The vector $icode x$$ has size $icode n$$
+and $icode val$$ has size $icode%pattern%.nnz()%$$.
+The input value of the elements of $icode val$$ does not matter.
+Upon return, for $icode%k% = 0 , %...% , %pattern%.nnz()-1%$$,
+$icode%val%[%k%]%$$ is the value of the partial of
+component $icode%pattern%.row()[%k%]%$$ of $latex f(x)$$ with respect to
+component $icode%pattern%.col()[%k%]%$$ of $latex x$$.
+
+$children%
+    example/graph/csrc_fun.cpp
+%$$
+$head Example$$
+The file $cref csrc_fun.cpp$$ is an example and test of this class.
+
+$end
+*/
+# include <cstdio>
+# include <fstream>
+# include <map>
+# include <string>
+# include <vector>
+# include <cppad/utility/sparse_rc.hpp>
+# include <cppad/utility/sparse_rcv.hpp>
+# include <cppad/utility/create_dll_lib.hpp>
+# include <cppad/utility/link_dll_lib.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+class csrc_fun {
+private:
+    // type of the functions created by to_csrc
+    typedef int (*function_ptr)(size_t, const double*, size_t, double*);
+    //
+    // domain and range dimensions
+    size_t n_, m_;
+    //
+    // the dynamic link library
+    link_dll_lib* dll_linker_;
+    //
+    // file name for the library, empty if it is not removed by destructor
+    std::string remove_dll_file_;
+    //
+    // functions in the library (null if not requested)
+    function_ptr forward_zero_;
+    function_ptr reverse_one_;
+    function_ptr sparse_jac_;
+    //
+    // Jacobian sparsity pattern
+    sparse_rc< std::vector<size_t> > jac_pattern_;
+    //
+    // argument for the functions: x followed by w (w only for reverse_one_)
+    std::vector<double> xw_;
+    //
+    // result buffer used to avoid allocating for each call
+    std::vector<double> result_;
+    //
+    // not implemented
+    csrc_fun(const csrc_fun&);
+    csrc_fun& operator=(const csrc_fun&);
+    //
+    // report an error detected while creating the library
+    static void report_error(const std::string& msg)
+    {   bool known       = true;
+        int  line        = __LINE__;
+        const char* file = __FILE__;
+        const char* exp  = "err_msg == \"\"";
+        ErrorHandler::Call( known, line, file, exp, msg.c_str() );
+    }
+    //
+    // write the C source code for a function to a file
+    // (returns false if an error is reported)
+    static bool write_csrc(
+        ADFun<double>&     g             ,
+        const std::string& csrc_file     ,
+        const std::string& function_name )
+    {   std::ofstream os( csrc_file.c_str() );
+        if( ! os )
+        {   report_error("csrc_fun: cannot open " + csrc_file);
+            return false;
+        }
+        return g.to_csrc(os, function_name);
+    }
+    //
+    // remove a list of files
+    static void remove_files(const vector<std::string>& file_list)
+    {   for(size_t i = 0; i < file_list.size(); ++i)
+            std::remove( file_list[i].c_str() );
+    }
+    //
+    // call one of the functions in the library with x = xw_[0:nx-1]
+    void call(function_ptr fun, size_t nx, size_t ny)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < nx && nx <= xw_.size() );
+        result_.resize(ny);
+        double* y = CPPAD_NULL;
+        if( ny > 0 )
+            y = &result_[0];
+        int flag = fun(nx, &xw_[0], ny, y);
+        if( flag != 0 )
+            report_error("csrc_fun: C function has wrong nx or ny");
+    }
+public:
+    // constructor
+    template <class Vector>
+    csrc_fun(
+        const std::string& file_prefix ,
+        ADFun<double>&     f           ,
+        const Vector&      x           ,
+        const std::string& options     )
+    : n_( f.Domain() )
+    , m_( f.Range() )
+    , dll_linker_(CPPAD_NULL)
+    , forward_zero_(CPPAD_NULL)
+    , reverse_one_(CPPAD_NULL)
+    , sparse_jac_(CPPAD_NULL)
+    , xw_(n_ + m_)
+    {   CheckSimpleVector<double, Vector>();
+        CPPAD_ASSERT_KNOWN( f.size_dyn_ind() == 0,
+            "csrc_fun: f has dynamic parameters"
+        );
+        CPPAD_ASSERT_KNOWN( size_t( x.size() ) == n_,
+            "csrc_fun: size of x not equal f.Domain()"
+        );
+        bool reverse_one = options.find("reverse_one") != std::string::npos;
+        bool sparse_jac  = options.find("sparse_jac")  != std::string::npos;
+        bool keep_files  = options.find("keep_files")  != std::string::npos;
+        //
+        vector<std::string> csrc_files(1);
+        csrc_files[0] = file_prefix + "_forward_zero.c";
+        if( ! write_csrc(f, csrc_files[0], "csrc_forward_zero") )
+        {   remove_files(csrc_files);
+            return;
+        }
+        //
+        // recording of f that can be used to record its derivatives
+        ADFun< AD<double>, double > af;
+        if( reverse_one || sparse_jac )
+            af = f.base2ad();
+        //
+        if( reverse_one )
+        {   // h(x, w) = w^T f'(x)
+            vector< AD<double> > axw(n_ + m_), ax(n_), aw(m_), adw(n_);
+            for(size_t j = 0; j < n_; ++j)
+                axw[j] = x[j];
+            for(size_t i = 0; i < m_; ++i)
+                axw[n_ + i] = 1.0;
+            Independent(axw);
+            for(size_t j = 0; j < n_; ++j)
+                ax[j] = axw[j];
+            for(size_t i = 0; i < m_; ++i)
+                aw[i] = axw[n_ + i];
+            af.Forward(0, ax);
+            adw = af.Reverse(1, aw);
+            ADFun<double> h(axw, adw);
+            h.optimize();
+            //
+            std::string csrc_file = file_prefix + "_reverse_one.c";
+            csrc_files.push_back(csrc_file);
+            if( ! write_csrc(h, csrc_file, "csrc_reverse_one") )
+            {   remove_files(csrc_files);
+                return;
+            }
+        }
+        if( sparse_jac )
+        {   // sparsity pattern for the Jacobian of f
+            sparse_rc< std::vector<size_t> > identity(n_, n_, n_);
+            for(size_t k = 0; k < n_; ++k)
+                identity.set(k, k, k);
+            bool transpose     = false;
+            bool dependency    = false;
+            bool internal_bool = false;
+            f.for_jac_sparsity(
+                identity, transpose, dependency, internal_bool, jac_pattern_
+            );
+            //
+            // g(x) = non-zero elements of f'(x)
+            vector< AD<double> > ax(n_);
+            for(size_t j = 0; j < n_; ++j)
+                ax[j] = x[j];
+            Independent(ax);
+            sparse_rcv< std::vector<size_t>, vector< AD<double> > >
+                subset( jac_pattern_ );
+            sparse_jac_work work;
+            std::string coloring = "cppad";
+            size_t      group_max = 1;
+            if( n_ <= m_ ) af.sparse_jac_for(
+                group_max, ax, subset, jac_pattern_, coloring, work
+            );
+            else af.sparse_jac_rev(
+                ax, subset, jac_pattern_, coloring, work
+            );
+            ADFun<double> g(ax, subset.val());
+            g.optimize();
+            //
+            std::string csrc_file = file_prefix + "_sparse_jac.c";
+            csrc_files.push_back(csrc_file);
+            if( ! write_csrc(g, csrc_file, "csrc_sparse_jac") )
+            {   remove_files(csrc_files);
+                return;
+            }
+        }
+        //
+        // create the library
+# ifdef _WIN32
+        std::string dll_file = file_prefix + ".dll";
+# else
+        std::string dll_file = file_prefix + ".so";
+# endif
+        std::map<std::string, std::string> dll_options;
+        std::string err_msg = create_dll_lib(dll_file, csrc_files, dll_options);
+        if( ! keep_files )
+            remove_files(csrc_files);
+        if( err_msg != "" )
+        {   report_error(err_msg);
+            return;
+        }
+        if( ! keep_files )
+            remove_dll_file_ = dll_file;
+        //
+        // load the library
+        if( dll_file.find('/') == std::string::npos )
+            dll_file = "./" + dll_file;
+        dll_linker_ = new link_dll_lib(dll_file, err_msg);
+        if( err_msg != "" )
+        {   report_error(err_msg);
+            return;
+        }
+        //
+        // get the functions
+        void* fun_ptr = (*dll_linker_)("csrc_forward_zero", err_msg);
+        if( err_msg != "" )
+        {   report_error(err_msg);
+            return;
+        }
+        forward_zero_ = reinterpret_cast<function_ptr>(fun_ptr);
+        if( reverse_one )
+        {   fun_ptr = (*dll_linker_)("csrc_reverse_one", err_msg);
+            if( err_msg != "" )
+            {   report_error(err_msg);
+                return;
+            }
+            reverse_one_ = reinterpret_cast<function_ptr>(fun_ptr);
+        }
+        if( sparse_jac )
+        {   fun_ptr = (*dll_linker_)("csrc_sparse_jac", err_msg);
+            if( err_msg != "" )
+            {   report_error(err_msg);
+                return;
+            }
+            sparse_jac_ = reinterpret_cast<function_ptr>(fun_ptr);
+        }
+    }
+    // destructor
+    ~csrc_fun(void)
+    {   delete dll_linker_;
+        if( remove_dll_file_ != "" )
+            std::remove( remove_dll_file_.c_str() );
+    }
+    //
+    // Domain
+    size_t Domain(void) const
+    {   return n_; }
+    //
+    // Range
+    size_t Range(void) const
+    {   return m_; }
+    //
+    // jac_pattern
+    const sparse_rc< std::vector<size_t> >& jac_pattern(void) const
+    {   CPPAD_ASSERT_KNOWN( sparse_jac_ != CPPAD_NULL,
+            "csrc_fun: options did not include sparse_jac"
+        );
+        return jac_pattern_;
+    }
+    //
+    // Forward
+    template <class Vector>
+    Vector Forward(size_t q, const Vector& x)
+    {   CheckSimpleVector<double, Vector>();
+        CPPAD_ASSERT_KNOWN( q == 0,
+            "csrc_fun: Forward: order q is not zero"
+        );
+        CPPAD_ASSERT_KNOWN( forward_zero_ != CPPAD_NULL,
+            "csrc_fun: Forward: the constructor failed"
+        );
+        CPPAD_ASSERT_KNOWN( size_t( x.size() ) == n_,
+            "csrc_fun: Forward: size of x not equal Domain()"
+        );
+        for(size_t j = 0; j < n_; ++j)
+            xw_[j] = x[j];
+        call(forward_zero_, n_, m_);
+        Vector y(m_);
+        for(size_t i = 0; i < m_; ++i)
+            y[i] = result_[i];
+        return y;
+    }
+    //
+    // Reverse
+    template <class Vector>
+    Vector Reverse(size_t q, const Vector& w)
+    {   CheckSimpleVector<double, Vector>();
+        CPPAD_ASSERT_KNOWN( q == 1,
+            "csrc_fun: Reverse: order q is not one"
+        );
+        CPPAD_ASSERT_KNOWN( reverse_one_ != CPPAD_NULL,
+            "csrc_fun: options did not include reverse_one"
+        );
+        CPPAD_ASSERT_KNOWN( size_t( w.size() ) == m_,
+            "csrc_fun: Reverse: size of w not equal Range()"
+        );
+        for(size_t i = 0; i < m_; ++i)
+            xw_[n_ + i] = w[i];
+        call(reverse_one_, n_ + m_, n_);
+        Vector dw(n_);
+        for(size_t j = 0; j < n_; ++j)
+            dw[j] = result_[j];
+        return dw;
+    }
+    //
+    // sparse_jac
+    template <class Vector>
+    void sparse_jac(const Vector& x, Vector& val)
+    {   CheckSimpleVector<double, Vector>();
+        CPPAD_ASSERT_KNOWN( sparse_jac_ != CPPAD_NULL,
+            "csrc_fun: options did not include sparse_jac"
+        );
+        CPPAD_ASSERT_KNOWN( size_t( x.size() ) == n_,
+            "csrc_fun: sparse_jac: size of x not equal Domain()"
+        );
+        size_t nnz = jac_pattern_.nnz();
+        CPPAD_ASSERT_KNOWN( size_t( val.size() ) == nnz,
+            "csrc_fun: sparse_jac: size of val not equal pattern.nnz()"
+        );
+        for(size_t j = 0; j < n_; ++j)
+            xw_[j] = x[j];
+        call(sparse_jac_, n_, nnz);
+        for(size_t k = 0; k < nnz; ++k)
+            val[k] = result_[k];
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -283,8 +283,9 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
     // taylor_
     taylor_.resize(0);
 
-    // cskip_op_
+    // cskip_op_ (elements are not initialized)
     cskip_op_.resize( tape->Rec_.num_op_rec() );
+    cskip_op_any_ = true;
 
     // load_op2var_
     load_op2var_.resize( tape->Rec_.num_var_load_rec() );
@@ -18,5 +18,6 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/core/rev_one.hpp>
 # include <cppad/core/for_two.hpp>
 # include <cppad/core/rev_two.hpp>
+# include <cppad/core/hes_vec.hpp>
 
 # endif
@@ -0,0 +1,128 @@
+# ifndef CPPAD_CORE_FAST_EVAL_HPP
+# define CPPAD_CORE_FAST_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin prepare_fast_eval$$
+$spell
+    bool
+    sizeof
+    VecAD
+    PrintFor
+    const
+$$
+
+$section Pre-Decode an Operation Sequence for Faster Evaluation$$
+
+$head Syntax$$
+$icode%ok% = %f%.prepare_fast_eval()
+%$$
+$icode%n_byte% = %f%.size_fast_index()%$$
+
+$head Purpose$$
+Each time $icode f$$ is evaluated, its operations are decoded
+from the recording; i.e., the operator code, its argument indices,
+and its result index are extracted.
+This routine decodes the operations once and stores,
+for each operator, a pointer to the function that evaluates it.
+After this call, the following routines use the pre-decoded operations:
+$list number$$
+zero order forward mode $cref/f.Forward(0, x)/forward_zero/$$,
+$lnext
+reverse mode $cref/f.Reverse(q, w)/reverse_any/$$
+(for any order $icode q$$ and one weight direction).
+$lend
+This is intended for functions that are evaluated many times
+between changes to their operation sequence.
+The pre-decoded operations use the smallest integer type
+(16, 32, or 64 bits) that can hold the indices in the operation sequence,
+so that they use less memory bandwidth during the evaluations.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+
+$head ok$$
+The return value $icode ok$$ has prototype
+$codei%
+    bool %ok%
+%$$
+If it is true, the pre-decoded operations are used by the routines above.
+Otherwise, the operation sequence contains an operation that is not
+supported by the pre-decoded version and the standard routines are used.
+The following operations are not supported:
+$cref VecAD$$ operations,
+$cref atomic$$ function calls,
+and $cref PrintFor$$ operations.
+
+$head size_fast_index$$
+The return value $icode n_byte$$ has prototype
+$codei%
+    size_t %n_byte%
+%$$
+If the pre-decoded operations are being used,
+it is the number of bytes in the integer type used for their indices;
+i.e., $code sizeof(unsigned short)$$, $code sizeof(unsigned int)$$,
+or $code sizeof(size_t)$$.
+Otherwise it is zero.
+
+$head Conditional Skip$$
+The $cref/conditional skip/optimize/options/no_conditional_skip/$$
+optimization is not used by the pre-decoded operations; i.e.,
+all of the operations are evaluated.
+This does not change any of the results
+but $cref number_skip$$ is zero after a zero order forward sweep.
+If the previous zero order forward sweep did skip some operations
+(it was computed before $code prepare_fast_eval$$ was called),
+reverse mode uses the standard routine.
+
+$head Operation Sequence Changes$$
+The pre-decoded operations are discarded when the operation sequence
+for $icode f$$ changes; e.g., by calling
+$cref Dependent$$ or $cref optimize$$.
+(A call to $cref new_dynamic$$ does not change the operation sequence.)
+They are copied when $icode f$$ is assigned to another $code ADFun$$ object.
+
+$children%
+    example/general/fast_eval.cpp
+%$$
+$head Example$$
+The file $cref fast_eval.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file fast_eval.hpp
+Pre-decode an operation sequence for faster evaluation.
+*/
+
+/*!
+Create the pre-decoded instructions used by zero order forward
+and reverse mode.
+
+\return
+is true if the operation sequence can be evaluated using the
+pre-decoded instructions.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::prepare_fast_eval(void)
+{   return local::sweep::fast_setup(&play_);
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
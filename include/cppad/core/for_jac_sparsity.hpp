@@ -27,6 +27,10 @@ $section Forward Mode Jacobian Sparsity Patterns$$
 $head Syntax$$
 $icode%f%.for_jac_sparsity(
     %pattern_in%, %transpose%, %dependency%, %internal_bool%, %pattern_out%
+)
+%f%.for_jac_sparsity(
+    %pattern_in%, %transpose%, %dependency%, %internal_bool%, %pattern_out%,
+    %block_bits%, %n_thread%
 )%$$
 
 $head Purpose$$
@@ -133,6 +137,46 @@ $codei%
 If this is true, calculations are done with sets represented by a vector
 of boolean values. Otherwise, a vector of sets of integers is used.
 
+$head block_bits$$
+This optional argument has prototype
+$codei%
+    size_t %block_bits%
+%$$
+If it is not present, the value zero is used.
+If $icode internal_bool$$ is true and
+$icode block_bits$$ is non-zero and less than $latex \ell$$,
+the columns of $latex R$$ are split into blocks with $icode block_bits$$
+columns (rounded up to a multiple of the number of bits in a $code size_t$$)
+and there is one forward sweep for each block.
+Each sweep only stores the sparsity pattern of every variable
+for one block of columns.
+For large $latex \ell$$, this uses much less memory and keeps
+the patterns used by a sweep in cache.
+For example, $icode block_bits$$ equal to 256 or 512 groups the
+union of two sets into a few contiguous words that the compiler
+can vectorize.
+In this case, the sparsity patterns for the variables are not held in
+$icode f$$ for later use and
+$cref/size_forward_bool/for_jac_sparsity/f/size_forward_bool/$$
+is zero after the call.
+The value of $icode block_bits$$ does not matter
+when $icode internal_bool$$ is false.
+
+$head n_thread$$
+This optional argument has prototype
+$codei%
+    size_t %n_thread%
+%$$
+and must be greater than zero.
+If it is not present, the value one is used.
+If $icode n_thread$$ is greater than one and there is more than one block
+(see $icode block_bits$$ above),
+the blocks are divided among $icode n_thread$$ threads.
+The conditions and restrictions for multiple threads are the same as for
+$cref/sparse_jac/sparse_jac/n_thread/$$; e.g.,
+if $icode f$$ contains $cref atomic$$ function calls,
+all the blocks are done by the current thread.
+
 $head pattern_out$$
 This argument has prototype
 $codei%
@@ -166,8 +210,102 @@ $end
 */
 # include <cppad/core/ad_fun.hpp>
 # include <cppad/local/sparse/internal.hpp>
+# include <cppad/local/color_thread.hpp>
+# include <vector>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+Information shared by the threads that compute blocks of columns for
+a forward Jacobian sparsity pattern; see for_jac_block_worker.
+*/
+template <class Base>
+struct for_jac_block_info {
+    /// player for the operation sequence
+    const player<Base>*                 play;
+    /// are dependency patterns computed instead of sparsity patterns
+    bool                                dependency;
+    /// number of independent variables
+    size_t                              n;
+    /// number of dependent variables
+    size_t                              m;
+    /// number of variables in the tape
+    size_t                              num_var;
+    /// number of columns in R
+    size_t                              ell;
+    /// number of columns in each block (the last block may have fewer)
+    size_t                              block_bits;
+    /// number of blocks
+    size_t                              n_block;
+    /// number of threads
+    size_t                              n_thread;
+    /// variable index for each dependent variable
+    const size_t*                       dep_taddr;
+    /// entries of R for block b are in_ptr[b], ..., in_ptr[b+1]-1
+    const size_t*                       in_ptr;
+    /// variable index for the independent variable for each entry of R
+    const size_t*                       in_var;
+    /// column index for each entry of R
+    const size_t*                       in_col;
+    /// for each block, entries of J for dependent i start at out_ptr[b][i]
+    std::vector< std::vector<size_t> >* out_ptr;
+    /// for each block, column index for each entry of J
+    std::vector< std::vector<size_t> >* out_col;
+};
+/*!
+Compute the blocks of columns that correspond to one thread.
 
-namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+\param thread [in]
+the blocks b with b % n_thread == thread are computed by this call.
+
+\param void_info [in,out]
+is a pointer to the corresponding for_jac_block_info<Base> object.
+The elements of out_ptr and out_col for the blocks computed by this thread
+are set.
+*/
+template <class Base, class RecBase>
+void for_jac_block_worker(size_t thread, void* void_info)
+{   const for_jac_block_info<Base>& info =
+        *static_cast< for_jac_block_info<Base>* >(void_info);
+    RecBase not_used_rec_base;
+    //
+    for(size_t b = thread; b < info.n_block; b += info.n_thread)
+    {   size_t begin = b * info.block_bits;
+        size_t end   = std::min(begin + info.block_bits, info.ell);
+        //
+        // sparsity pattern for the independent variables in this block
+        sparse::pack_setvec var_sparsity;
+        var_sparsity.resize(info.num_var, end - begin);
+        for(size_t k = info.in_ptr[b]; k < info.in_ptr[b + 1]; ++k)
+            var_sparsity.add_element(info.in_var[k], info.in_col[k] - begin);
+        //
+        // sparsity pattern for the other variables in this block
+        sweep::for_jac<addr_t>(
+            info.play,
+            info.dependency,
+            info.n,
+            info.num_var,
+            var_sparsity,
+            not_used_rec_base
+        );
+        //
+        // pattern for the dependent variables in this block
+        std::vector<size_t>& ptr( (*info.out_ptr)[b] );
+        std::vector<size_t>& col( (*info.out_col)[b] );
+        ptr.resize(info.m + 1);
+        for(size_t i = 0; i < info.m; ++i)
+        {   ptr[i] = col.size();
+            sparse::pack_setvec_const_iterator
+                itr(var_sparsity, info.dep_taddr[i]);
+            size_t j = *itr;
+            while( j < end - begin )
+            {   col.push_back(begin + j);
+                j = *(++itr);
+            }
+        }
+        ptr[info.m] = col.size();
+    }
+}
+} // END_CPPAD_LOCAL_NAMESPACE
 
 /*!
 Forward Jacobian sparsity patterns.
@@ -205,6 +343,14 @@ the return value is a sparsity pattern for J(x) ( J(x)^T ) where
 \f]
 Here F is the function corresponding to the operation sequence
 and x is any argument value.
+
+\param block_bits
+If internal_bool is true and block_bits is non-zero and less than
+the number of columns in R, the columns of R are computed in blocks
+with block_bits columns (rounded up to a multiple of the bits in a size_t).
+
+\param n_thread
+number of threads used to compute the blocks; see color_thread_run.
 */
 template <class Base, class RecBase>
 template <class SizeVector>
@@ -213,7 +359,9 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
     bool                         transpose        ,
     bool                         dependency       ,
     bool                         internal_bool    ,
-    sparse_rc<SizeVector>&       pattern_out      )
+    sparse_rc<SizeVector>&       pattern_out      ,
+    size_t                       block_bits       ,
+    size_t                       n_thread         )
 {
     // used to identify the RecBase type in calls to sweeps
     RecBase not_used_rec_base;
@@ -232,9 +380,95 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
         "for_jac_sparsity: number rows in R "
         "is not equal number of independent variables."
     );
+    CPPAD_ASSERT_KNOWN(
+        n_thread > 0,
+        "for_jac_sparsity: n_thread is zero"
+    );
     bool zero_empty  = true;
     bool input_empty = true;
-    if( internal_bool )
+    //
+    // number of bits in a size_t (unit of storage for pack_setvec)
+    size_t n_bit = std::numeric_limits<size_t>::digits;
+    block_bits   = n_bit * ( (block_bits + n_bit - 1) / n_bit );
+    if( internal_bool && 0 < block_bits && block_bits < ell )
+    {   // the blocks do not store patterns for all the variables
+        for_jac_sparse_pack_.resize(0, 0);
+        for_jac_sparse_set_.resize(0, 0);
+        size_t m       = Range();
+        size_t n_block = (ell + block_bits - 1) / block_bits;
+        //
+        // entries of R bucketed by block
+        size_t nnz = pattern_in.nnz();
+        const SizeVector& row_in( pattern_in.row() );
+        const SizeVector& col_in( pattern_in.col() );
+        const SizeVector& var_in( transpose ? col_in : row_in );
+        const SizeVector& ell_in( transpose ? row_in : col_in );
+        local::pod_vector<size_t> in_ptr(n_block + 1);
+        for(size_t b = 0; b <= n_block; ++b)
+            in_ptr[b] = 0;
+        for(size_t k = 0; k < nnz; ++k)
+            ++in_ptr[ ell_in[k] / block_bits + 1 ];
+        for(size_t b = 0; b < n_block; ++b)
+            in_ptr[b + 1] += in_ptr[b];
+        local::pod_vector<size_t> in_var(nnz), in_col(nnz), next(n_block);
+        for(size_t b = 0; b < n_block; ++b)
+            next[b] = in_ptr[b];
+        for(size_t k = 0; k < nnz; ++k)
+        {   size_t b = ell_in[k] / block_bits;
+            in_var[ next[b] ]   = ind_taddr_[ var_in[k] ];
+            in_col[ next[b]++ ] = ell_in[k];
+        }
+        //
+        // atomic functions are computed by the current thread
+        n_thread = std::min(n_thread, n_block);
+        for(size_t i_op = 0; i_op < play_.num_op_rec() && n_thread > 1; ++i_op)
+        {   if( play_.GetOp(i_op) == local::AFunOp )
+                n_thread = 1;
+        }
+        //
+        std::vector< std::vector<size_t> > out_ptr(n_block), out_col(n_block);
+        local::for_jac_block_info<Base> info;
+        info.play       = &play_;
+        info.dependency = dependency;
+        info.n          = n;
+        info.m          = m;
+        info.num_var    = num_var_tape_;
+        info.ell        = ell;
+        info.block_bits = block_bits;
+        info.n_block    = n_block;
+        info.n_thread   = n_thread;
+        info.dep_taddr  = dep_taddr_.data();
+        info.in_ptr     = in_ptr.data();
+        info.in_var     = in_var.data();
+        info.in_col     = in_col.data();
+        info.out_ptr    = &out_ptr;
+        info.out_col    = &out_col;
+        local::color_thread_run<Base>(
+            n_thread, local::for_jac_block_worker<Base, RecBase>, &info
+        );
+        //
+        // combine the blocks in the same order as get_internal_pattern
+        size_t nnz_out = 0;
+        for(size_t b = 0; b < n_block; ++b)
+            nnz_out += out_col[b].size();
+        if( transpose )
+            pattern_out.resize(ell, m, nnz_out);
+        else
+            pattern_out.resize(m, ell, nnz_out);
+        size_t k_out = 0;
+        for(size_t i = 0; i < m; ++i)
+        {   for(size_t b = 0; b < n_block; ++b)
+            {   for(size_t k = out_ptr[b][i]; k < out_ptr[b][i + 1]; ++k)
+                {   if( transpose )
+                        pattern_out.set(k_out++, out_col[b][k], i);
+                    else
+                        pattern_out.set(k_out++, i, out_col[b][k]);
+                }
+            }
+        }
+        CPPAD_ASSERT_UNKNOWN( k_out == nnz_out );
+    }
+    else if( internal_bool )
     {   // allocate memory for bool sparsity calculation
         // (sparsity pattern is emtpy after a resize)
         for_jac_sparse_pack_.resize(num_var_tape_, ell);
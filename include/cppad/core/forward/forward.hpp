@@ -184,9 +184,22 @@ BaseVector ADFun<Base,RecBase>::Forward(
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
-    if( q == 0 )
+    if( q == 0 && play_.fast_vec().size() > 0 )
+    {   // pre-decoded operations do not use the conditional skip flags
+        if( cskip_op_any_ )
+        {   for(j = 0; j < cskip_op_.size(); j++)
+                cskip_op_[j] = false;
+            cskip_op_any_ = false;
+        }
+        local::sweep::fast_forward0(&play_, C, taylor_.data(),
+            compare_change_count_,
+            compare_change_number_,
+            compare_change_op_index_
+        );
+    }
+    else if( q == 0 )
     {
-        local::sweep::forward0(&play_, s, true,
+        cskip_op_any_ = local::sweep::forward0(&play_, s, true,
             n, num_var_tape_, C,
             taylor_.data(), cskip_op_.data(), load_op2var_,
             compare_change_count_,
@@ -196,7 +209,7 @@ BaseVector ADFun<Base,RecBase>::Forward(
         );
     }
     else
-    {   local::sweep::forward1(&play_, s, true, p, q,
+    {   bool cskip_any = local::sweep::forward1(&play_, s, true, p, q,
             n, num_var_tape_, C,
             taylor_.data(), cskip_op_.data(), load_op2var_,
             compare_change_count_,
@@ -204,6 +217,8 @@ BaseVector ADFun<Base,RecBase>::Forward(
             compare_change_op_index_,
             not_used_rec_base
         );
+        if( p == 0 )
+            cskip_op_any_ = cskip_any;
     }
 
     // return Taylor coefficients for dependent variables
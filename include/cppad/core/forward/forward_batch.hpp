@@ -0,0 +1,173 @@
+# ifndef CPPAD_CORE_FORWARD_FORWARD_BATCH_HPP
+# define CPPAD_CORE_FORWARD_FORWARD_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin forward_batch$$
+$spell
+    const
+    xN
+    yN
+    cpp
+    Taylor
+    VecAD
+$$
+
+$section Zero Order Forward Mode at Multiple Points$$
+
+$head Syntax$$
+$icode%yN% = %f%.forward_batch(%N%, %xN%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_FORWARD_BATCH%// END_FORWARD_BATCH%1
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+This routine evaluates $latex F(x)$$ at $icode N$$ different values
+of $icode x$$ using one pass through the operation sequence.
+Each operator is decoded once and then applied to all the points,
+so this should be faster than $icode N$$ calls to
+$cref/f.Forward(0, x)/forward_zero/$$.
+
+$head f$$
+The Taylor coefficients stored in $icode f$$ are not affected
+by this operation; i.e., it uses separate memory for its results.
+
+$head N$$
+is the number of points at which $latex F(x)$$ is evaluated.
+It must be greater than zero.
+
+$head xN$$
+The size of this vector is $icode%N%*%n%$$.
+For $icode%j% = 0, %...%, %n%-1%$$ and $icode%k% = 0, %...%, %N%-1%$$,
+$codei%
+    %xN%[ %N% * %j% + %k% ]
+%$$
+is the $th j$$ component of the $th k$$ point.
+Note that the values for one component at all the points are contiguous
+(the same convention is used by $cref forward_dir$$ for directions).
+
+$head yN$$
+The size of this vector is $icode%N%*%m%$$.
+For $icode%i% = 0, %...%, %m%-1%$$ and $icode%k% = 0, %...%, %N%-1%$$,
+$codei%
+    %yN%[ %N% * %i% + %k% ]
+%$$
+is the $th i$$ component of $latex F(x)$$ at the $th k$$ point.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head Restrictions$$
+$list number$$
+The $cref compare_change$$ information is not computed by this routine.
+$lnext
+All the operators are evaluated at each point; i.e., the
+$cref/conditional skip/optimize/options/no_conditional_skip/$$
+optimization is not used.
+$lnext
+The $cref PrintFor$$ operations do not generate any output.
+$lend
+Atomic functions and $cref VecAD$$ operations are supported,
+but atomic functions are called once for each point.
+
+$children%
+    example/general/forward_batch.cpp
+%$$
+$head Example$$
+The file $cref forward_batch.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file forward_batch.hpp
+Zero order forward mode at multiple points.
+*/
+
+/*!
+Zero order forward mode at multiple points using one sweep.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param N
+is the number of points.
+
+\param xN
+xN[ N * j + k ] is the j-th independent variable value at the k-th point.
+
+\return
+The return value yN has size N * m and
+yN[ N * i + k ] is the i-th dependent variable value at the k-th point.
+*/
+// BEGIN_FORWARD_BATCH
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_batch(
+    size_t              N         ,
+    const BaseVector&   xN        )
+// END_FORWARD_BATCH
+{
+    // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base;
+
+    // number of independent variables
+    size_t n = ind_taddr_.size();
+
+    // number of dependent variables
+    size_t m = dep_taddr_.size();
+
+    // check Vector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN( N > 0, "forward_batch(N, xN): N == 0" );
+    CPPAD_ASSERT_KNOWN(
+        size_t(xN.size()) == N * n,
+        "forward_batch(N, xN): xN.size() is not equal N * n"
+    );
+
+    // memory used for the values of all the variables at all the points
+    local::pod_vector_maybe<Base> taylor(num_var_tape_ * N);
+
+    // set values for the independent variables
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+        CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        for(size_t k = 0; k < N; k++)
+            taylor[ N * ind_taddr_[j] + k ] = xN[ N * j + k ];
+    }
+
+    // evaluate the function at all the points
+    local::sweep::forward0_batch<addr_t>(
+        &play_, n, num_var_tape_, N, taylor.data(), not_used_rec_base
+    );
+
+    // return values for the dependent variables
+    BaseVector yN(N * m);
+    for(size_t i = 0; i < m; i++)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+        for(size_t k = 0; k < N; k++)
+            yN[ N * i + k ] = taylor[ N * dep_taddr_[i] + k ];
+    }
+    return yN;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -257,7 +257,8 @@ compare_change_op_index_(0),
 num_order_taylor_(0),
 cap_order_taylor_(0),
 num_direction_taylor_(0),
-num_var_tape_(0)
+num_var_tape_(0),
+cskip_op_any_(false)
 { }
 
 /*!
@@ -319,6 +320,7 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     base2ad_return_value_      = false;
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    cskip_op_any_              = f.cskip_op_any_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
@@ -365,6 +367,7 @@ void ADFun<Base,RecBase>::operator=(ADFun&& f)
     base2ad_return_value_      = false; // f might be, but this is not
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    cskip_op_any_              = f.cskip_op_any_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
@@ -502,7 +505,7 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
     // use independent variable values to fill in values for others
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
-    local::sweep::forward0(&play_, std::cout, false,
+    cskip_op_any_ = local::sweep::forward0(&play_, std::cout, false,
         n, num_var_tape_, cap_order_taylor_, taylor_.data(),
         cskip_op_.data(), load_op2var_,
         compare_change_count_,
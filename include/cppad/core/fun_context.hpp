@@ -0,0 +1,474 @@
+# ifndef CPPAD_CORE_FUN_CONTEXT_HPP
+# define CPPAD_CORE_FUN_CONTEXT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_context$$
+$spell
+    const
+    xq
+    yq
+    dw
+    Taylor
+    thread_alloc
+    VecAD
+    PrintFor
+    num
+$$
+
+$section Evaluate One ADFun Object Using Multiple Threads$$
+
+$head Syntax$$
+$codei%fun_context<%Base%> %context%(%f%)
+%$$
+$icode%yq% = %context%.Forward(%q%, %xq%)
+%$$
+$icode%dw% = %context%.Reverse(%q%, %w%)
+%$$
+$icode%c% = %context%.size_order()
+%$$
+$icode%context%.clear()%$$
+
+$head Purpose$$
+The forward and reverse mode routines for an $cref ADFun$$ object
+store Taylor coefficients in the object.
+Hence each thread that evaluates a function must use its own copy of
+the $code ADFun$$ object; e.g., see $cref multi_newton.cpp$$.
+Each copy contains the entire operation sequence
+and the memory for the operation sequence can be much larger than
+the memory for the Taylor coefficients.
+A $code fun_context$$ object holds the Taylor coefficients,
+and other information that changes during an evaluation,
+while the operation sequence is shared with $icode f$$.
+Thus one $code ADFun$$ object can be used by many threads at the same time,
+provided each thread uses its own $code fun_context$$ object.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%>& %f%
+%$$
+It contains the operation sequence that is evaluated by $icode context$$.
+The object $icode f$$ must not be destroyed,
+and its operation sequence must not change,
+while $icode context$$ is in use.
+For example, one must not call
+$cref Dependent$$, $cref optimize$$, or $cref new_dynamic$$
+using $icode f$$ during this time.
+Forward and reverse mode calculations using $icode f$$ itself are allowed
+because they do not change the operation sequence.
+If $cref prepare_fast_eval$$ was called using $icode f$$,
+the pre-decoded operations are also used by $icode context$$.
+
+$head context$$
+The object $icode context$$ has prototype
+$codei%
+    fun_context<%Base%> %context%
+%$$
+It is a lightweight object; i.e., upon construction it does not
+allocate any memory.
+The memory for its Taylor coefficients is allocated,
+using $cref thread_alloc$$, by the first call to $icode%context%.Forward%$$.
+This memory belongs to the thread that made that call.
+It must be freed by that thread,
+or when in sequential execution mode,
+by calling $icode%context%.clear()%$$ or destroying $icode context$$.
+
+$head Forward$$
+The syntax
+$codei%
+    %yq% = %context%.Forward(%q%, %xq%)
+%$$
+has the same specifications as the syntax
+$cref/%f%.Forward(%q%, %xq%)/forward_order/$$
+except that the Taylor coefficients are stored in $icode context$$
+instead of $icode f$$.
+(Only one direction is supported; see $cref forward_dir$$.)
+The output stream for $cref PrintFor$$ operations is $code std::cout$$.
+Comparison operators are not checked; see $cref compare_change$$.
+
+$head Reverse$$
+The syntax
+$codei%
+    %dw% = %context%.Reverse(%q%, %w%)
+%$$
+has the same specifications as the syntax
+$cref/%f%.Reverse(%q%, %w%)/reverse_any/$$
+except that the Taylor coefficients stored in $icode context$$
+are used in place of the ones stored in $icode f$$.
+
+$head size_order$$
+The return value $icode c$$ has prototype
+$codei%
+    size_t %c%
+%$$
+It is the number of Taylor coefficient orders, per variable,
+currently stored in $icode context$$; see $cref size_order$$.
+
+$head clear$$
+This frees the memory in $icode context$$.
+After this call, $icode%context%.size_order()%$$ is zero.
+
+$head Parallel Mode$$
+The object $icode context$$ can only be used by one thread at a time.
+If the function contains $cref atomic$$ operations,
+they must support being called by multiple threads.
+As with any use of CppAD in parallel mode, see $cref parallel_ad$$
+for the setup that is required.
+
+$children%
+    example/general/fun_context.cpp
+%$$
+$head Example$$
+The file $cref fun_context.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file fun_context.hpp
+Evaluation context that shares the operation sequence in an ADFun object.
+*/
+
+/*!
+Taylor coefficients and other information that changes
+during evaluation of the operation sequence in an ADFun object.
+
+\tparam Base
+is the base type for the ADFun object.
+
+\tparam RecBase
+is the base type used when recording the ADFun object.
+*/
+template <class Base, class RecBase>
+class fun_context {
+private:
+    /// function that contains the operation sequence (null if none)
+    const ADFun<Base,RecBase>* fun_;
+
+    /// number of orders stored in taylor_
+    size_t num_order_taylor_;
+
+    /// maximum number of orders that will fit in taylor_
+    size_t cap_order_taylor_;
+
+    /// results of the forward mode calculations
+    local::pod_vector_maybe<Base> taylor_;
+
+    /// which operations can be conditionally skipped
+    local::pod_vector<bool> cskip_op_;
+
+    /// if false, all the elements of cskip_op_ are false
+    bool cskip_op_any_;
+
+    /// Variable on the tape corresponding to each vecad load operation
+    local::pod_vector<addr_t> load_op2var_;
+    // ------------------------------------------------------------------
+    /*!
+    Make sure taylor_ can hold order q and allocate other vectors.
+
+    \param q
+    is the highest order that will be stored in taylor_.
+
+    \param p
+    is the lowest order that will be computed. The orders below p
+    are kept when taylor_ is re-allocated.
+    */
+    void setup(size_t q, size_t p)
+    {   const local::player<Base>& play( fun_->play_ );
+        size_t num_var = fun_->num_var_tape_;
+        if( cskip_op_.size() != play.num_op_rec() )
+        {   cskip_op_.resize( play.num_op_rec() );
+            for(size_t i = 0; i < cskip_op_.size(); ++i)
+                cskip_op_[i] = false;
+            cskip_op_any_ = false;
+        }
+        if( load_op2var_.size() != play.num_var_load_rec() )
+            load_op2var_.resize( play.num_var_load_rec() );
+        if( cap_order_taylor_ > q )
+            return;
+        //
+        // new Taylor coefficient vector (copy orders less than p)
+        size_t c     = q + 1;
+        size_t C     = cap_order_taylor_;
+        size_t n_old = std::min(p, num_order_taylor_);
+        local::pod_vector_maybe<Base> new_taylor(num_var * c);
+        for(size_t i = 0; i < num_var; ++i)
+        {   for(size_t k = 0; k < n_old; ++k)
+                new_taylor[i * c + k] = taylor_[i * C + k];
+        }
+        taylor_.swap(new_taylor);
+        cap_order_taylor_ = c;
+        num_order_taylor_ = n_old;
+    }
+public:
+    /// default constructor (no function)
+    fun_context(void)
+    : fun_(CPPAD_NULL), num_order_taylor_(0), cap_order_taylor_(0),
+      cskip_op_any_(false)
+    { }
+    /*!
+    Constructor
+
+    \param f
+    is the function that this object will evaluate.
+    It must not be destroyed, or have its operation sequence changed,
+    while this object is in use.
+    */
+    fun_context(const ADFun<Base,RecBase>& f)
+    : fun_(&f), num_order_taylor_(0), cap_order_taylor_(0),
+      cskip_op_any_(false)
+    { }
+    /// free the memory allocated for this object
+    void clear(void)
+    {   num_order_taylor_ = 0;
+        cap_order_taylor_ = 0;
+        taylor_.clear();
+        cskip_op_.clear();
+        cskip_op_any_ = false;
+        load_op2var_.clear();
+    }
+    /// number of Taylor coefficient orders stored in this object
+    size_t size_order(void) const
+    {   return num_order_taylor_; }
+    // ------------------------------------------------------------------
+    /*!
+    Forward mode, multiple orders, one direction.
+
+    \param q
+    is the highest order for this forward mode computation.
+
+    \param xq
+    contains the Taylor coefficients for the independent variables
+    and has size n or n*(q+1); see ADFun::Forward(q, xq, s).
+
+    \return
+    Taylor coefficients for the dependent variables
+    with size m or m*(q+1).
+    */
+    template <class BaseVector>
+    BaseVector Forward(size_t q, const BaseVector& xq)
+    {   // used to identify the RecBase type in calls to sweeps
+        RecBase not_used_rec_base;
+        //
+        CPPAD_ASSERT_KNOWN(
+            fun_ != CPPAD_NULL,
+            "fun_context: Forward: this context does not have a function"
+        );
+        const local::player<Base>*       play    = &( fun_->play_ );
+        const local::pod_vector<size_t>& ind_taddr( fun_->ind_taddr_ );
+        const local::pod_vector<size_t>& dep_taddr( fun_->dep_taddr_ );
+        size_t num_var = fun_->num_var_tape_;
+        size_t n       = ind_taddr.size();
+        size_t m       = dep_taddr.size();
+        //
+        // check Vector is Simple Vector class with Base type elements
+        CheckSimpleVector<Base, BaseVector>();
+        //
+        CPPAD_ASSERT_KNOWN(
+            size_t(xq.size()) == n || size_t(xq.size()) == n*(q+1),
+            "fun_context: Forward(q, xq): xq.size() is not equal n or n*(q+1)"
+        );
+        // p = lowest order we are computing
+        size_t p = q + 1 - size_t(xq.size()) / n;
+        CPPAD_ASSERT_KNOWN(
+            q <= num_order_taylor_ || p == 0,
+            "fun_context: Forward(q, xq): Number of Taylor coefficient orders"
+            " stored in this context\nis less than q and xq.size() != n*(q+1)."
+        );
+        setup(q, p);
+        size_t C = cap_order_taylor_;
+        //
+        // initialize orders p through q
+        for(size_t j = 0; j < num_var; ++j)
+        {   for(size_t k = p; k <= q; ++k)
+                taylor_[C * j + k] = CppAD::numeric_limits<Base>::quiet_NaN();
+        }
+        // set Taylor coefficients for independent variables
+        for(size_t j = 0; j < n; ++j)
+        {   CPPAD_ASSERT_UNKNOWN( play->GetOp( ind_taddr[j] ) == local::InvOp );
+            if( p == q )
+                taylor_[ C * ind_taddr[j] + q] = xq[j];
+            else
+            {   for(size_t k = 0; k <= q; ++k)
+                    taylor_[ C * ind_taddr[j] + k] = xq[ (q+1)*j + k];
+            }
+        }
+        //
+        // evaluate the Taylor coefficients
+        size_t compare_change_count    = 0;
+        size_t compare_change_number   = 0;
+        size_t compare_change_op_index = 0;
+        if( q == 0 && play->fast_vec().size() > 0 )
+        {   // pre-decoded operations do not use the conditional skip flags
+            if( cskip_op_any_ )
+            {   for(size_t i = 0; i < cskip_op_.size(); ++i)
+                    cskip_op_[i] = false;
+                cskip_op_any_ = false;
+            }
+            local::sweep::fast_forward0(play, C, taylor_.data(),
+                compare_change_count,
+                compare_change_number,
+                compare_change_op_index
+            );
+        }
+        else if( q == 0 )
+        {   cskip_op_any_ = local::sweep::forward0(play, std::cout, true,
+                n, num_var, C,
+                taylor_.data(), cskip_op_.data(), load_op2var_,
+                compare_change_count,
+                compare_change_number,
+                compare_change_op_index,
+                not_used_rec_base
+            );
+        }
+        else
+        {   bool cskip_any = local::sweep::forward1(
+                play, std::cout, true, p, q,
+                n, num_var, C,
+                taylor_.data(), cskip_op_.data(), load_op2var_,
+                compare_change_count,
+                compare_change_number,
+                compare_change_op_index,
+                not_used_rec_base
+            );
+            if( p == 0 )
+                cskip_op_any_ = cskip_any;
+        }
+        //
+        // return Taylor coefficients for dependent variables
+        BaseVector yq;
+        if( p == q )
+        {   yq.resize(m);
+            for(size_t i = 0; i < m; ++i)
+                yq[i] = taylor_[ C * dep_taddr[i] + q];
+        }
+        else
+        {   yq.resize(m * (q+1) );
+            for(size_t i = 0; i < m; ++i)
+            {   for(size_t k = 0; k <= q; ++k)
+                    yq[ (q+1) * i + k] = taylor_[ C * dep_taddr[i] + k ];
+            }
+        }
+        num_order_taylor_ = q + 1;
+        return yq;
+    }
+    // ------------------------------------------------------------------
+    /*!
+    Reverse mode, multiple orders, one weight direction.
+
+    \param q
+    is the number of Taylor coefficient orders being differentiated.
+
+    \param w
+    is the weighting for the dependent variable Taylor coefficients
+    and has size m or m*q; see ADFun::Reverse(q, w).
+
+    \return
+    the derivative of the weighted sum with respect to the independent
+    variable Taylor coefficients; it has size n*q.
+    */
+    template <class BaseVector>
+    BaseVector Reverse(size_t q, const BaseVector& w)
+    {   // used to identify the RecBase type in calls to sweeps
+        RecBase not_used_rec_base;
+        //
+        CPPAD_ASSERT_KNOWN(
+            fun_ != CPPAD_NULL,
+            "fun_context: Reverse: this context does not have a function"
+        );
+        const local::player<Base>*       play    = &( fun_->play_ );
+        const local::pod_vector<size_t>& ind_taddr( fun_->ind_taddr_ );
+        const local::pod_vector<size_t>& dep_taddr( fun_->dep_taddr_ );
+        size_t num_var = fun_->num_var_tape_;
+        size_t n       = ind_taddr.size();
+        size_t m       = dep_taddr.size();
+        //
+        // check BaseVector is Simple Vector class with Base type elements
+        CheckSimpleVector<Base, BaseVector>();
+        //
+        CPPAD_ASSERT_KNOWN(
+            size_t(w.size()) == m || size_t(w.size()) == (m * q),
+            "fun_context: Reverse(q, w): w.size() is not equal m or m*q"
+        );
+        CPPAD_ASSERT_KNOWN(
+            q > 0,
+            "fun_context: Reverse(q, w): q is not greater than zero."
+        );
+        CPPAD_ASSERT_KNOWN(
+            num_order_taylor_ >= q,
+            "fun_context: Reverse(q, w): Less than q Taylor coefficients"
+            " are currently stored in this context."
+        );
+        //
+        // initialize entire Partial matrix to zero
+        const Base zero(0);
+        local::pod_vector_maybe<Base> Partial(num_var * q);
+        for(size_t i = 0; i < num_var * q; ++i)
+            Partial[i] = zero;
+        //
+        // set the dependent variable direction
+        for(size_t i = 0; i < m; ++i)
+        {   if( size_t(w.size()) == m )
+                Partial[dep_taddr[i] * q + q - 1] += w[i];
+            else
+            {   for(size_t k = 0; k < q; ++k)
+                    Partial[ dep_taddr[i] * q + k ] = w[i * q + k ];
+            }
+        }
+        //
+        // pre-decoded operations can only be used when no operations skipped
+        bool use_fast = play->fast_vec().size() > 0 && ! cskip_op_any_;
+        if( use_fast )
+        {   local::sweep::fast_reverse(
+                play, q - 1, cap_order_taylor_, taylor_.data(),
+                q, Partial.data()
+            );
+        }
+        else
+        {   local::play::const_sequential_iterator play_itr = play->end();
+            local::sweep::reverse(
+                q - 1,
+                n,
+                num_var,
+                play,
+                cap_order_taylor_,
+                taylor_.data(),
+                q,
+                Partial.data(),
+                cskip_op_.data(),
+                load_op2var_,
+                play_itr,
+                not_used_rec_base
+            );
+        }
+        //
+        // return the derivative values
+        BaseVector value(n * q);
+        // (see the Reverse Identity Theorem in ADFun::Reverse)
+        for(size_t j = 0; j < n; ++j)
+        {   for(size_t k = 0; k < q; ++k)
+            {   if( size_t(w.size()) == m )
+                    value[j * q + k ] = Partial[ind_taddr[j] * q + q - 1 - k];
+                else
+                    value[j * q + k ] = Partial[ind_taddr[j] * q + k];
+            }
+        }
+        return value;
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -14,7 +14,12 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 # include <cppad/core/new_dynamic.hpp>
 # include <cppad/core/forward/forward.hpp>
+# include <cppad/core/forward/forward_batch.hpp>
 # include <cppad/core/reverse.hpp>
+# include <cppad/core/fast_eval.hpp>
+# include <cppad/core/slot_eval.hpp>
+# include <cppad/core/update_eval.hpp>
+# include <cppad/core/level_eval.hpp>
 # include <cppad/core/sparse.hpp>
 
 # endif
@@ -0,0 +1,288 @@
+# ifndef CPPAD_CORE_FUN_SPECIALIZE_HPP
+# define CPPAD_CORE_FUN_SPECIALIZE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin fun_specialize$$
+$spell
+    const
+    dyn
+    bool
+    std
+    CondExp
+    VecAD
+    op
+    nan
+$$
+
+$section Specialize an ADFun Object For the Current Dynamic Parameters$$
+
+$head Syntax$$
+$codei%fun_specialize<%Base%> %spec%(%f%)
+%$$
+$icode%valid% = %spec%.valid()
+%$$
+$icode%changed% = %spec%.update(%x%)
+%$$
+$icode%changed% = %spec%.update(%x%, %options%)
+%$$
+$codei%ADFun<%Base%>& %g% = %spec%.fun()
+%$$
+
+$head Purpose$$
+The $cref/dynamic parameters/glossary/Parameter/Dynamic/$$ in $icode f$$
+can be changed using $cref new_dynamic$$, without re-recording
+the function.
+Operations that only depend on dynamic parameters
+must be evaluated during every call to $code new_dynamic$$,
+and operations that combine them with variables are not simplified.
+In some applications the dynamic parameters do not change for long periods.
+A $code fun_specialize$$ object holds a function $icode g$$
+that is equal to $icode f$$ for the current values of the
+dynamic parameters, and in which these values are constants; i.e.,
+$list number$$
+Operations that only depend on dynamic parameters are computed once
+and are not in $icode g$$.
+$lnext
+Operations that multiply by one (or zero), add zero, and similar
+cases, are simplified.
+$lnext
+$cref/conditional expressions/CondExp/$$ whose comparison only depends
+on dynamic parameters choose one of the two cases;
+the other case is not evaluated by $icode g$$.
+$lnext
+The function $icode g$$ is then $cref/optimized/optimize/$$.
+$lend
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%>& %f%
+%$$
+It contains the operation sequence that is specialized.
+The object $icode f$$ must not be destroyed,
+and its operation sequence must not change,
+while $icode spec$$ is in use.
+(Calling $cref new_dynamic$$ using $icode f$$ is allowed.)
+
+$head spec$$
+The object $icode spec$$ has prototype
+$codei%
+    fun_specialize<%Base%> %spec%
+%$$
+Upon construction $icode spec$$ is not $icode valid$$.
+
+$head valid$$
+The return value $icode valid$$ has prototype
+$codei%
+    bool %valid%
+%$$
+It is true if $icode g$$ has been created and the dynamic parameters
+in $icode f$$ have the same values as when $icode g$$ was created.
+Thus, when $cref new_dynamic$$ changes the value of a dynamic parameter in
+$icode f$$, the current $icode g$$ is no longer valid.
+(Calling $code new_dynamic$$ with the same values does not invalidate
+$icode g$$.)
+Two $cref/nan/nan/$$ values are considered the same; i.e.,
+if $icode g$$ was created when a dynamic parameter was nan,
+it is still valid when that parameter is set to nan again.
+The cost of this check is proportional to the number of
+independent dynamic parameters.
+
+$head update$$
+If $icode valid$$ is true, this operation does nothing.
+Otherwise, $icode g$$ is created using the current values of the
+dynamic parameters in $icode f$$.
+
+$subhead x$$
+The argument $icode x$$ has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and its size is equal to $icode%f%.Domain()%$$.
+It specifies the value of the independent variables during the recording
+of $icode g$$.
+This only matters if $icode f$$ has $cref/comparison/Compare/$$
+operators or $cref VecAD$$ indices that depend on the independent variables;
+see $cref compare_change$$.
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$subhead options$$
+The argument $icode options$$ has prototype
+$codei%
+    const std::string& %options%
+%$$
+It is passed to $cref optimize$$ when $icode g$$ is optimized.
+If it is not present, the empty string is used for $icode options$$.
+
+$subhead changed$$
+The return value $icode changed$$ has prototype
+$codei%
+    bool %changed%
+%$$
+It is true if $icode g$$ was created by this call.
+
+$head fun$$
+The return value $icode g$$ is the specialized function.
+It has the same domain and range as $icode f$$,
+but it does not have any dynamic parameters.
+It is not valid for computing $icode f$$ when $icode valid$$ is false.
+If $cref check_for_nan$$ is false for $icode f$$, it is also false for
+$icode g$$.
+
+$head Restrictions$$
+The $icode update$$ operation records a new function using
+$codei%AD<%Base%>%$$ operations; i.e.,
+a recording must not be in progress for the current thread
+and $icode f$$ must support $cref base2ad$$.
+
+$children%
+    example/general/fun_specialize.cpp
+%$$
+$head Example$$
+The file $cref fun_specialize.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file fun_specialize.hpp
+Function where the dynamic parameters in an ADFun object are constants.
+*/
+
+/*!
+An ADFun object specialized for the current dynamic parameter values
+in another ADFun object.
+
+\tparam Base
+is the base type for the ADFun object.
+
+\tparam RecBase
+is the base type used when recording the ADFun object.
+*/
+template <class Base, class RecBase>
+class fun_specialize {
+private:
+    /// function that is specialized
+    const ADFun<Base,RecBase>* fun_;
+
+    /// specialized version of fun_
+    ADFun<Base,RecBase> spec_;
+
+    /// is spec_ defined
+    bool defined_;
+
+    /// independent dynamic parameter values used to create spec_
+    local::pod_vector_maybe<Base> dyn_ind_;
+public:
+    /// constructor
+    fun_specialize(const ADFun<Base,RecBase>& f)
+    : fun_(&f), defined_(false)
+    { }
+    // ------------------------------------------------------------------
+    /// is the specialized function valid for the current dynamic parameters
+    bool valid(void) const
+    {   if( ! defined_ )
+            return false;
+        const local::player<Base>& play( fun_->play_ );
+        const local::pod_vector_maybe<Base>& all_par_vec(
+            play.all_par_vec()
+        );
+        const local::pod_vector<addr_t>& dyn_ind2par_ind(
+            play.dyn_ind2par_ind()
+        );
+        size_t n_dyn = play.num_dynamic_ind();
+        if( dyn_ind_.size() != n_dyn )
+            return false;
+        for(size_t i = 0; i < n_dyn; ++i)
+        {   const Base& par = all_par_vec[ dyn_ind2par_ind[i] ];
+            bool same = IdenticalEqualCon(par, dyn_ind_[i]);
+            // two nan values are the same
+            same |= CppAD::isnan(par) && CppAD::isnan(dyn_ind_[i]);
+            if( ! same )
+                return false;
+        }
+        return true;
+    }
+    // ------------------------------------------------------------------
+    /*!
+    Create the specialized function (if it is not valid).
+
+    \param x
+    value of the independent variables during the recording.
+
+    \param options
+    options passed to optimize.
+
+    \return
+    is true if the specialized function was created by this call.
+    */
+    template <class BaseVector>
+    bool update(const BaseVector& x, const std::string& options = "")
+    {   if( valid() )
+            return false;
+        CheckSimpleVector<Base, BaseVector>();
+        size_t n = fun_->Domain();
+        size_t m = fun_->Range();
+        CPPAD_ASSERT_KNOWN( size_t( x.size() ) == n,
+            "fun_specialize: update: x.size() not equal f.Domain()"
+        );
+        //
+        // dyn_ind_
+        const local::player<Base>& play( fun_->play_ );
+        const local::pod_vector_maybe<Base>& all_par_vec(
+            play.all_par_vec()
+        );
+        const local::pod_vector<addr_t>& dyn_ind2par_ind(
+            play.dyn_ind2par_ind()
+        );
+        size_t n_dyn = play.num_dynamic_ind();
+        dyn_ind_.resize(n_dyn);
+        for(size_t i = 0; i < n_dyn; ++i)
+            dyn_ind_[i] = all_par_vec[ dyn_ind2par_ind[i] ];
+        //
+        // af
+        ADFun< AD<Base>, RecBase > af = fun_->base2ad();
+        af.check_for_nan(false);
+        //
+        // ap: the dynamic parameters are constants in the new recording
+        vector< AD<Base> > ap(n_dyn);
+        for(size_t i = 0; i < n_dyn; ++i)
+            ap[i] = dyn_ind_[i];
+        af.new_dynamic(ap);
+        //
+        // record spec_
+        vector< AD<Base> > ax(n), ay(m);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x[j];
+        Independent(ax);
+        ay = af.Forward(0, ax);
+        spec_.Dependent(ax, ay);
+        spec_.check_for_nan( fun_->check_for_nan_ );
+        spec_.optimize(options);
+        //
+        defined_ = true;
+        return true;
+    }
+    // ------------------------------------------------------------------
+    /// the specialized function
+    ADFun<Base,RecBase>& fun(void)
+    {   return spec_; }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
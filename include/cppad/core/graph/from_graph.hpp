@@ -1440,8 +1440,9 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
     // taylor_
     taylor_.resize(0);
     //
-    // cskip_op_
+    // cskip_op_ (elements are not initialized)
     cskip_op_.resize( rec.num_op_rec() );
+    cskip_op_any_ = true;
     //
     // load_op2var_
     load_op2var_.resize( rec.num_var_load_rec() );
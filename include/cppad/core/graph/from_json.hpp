@@ -20,6 +20,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 $begin from_json$$
 $spell
     Json
+    std
+    ifstream
 $$
 
 $section ADFun Object Corresponding to a Json AD Graph$$
@@ -28,16 +30,27 @@ $head Syntax$$
 $codei%
     ADFun<%Base%> %fun%
     %fun%.from_json(%json%)
+    %fun%.from_json(%is%)
 %$$
 
 $head Prototype$$
 $srcthisfile%
     0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
 %$$
+$srcthisfile%
+    0%// BEGIN_STREAM_PROTOTYPE%// END_STREAM_PROTOTYPE%1
+%$$
 
 $head json$$
 is a $cref json_ad_graph$$.
 
+$head is$$
+is a stream that contains a $cref json_ad_graph$$; e.g.,
+an $code std::ifstream$$ for a file.
+The stream is read incrementally as the graph is parsed,
+so the text for the graph is not all in memory at the same time.
+This reduces the peak memory used when the graph is large.
+
 $head Base$$
 is the type corresponding to this $cref/ADFun/adfun/$$ object;
 i.e., its calculations are done using the type $icode Base$$.
@@ -72,5 +85,20 @@ void CppAD::ADFun<Base,RecBase>::from_json(const std::string& json)
     //
     return;
 }
+// BEGIN_STREAM_PROTOTYPE
+template <class Base, class RecBase>
+void CppAD::ADFun<Base,RecBase>::from_json(std::istream& is)
+// END_STREAM_PROTOTYPE
+{   // C++ graph object
+    cpp_graph graph_obj;
+    //
+    // convert json in the stream to graph representation
+    local::graph::json_parser(is, graph_obj);
+    //
+    // convert the graph representation to a function
+    from_graph(graph_obj);
+    //
+    return;
+}
 
 # endif
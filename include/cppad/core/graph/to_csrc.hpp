@@ -0,0 +1,161 @@
+# ifndef CPPAD_CORE_GRAPH_TO_CSRC_HPP
+# define CPPAD_CORE_GRAPH_TO_CSRC_HPP
+
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/core/ad_fun.hpp>
+# include <cppad/local/graph/cpp_graph_op.hpp>
+# include <cppad/core/graph/cpp_graph.hpp>
+# include <cppad/local/graph/csrc_writer.hpp>
+
+/*
+------------------------------------------------------------------------------
+$begin to_csrc$$
+$spell
+    csrc
+    std
+    ofstream
+    os
+    nx
+    ny
+    const
+    cexp
+    CppAD
+    dll
+    lib
+    NDEBUG
+$$
+
+$section C Source Code Corresponding to an ADFun Object$$
+
+$head Syntax$$
+$icode%ok% = %fun%.to_csrc(%os%, %function_name%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+This writes C source code that evaluates the
+zero order forward mode for the function corresponding to $icode fun$$.
+The code can be compiled with a C (or C++) compiler,
+placed in a dynamic link library using $cref create_dll_lib$$,
+and then loaded at run time using $cref link_dll_lib$$.
+This removes the operator dispatch overhead of the $cref/ADFun/adfun/$$
+sweeps. Derivatives can be computed in the same way by first
+recording them as functions using $cref base2ad$$; see $cref csrc_fun$$.
+
+$head fun$$
+is the $cref/ADFun/adfun/$$ object.
+
+$head Base$$
+is the type corresponding to this $cref/ADFun/adfun/$$ object;
+i.e., its calculations are done using the type $icode Base$$.
+The source code uses the type $code double$$ for its calculations.
+
+$head RecBase$$
+in the prototype above, $icode RecBase$$ is the same type as $icode Base$$.
+
+$head os$$
+The C source code is written to this stream;
+e.g., an $code std::ofstream$$ for a file.
+
+$head function_name$$
+is the name of the C function; i.e.,
+it must be a valid C identifier.
+
+$head C Function$$
+The C function has the following prototype:
+$codei%
+    int %function_name%(
+        size_t %nx%, const double* %x%, size_t %ny%, double* %y%
+    )
+%$$
+It has C linkage (even if it is compiled with a C++ compiler).
+
+$subhead nx$$
+This must be equal to the number of independent dynamic parameters
+plus the number of independent variables for $icode fun$$.
+
+$subhead x$$
+The first elements of $icode x$$ are the values for the independent
+dynamic parameters (see $cref new_dynamic$$) and the rest are
+the values for the independent variables.
+
+$subhead ny$$
+This must be equal to the number of dependent variables for $icode fun$$.
+
+$subhead y$$
+The input value of its elements does not matter.
+Upon return, it contains the corresponding value of the function.
+
+$subhead Return Value$$
+The return value is zero if no error is detected.
+It is one (two) if $icode nx$$ ($icode ny$$) is not correct.
+
+$subhead Work Space$$
+The function uses a local array, with one element for each node in the
+$cref/graph/cpp_ad_graph/$$ corresponding to $icode fun$$,
+as its work space.
+This array is on the stack, so a function with a very large
+number of nodes may require a larger stack size.
+
+$head Restrictions$$
+The function must not contain $cref discrete$$ or
+$cref/atomic/atomic_three/$$ function calls.
+Comparison operators are not included in the source code;
+i.e., the $cref/conditional expressions/CondExp/$$,
+not the comparison operators, determine the flow of the calculation.
+The $cref PrintFor$$ operations are not included in the source code.
+Some possible $cref ADFun$$ operators cannot be converted; see
+$cref/missing operators/graph_op_enum/Missing Operators/$$.
+
+$head ok$$
+If the function does not satisfy these restrictions,
+an error is reported using $cref ErrorHandler$$,
+nothing is written to $icode os$$, and the return value $icode ok$$
+is false.
+Otherwise, $icode ok$$ is true.
+This check is done even when $code NDEBUG$$ is defined.
+
+$children%
+    example/graph/to_csrc.cpp
+%$$
+$head Example$$
+The file $cref to_csrc.cpp$$ is an example and test of this operation.
+
+$end
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+bool CppAD::ADFun<Base,RecBase>::to_csrc(
+    std::ostream& os, const std::string& function_name
+)
+// END_PROTOTYPE
+{   if( local::graph::op_name2enum.size() == 0 )
+    {   CPPAD_ASSERT_KNOWN( ! thread_alloc::in_parallel() ,
+            "call to set_operator_info in parallel mode"
+        );
+        local::graph::set_operator_info();
+    }
+    //
+    // graph corresponding to this function
+    cpp_graph graph_obj;
+    to_graph(graph_obj);
+    //
+    // write C source code to the stream
+    return local::graph::csrc_writer(os, graph_obj, function_name);
+}
+
+# endif
@@ -1160,6 +1160,13 @@ void CppAD::ADFun<Base,RecBase>::to_graph(
             }
             break;
 
+            // --------------------------------------------------------------
+            // CSkipOp:
+            case local::CSkipOp:
+            // conditional skips are not needed in the graph
+            itr.correct_before_increment();
+            break;
+
             // --------------------------------------------------------------
             // EndOp:
             case local::EndOp:
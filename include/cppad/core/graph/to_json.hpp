@@ -25,6 +25,9 @@ $begin to_json$$
 $spell
     Json
     cpp
+    std
+    ofstream
+    os
 $$
 
 $section Json AD Graph Corresponding to an ADFun Object$$
@@ -32,12 +35,16 @@ $section Json AD Graph Corresponding to an ADFun Object$$
 $head Syntax$$
 $codei%
     %json% = %fun%.to_json()
+    %fun%.to_json(%os%)
 %$$
 
 $head Prototype$$
 $srcthisfile%
     0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
 %$$
+$srcthisfile%
+    0%// BEGIN_STREAM_PROTOTYPE%// END_STREAM_PROTOTYPE%1
+%$$
 
 $head fun$$
 is the $cref/ADFun/adfun/$$ object.
@@ -46,6 +53,11 @@ $head json$$
 The return value of $icode json$$ is a
 $cref json_ad_graph$$ representation of the corresponding function.
 
+$head os$$
+The $cref json_ad_graph$$ representation of the corresponding function
+is written to this stream; e.g., an $code std::ofstream$$ for a file.
+This avoids storing the entire representation in a string.
+
 $head Base$$
 is the type corresponding to this $cref/ADFun/adfun/$$ object;
 i.e., its calculations are done using the type $icode Base$$.
@@ -92,5 +104,23 @@ std::string CppAD::ADFun<Base,RecBase>::to_json(void)
     //
     return json;
 }
+// BEGIN_STREAM_PROTOTYPE
+template <class Base, class RecBase>
+void CppAD::ADFun<Base,RecBase>::to_json(std::ostream& os)
+// END_STREAM_PROTOTYPE
+{   if( local::graph::op_name2enum.size() == 0 )
+    {   CPPAD_ASSERT_KNOWN( ! thread_alloc::in_parallel() ,
+            "call to set_operator_info in parallel mode"
+        );
+        local::graph::set_operator_info();
+    }
+    //
+    // graph corresponding to this function
+    cpp_graph graph_obj;
+    to_graph(graph_obj);
+    //
+    // write json to the stream
+    local::graph::json_writer(os, graph_obj);
+}
 
 # endif
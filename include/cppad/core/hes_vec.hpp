@@ -0,0 +1,235 @@
+# ifndef CPPAD_CORE_HES_VEC_HPP
+# define CPPAD_CORE_HES_VEC_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin hes_vec$$
+$spell
+    const
+    hv
+    vec
+    Taylor
+    cpp
+$$
+
+$section Hessian Times a Batch of Vectors: Easy Driver$$
+
+$head Syntax$$
+$icode%hv% = %f%.hes_vec(%x%, %w%, %v%)
+%$$
+$icode%hv% = %f%.hes_vec(%w%, %v%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_HES_VEC_X%// END_HES_VEC_X%1
+%$$
+$srcthisfile%
+    0%// BEGIN_HES_VEC%// END_HES_VEC%1
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+This routine computes the products
+$latex \[
+    H(x) v^{(k)}
+    \; , \;
+    H(x) = \dpow{2}{x} \sum_{i=0}^{m-1} w_i F_i (x)
+\] $$
+for a batch of vectors $latex v^{(k)}$$ without forming the Hessian.
+The zero order sweep at $icode x$$ is shared by all the vectors in
+the batch and can also be shared between calls; see
+$cref/zero order results/hes_vec/Zero Order Results/$$ below.
+
+$head Batch$$
+The vectors in a batch are processed one at a time;
+each product requires one first order forward sweep and one
+second order reverse sweep.
+A sweep that computes all the products in a batch at once would
+require a second order reverse sweep for multiple forward directions,
+which is not available.
+
+$head f$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$.
+After this call, $icode f$$ contains the zero order
+Taylor coefficients corresponding to the point where the
+Hessian is evaluated,
+the capacity for Taylor coefficients is two orders and
+one direction (see $cref capacity_order$$),
+and the first order coefficients are unspecified.
+
+$head x$$
+The size of this vector is $icode n$$, the dimension of the
+$cref/domain/seq_property/Domain/$$ space for $icode f$$.
+It specifies the point at which the Hessian is evaluated.
+If $icode x$$ is not present,
+the Hessian is evaluated at the point corresponding to the
+zero order Taylor coefficients stored in $icode f$$.
+
+$head w$$
+The size of this vector is $icode m$$, the dimension of the
+$cref/range/seq_property/Range/$$ space for $icode f$$.
+It specifies the weights that define $latex H(x)$$.
+
+$head v$$
+The size of this vector is $icode%K%*%n%$$ where $icode K$$ is
+the number of vectors in the batch (which must be greater than zero).
+For $icode%k% = 0, %...%, %K%-1%$$ and $icode%j% = 0, %...%, %n%-1%$$,
+$codei%
+    %v%[ %k% * %n% + %j% ]
+%$$
+is the $th j$$ component of $latex v^{(k)}$$.
+Note that, unlike the directions for $cref forward_dir$$,
+each vector is contiguous; i.e., the case $icode%K% = 1%$$
+is just a vector of length $icode n$$.
+
+$head hv$$
+The size of this vector is $icode%K%*%n%$$ and
+$codei%
+    %hv%[ %k% * %n% + %j% ]
+%$$
+is the $th j$$ component of $latex H(x) v^{(k)}$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head Zero Order Results$$
+If $icode x$$ is present, a zero order forward sweep is done at $icode x$$.
+Otherwise, the zero order Taylor coefficients stored in $icode f$$ are used;
+i.e., the results of the previous call to $code hes_vec$$ or
+$cref/f.Forward(0, x)/forward_zero/$$.
+In this case $cref/f.size_order()/size_order/$$ must be greater than zero;
+e.g., it is zero after the
+$cref/dynamic parameters/new_dynamic/$$ are changed.
+For example, a truncated Newton method can evaluate the objective using
+$icode%f%.Forward(0, %x%)%$$ and then call $icode%f%.hes_vec(%w%, %v%)%$$
+many times at the same $icode x$$ without repeating the zero order sweep.
+
+$head Example$$
+$children%
+    example/general/hes_vec.cpp
+%$$
+The file
+$cref hes_vec.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file hes_vec.hpp
+Hessian times a batch of vectors.
+*/
+
+/*!
+Compute the Hessian of a weighted sum of the range components
+times a batch of vectors.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param x
+is the argument value at which to evaluate the Hessian.
+
+\param w
+is the weighting vector for the range components.
+
+\param v
+is the batch of vectors, the k-th vector is v[k * n + j], j = 0, ..., n-1.
+
+\return
+the k-th product is returned as hv[k * n + j], j = 0, ..., n-1.
+*/
+// BEGIN_HES_VEC_X
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::hes_vec(
+    const BaseVector& x ,
+    const BaseVector& w ,
+    const BaseVector& v )
+// END_HES_VEC_X
+{   CPPAD_ASSERT_KNOWN(
+        size_t( x.size() ) == Domain(),
+        "hes_vec: size of x not equal domain dimension for f"
+    );
+    Forward(0, x);
+    return hes_vec(w, v);
+}
+
+/*!
+Compute the Hessian of a weighted sum of the range components
+times a batch of vectors at the point corresponding to the
+zero order Taylor coefficients stored in this ADFun object.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param w
+is the weighting vector for the range components.
+
+\param v
+is the batch of vectors, the k-th vector is v[k * n + j], j = 0, ..., n-1.
+
+\return
+the k-th product is returned as hv[k * n + j], j = 0, ..., n-1.
+*/
+// BEGIN_HES_VEC
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::hes_vec(
+    const BaseVector& w ,
+    const BaseVector& v )
+// END_HES_VEC
+{   // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    size_t n = Domain();
+    size_t m = Range();
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ > 0,
+        "hes_vec: the zero order Taylor coefficients are not stored"
+        "\nin this ADFun object."
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( w.size() ) == m,
+        "hes_vec: size of w not equal range dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        v.size() > 0 && size_t( v.size() ) % n == 0,
+        "hes_vec: size of v is not a positive multiple of domain dimension"
+    );
+    size_t K = size_t( v.size() ) / n;
+    //
+    // only keep zero order, capacity for two orders in one direction
+    num_order_taylor_ = 1;
+    capacity_order(2, 1);
+    //
+    // vectors that are reused for each element of the batch
+    BaseVector u(n), ddw(2 * n), hv(K * n);
+    //
+    for(size_t k = 0; k < K; ++k)
+    {   for(size_t j = 0; j < n; ++j)
+            u[j] = v[k * n + j];
+        Forward(1, u);
+        ddw = Reverse(2, w);
+        for(size_t j = 0; j < n; ++j)
+            hv[k * n + j] = ddw[j * 2 + 1];
+    }
+    return hv;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
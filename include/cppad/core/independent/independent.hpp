@@ -253,5 +253,92 @@ void Independent(ADVector &x)
     Independent(x, abort_op_index, record_compare, dynamic);
 }
 
+/*
+----------------------------------------------------------------------------
+$begin independent_all_hint$$
+$spell
+    op
+$$
+
+$section Independent: All Arguments and a Size Hint$$
+
+$head Purpose$$
+This implements $cref Independent$$ with all the possible arguments
+and a $cref/hint/Independent/hint/$$ for the size of the recording.
+
+$head Syntax$$
+$codei%Independent(
+    %x%, %abort_op_index%, %record_compare%, %dynamic%, %hint%
+)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_ALL_HINT%// END_ALL_HINT%1
+%$$
+
+$head hint$$
+is a function object with a previous recording of the same function.
+The memory for the new recording is reserved using the sizes of its
+recording.
+
+$head Other Arguments$$
+see $cref independent_all$$.
+
+$end
+*/
+// BEGIN_ALL_HINT
+template <class ADVector, class Base, class RecBase>
+void Independent(
+    ADVector&                   x              ,
+    size_t                      abort_op_index ,
+    bool                        record_compare ,
+    ADVector&                   dynamic        ,
+    const ADFun<Base, RecBase>& hint           )
+// END_ALL_HINT
+{   typedef typename ADVector::value_type ADBase;
+    Independent(x, abort_op_index, record_compare, dynamic);
+    ADBase::tape_ptr()->reserve(hint);
+}
+/*
+----------------------------------------------------------------------------
+$begin independent_x_hint$$
+$spell
+    op
+$$
+
+$section Independent: Default For abort_op_index, record_compare, dynamic$$
+
+$head Purpose$$
+This implements $cref Independent$$ with a
+$cref/hint/Independent/hint/$$ for the size of the recording and using
+$codei%
+    %abort_op_index% = 0
+    %record_compare% = true
+    %dynamic%        = %empty vector%
+%$$
+
+$head Syntax$$
+$codei%Independent(%x%, %hint%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_X_HINT%// END_X_HINT%1
+%$$
+
+$head Other Arguments$$
+see $cref independent_all_hint$$.
+
+$end
+*/
+// BEGIN_X_HINT
+template <class ADVector, class Base, class RecBase>
+void Independent(ADVector& x, const ADFun<Base, RecBase>& hint)
+// END_X_HINT
+{   size_t   abort_op_index = 0;
+    bool     record_compare = true;
+    ADVector dynamic(0); // empty vector
+    Independent(x, abort_op_index, record_compare, dynamic, hint);
+}
+
 } // END_CPPAD_NAMESPACE
 # endif
@@ -0,0 +1,362 @@
+# ifndef CPPAD_CORE_LEVEL_EVAL_HPP
+# define CPPAD_CORE_LEVEL_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin level_eval$$
+$spell
+    bool
+    const
+    VecAD
+    PrintFor
+    Taylor
+    eval
+    dw
+    std
+    num
+    alloc
+$$
+
+$section Zero Order Forward and First Order Reverse Using Multiple Threads$$
+
+$head Syntax$$
+$icode%ok% = %f%.prepare_level_eval()
+%$$
+$icode%y% = %f%.forward_level(%x%, %n_thread%)
+%$$
+$icode%dw% = %f%.reverse_level(%w%, %n_thread%)
+%$$
+$icode%n_level% = %f%.size_level()%$$
+
+$head Purpose$$
+Many functions are a sum of terms that do not depend on each other;
+e.g., the terms in a likelihood.
+The routines $cref/Forward/forward_zero/$$ and $cref/Reverse/reverse_one/$$
+evaluate the operations for such a function one after the other.
+The routine $code prepare_level_eval$$ divides the operations into levels.
+The level of an operation is zero if none of its arguments is a
+variable computed by another operation.
+Otherwise, it is one plus the maximum level of the operations that
+compute its variable arguments.
+The operations in a level do not depend on each other and
+the routines $code forward_level$$ and $code reverse_level$$
+divide each level among a team of threads.
+This is intended for a function that is evaluated many times,
+has a large number of operations, and has a small number of levels
+compared to its number of operations.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$
+for these routines (except $code size_level$$).
+
+$head prepare_level_eval$$
+This creates the
+$cref/pre-decoded operations/prepare_fast_eval/$$, if necessary,
+and the levels.
+The return value $icode ok$$ has prototype
+$codei%
+    bool %ok%
+%$$
+If it is false, the operation sequence contains an operation that is not
+supported by the pre-decoded operations
+($cref VecAD$$ operations, $cref atomic$$ function calls,
+or $cref PrintFor$$ operations)
+and the routines below use the corresponding single thread routine.
+The levels are discarded when the operation sequence
+for $icode f$$ changes.
+They are copied when $icode f$$ is assigned to another $code ADFun$$ object.
+
+$head n_thread$$
+This argument has prototype
+$codei%
+    size_t %n_thread%
+%$$
+and must be greater than zero.
+It is the number of threads used by the calculation
+(including the current thread).
+$list number$$
+If $icode%n_thread% == 1%$$,
+if $code prepare_level_eval$$ has not returned true,
+or if $cref/C++11/configure.hpp/CPPAD_USE_CPLUSPLUS_2011/$$ is not available,
+the corresponding single thread routine is used.
+$lnext
+The threads are created using $code std::thread$$.
+These routines must be called in sequential execution mode and
+$cref/thread_alloc::num_threads()/ta_num_threads/$$ must be one; i.e.,
+$cref/parallel_setup/ta_parallel_setup/$$ must not have been used
+to set up another multi-threading environment.
+These routines set up $code thread_alloc$$ for their threads
+and return it to single thread mode before they return
+(even if an exception is thrown).
+$lnext
+The routine $cref/parallel_ad<Base>()/parallel_ad/$$ must be called
+before these routines are called with $icode%n_thread% > 1%$$.
+$lnext
+If a thread throws an exception, the other threads run to completion
+and then the exception is thrown by the current thread.
+$lnext
+The $icode Base$$ operations must be thread safe; e.g.,
+$icode Base$$ cannot be $codei%AD<%Other%>%$$.
+The same holds for the $cref Discrete$$ functions used by $icode f$$.
+$lnext
+The threads wait for each other at the end of each level.
+Consecutive levels with only a few operations are evaluated
+by the current thread.
+$lend
+
+$head Cumulative Summation$$
+The $cref optimize$$ routine combines a sum of many terms into
+one cumulative summation operation.
+If such an operation has a large number of variable arguments,
+its arguments are divided among the threads.
+Thus the result of $code forward_level$$ may differ from
+$codei%%f%.Forward(0, %x%)%$$ by the rounding errors caused
+by adding the terms in a different order.
+
+$head forward_level$$
+The argument $icode x$$ has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and its size must be equal to $icode%n% = %f%.Domain()%$$.
+It specifies the point at which to evaluate $latex y = F(x)$$.
+The result $icode y$$ has prototype
+$codei%
+    %BaseVector% %y%
+%$$
+and its size is equal to $icode%m% = %f%.Range()%$$.
+
+$subhead Taylor Coefficients$$
+Upon return, the zero order Taylor coefficients for $icode f$$
+correspond to the point $icode x$$ and
+$cref size_order$$ is one; i.e., it is the same as after
+$codei%%f%.Forward(0, %x%)%$$.
+
+$subhead Comparisons$$
+The comparison operations are not evaluated by $code forward_level$$
+(unless it uses $codei%%f%.Forward(0, %x%)%$$);
+i.e., $cref compare_change$$ is not changed by this call.
+
+$head reverse_level$$
+The argument $icode w$$ has prototype
+$codei%
+    const %BaseVector%& %w%
+%$$
+and its size must be equal to $icode m$$.
+The result $icode dw$$ has prototype
+$codei%
+    %BaseVector% %dw%
+%$$
+and is equal to $codei%%f%.Reverse(1, %w%)%$$; i.e., the derivative of
+$latex w^\R{T} F(x)$$ at the point $icode x$$ corresponding to the
+zero order Taylor coefficients stored in $icode f$$.
+Each thread uses its own copy of the partial derivatives
+for all the variables;
+i.e., $icode n_thread$$ times $cref/size_var/seq_property/size_var/$$
+values of type $icode Base$$.
+If the previous zero order forward calculation skipped some operations
+(see $cref number_skip$$),
+$codei%%f%.Reverse(1, %w%)%$$ is used.
+
+$head size_level$$
+The result $icode n_level$$ has prototype
+$codei%
+    size_t %n_level%
+%$$
+If $code prepare_level_eval$$ returned true,
+it is the number of levels.
+Otherwise it is zero.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$children%
+    example/general/level_eval.cpp
+%$$
+$head Example$$
+The file $cref level_eval.cpp$$
+contains an example and test of these operations.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file level_eval.hpp
+Zero order forward and first order reverse mode using multiple threads.
+*/
+
+/*!
+Create the levels used by forward_level and reverse_level.
+
+\return
+is true if the operation sequence can be evaluated using the levels.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::prepare_level_eval(void)
+{   return local::sweep::level_setup(&play_);
+}
+
+/*!
+Zero order forward mode using multiple threads.
+
+\tparam BaseVector
+is a simple vector with elements of type Base.
+
+\param x
+is the value of the independent variables.
+
+\param n_thread
+is the number of threads to use.
+
+\return
+is the corresponding value of the dependent variables.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_level(
+    const BaseVector& x, size_t n_thread
+)
+{   // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "forward_level: size of x not equal Domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        n_thread > 0,
+        "forward_level: n_thread is zero"
+    );
+    bool use_level = n_thread > 1 && play_.level_start().size() > 0;
+# if ! CPPAD_USE_CPLUSPLUS_2011
+    use_level = false;
+# endif
+    if( ! use_level )
+        return Forward(0, x);
+    //
+    BaseVector y(m);
+# if CPPAD_USE_CPLUSPLUS_2011
+    // does taylor_ need more orders or fewer directions
+    if( (cap_order_taylor_ == 0) | (num_direction_taylor_ != 1) )
+    {   num_order_taylor_ = 0;
+        capacity_order(1, 1);
+    }
+    size_t C = cap_order_taylor_;
+    //
+    // the phantom variable and the independent variables
+    taylor_[0] = CppAD::numeric_limits<Base>::quiet_NaN();
+    for(size_t j = 0; j < n; ++j)
+        taylor_[ C * ind_taddr_[j] ] = x[j];
+    //
+    // pre-decoded operations do not use the conditional skip flags
+    if( cskip_op_any_ )
+    {   for(size_t i = 0; i < cskip_op_.size(); ++i)
+            cskip_op_[i] = false;
+        cskip_op_any_ = false;
+    }
+    //
+    local::sweep::level_forward0(&play_, n_thread, C, taylor_.data());
+    num_order_taylor_ = 1;
+    //
+    for(size_t i = 0; i < m; ++i)
+        y[i] = taylor_[ C * dep_taddr_[i] ];
+# endif
+    return y;
+}
+
+/*!
+First order reverse mode using multiple threads.
+
+\tparam BaseVector
+is a simple vector with elements of type Base.
+
+\param w
+is the weight for each of the dependent variables.
+
+\param n_thread
+is the number of threads to use.
+
+\return
+is the derivative of the weighted sum of the dependent variables
+with respect to the independent variables.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::reverse_level(
+    const BaseVector& w, size_t n_thread
+)
+{   // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "reverse_level: size of w not equal Range dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        n_thread > 0,
+        "reverse_level: n_thread is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ > 0,
+        "reverse_level: the zero order Taylor coefficients are not stored"
+        "\nin this ADFun object."
+    );
+    bool use_level = n_thread > 1 && play_.level_start().size() > 0;
+    use_level &= num_direction_taylor_ == 1;
+    use_level &= ! cskip_op_any_;
+# if ! CPPAD_USE_CPLUSPLUS_2011
+    use_level = false;
+# endif
+    if( ! use_level )
+        return Reverse(1, w);
+    //
+    BaseVector dw(n);
+# if CPPAD_USE_CPLUSPLUS_2011
+    // partials for thread zero are initialized here,
+    // the other threads initialize their own partials
+    local::pod_vector_maybe<Base> partial(n_thread * num_var_tape_);
+    for(size_t i_var = 0; i_var < num_var_tape_; ++i_var)
+        partial[i_var] = Base(0.0);
+    //
+    // set the dependent variable direction
+    // (use += because two dependent variables can point to same location)
+    for(size_t i = 0; i < m; ++i)
+        partial[ dep_taddr_[i] ] += w[i];
+    //
+    local::sweep::level_reverse(
+        &play_, n_thread, cap_order_taylor_, taylor_.data(), partial.data()
+    );
+    //
+    // sum the partials computed by each thread
+    for(size_t j = 0; j < n; ++j)
+    {   dw[j] = partial[ ind_taddr_[j] ];
+        for(size_t thread = 1; thread < n_thread; ++thread)
+            dw[j] += partial[ thread * num_var_tape_ + ind_taddr_[j] ];
+    }
+# endif
+    return dw;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
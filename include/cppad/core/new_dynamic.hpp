@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_NEW_DYNAMIC_HPP
 # define CPPAD_CORE_NEW_DYNAMIC_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -20,12 +20,15 @@ $spell
     cpp
     dyn
     ind
+    op
 $$
 
 $section Change the Dynamic Parameters$$
 
 $head Syntax$$
-$icode%f%.new_dynamic(%dynamic%)%$$
+$icode%f%.new_dynamic(%dynamic%)
+%$$
+$icode%f%.new_dynamic(%changed%, %value%)%$$
 
 $head Purpose$$
 Often one is only interested in computing derivatives with respect
@@ -61,11 +64,44 @@ in the call to $code Independent$$ that started
 the recording for $icode f$$; see
 $cref/size_dyn_ind/seq_property/size_dyn_ind/$$.
 
+$head changed$$
+This argument has prototype
+$codei%
+    const %SizeVector%& %changed%
+%$$
+(see $icode SizeVector$$ below).
+Each of its elements is less than
+$cref/size_dyn_ind/seq_property/size_dyn_ind/$$.
+It specifies the independent dynamic parameters that change;
+the other independent dynamic parameters keep their current values.
+
+$head value$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %value%
+%$$
+and its size is the same as $icode changed$$.
+For each $icode k$$, $icode%value%[%k%]%$$ is the new value for the
+independent dynamic parameter with index $icode%changed%[%k%]%$$.
+
+$subhead Efficiency$$
+This syntax only re-computes the dependent dynamic parameters
+that depend on the independent dynamic parameters that change.
+The first time it is used, it determines the dynamic parameter operators
+and the operators that use each dynamic parameter as an argument.
+This information is stored in $icode f$$ and discarded when
+the operation sequence for $icode f$$ changes.
+
 $head BaseVector$$
 The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
 $cref/elements of type/SimpleVector/Elements of Specified Type/$$
 $icode Base$$.
 
+$head SizeVector$$
+The type $icode SizeVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
 $head Taylor Coefficients$$
 The Taylor coefficients computed by previous calls to
 $cref/f.Forward/Forward/$$ are lost after this operation; including the
@@ -84,6 +120,7 @@ contains an example and test of this operation.
 $end
 */
 # include <cppad/local/sweep/dynamic.hpp>
+# include <cppad/local/sweep/dynamic_update.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
@@ -134,6 +171,61 @@ void ADFun<Base,RecBase>::new_dynamic(const BaseVector& dynamic)
     return;
 }
 
+/*!
+Change some of the independent dynamic parameters in this ADFun object
+
+\param changed
+is the index of the independent dynamic parameters that change.
+
+\param value
+is the new value for each of the independent dynamic parameters in changed.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+void ADFun<Base,RecBase>::new_dynamic(
+    const SizeVector& changed, const BaseVector& value
+)
+{   // check the vector types
+    CheckSimpleVector<size_t, SizeVector>();
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    size_t n_changed = size_t( changed.size() );
+    CPPAD_ASSERT_KNOWN(
+        size_t( value.size() ) == n_changed,
+        "f.new_dynamic: size of value not equal size of changed"
+    );
+    //
+    // determine the users of each dynamic parameter (if not already done)
+    if( ! play_.dyn_update_setup() )
+        local::sweep::dynamic_setup(&play_);
+    //
+    // set the new values for the independent dynamic parameters
+    local::pod_vector_maybe<Base>& all_par_vec( play_.all_par_vec() );
+    const local::pod_vector<addr_t>& dyn_ind2par_ind(
+        play_.dyn_ind2par_ind()
+    );
+    local::pod_vector<size_t> changed_dyn(n_changed);
+    for(size_t k = 0; k < n_changed; ++k)
+    {   CPPAD_ASSERT_KNOWN(
+            changed[k] < play_.num_dynamic_ind(),
+            "f.new_dynamic: an element of changed is >= f.size_dyn_ind()"
+        );
+        changed_dyn[k] = changed[k];
+        all_par_vec[ dyn_ind2par_ind[ changed[k] ] ] = value[k];
+    }
+    //
+    // set the dependent dynamic parameters that depend on the changes
+    RecBase not_used_rec_base;
+    local::sweep::dynamic_update(
+        &play_, n_changed, changed_dyn.data(), not_used_rec_base
+    );
+
+    // the existing Taylor coefficients are no longer valid
+    num_order_taylor_ = 0;
+
+    return;
+}
+
 
 } // END_CPPAD_NAMESPACE
 # endif
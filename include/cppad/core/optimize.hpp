@@ -327,6 +327,7 @@ void ADFun<Base,RecBase>::optimize(const std::string& options)
     // resize and initilaize conditional skip vector
     // (must use player size because it now has the recoreder information)
     cskip_op_.resize( play_.num_op_rec() );
+    cskip_op_any_ = true;
 
     // resize subgraph_info_
     subgraph_info_.resize(
@@ -32,6 +32,12 @@ in $cref/parallel/ta_in_parallel/$$ mode.
 In addition, if this routine is called after one is done using
 parallel mode, it will free extra memory used to keep track of
 the multiple $codei%AD<%Base%>%$$ tapes required for parallel execution.
+It must also be called before one of the following routines is used
+with more than one thread:
+$cref/sparse_jac/sparse_jac/n_thread/$$,
+$cref/sparse_hes/sparse_hes/n_thread/$$,
+$cref/for_jac_sparsity/for_jac_sparsity/n_thread/$$,
+$cref/forward_level, reverse_level/level_eval/n_thread/$$.
 
 $head Discussion$$
 By default, for each $codei%AD<%Base%>%$$ class there is only one
@@ -66,6 +72,7 @@ $end
 */
 
 # include <cppad/local/std_set.hpp>
+# include <cppad/local/color_thread.hpp>
 
 // BEGIN CppAD namespace
 namespace CppAD {
@@ -109,7 +116,9 @@ void parallel_ad(void)
     discrete<Base>::List();
     CheckSimpleVector< Base, CppAD::vector<Base> >();
     CheckSimpleVector< AD<Base>, CppAD::vector< AD<Base> > >();
-
+    //
+    // routines that use n_thread > 1 check that this routine was called
+    local::color_thread_parallel_ad<Base>() = true;
 }
 
 } // END CppAD namespace
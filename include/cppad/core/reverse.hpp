@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_REVERSE_HPP
 # define CPPAD_CORE_REVERSE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -158,21 +158,35 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
-    local::play::const_sequential_iterator play_itr = play_.end();
-    local::sweep::reverse(
-        q - 1,
-        n,
-        num_var_tape_,
-        &play_,
-        cap_order_taylor_,
-        taylor_.data(),
-        q,
-        Partial.data(),
-        cskip_op_.data(),
-        load_op2var_,
-        play_itr,
-        not_used_rec_base
-    );
+    // pre-decoded operations can only be used when no operations are skipped
+    bool use_fast = play_.fast_vec().size() > 0 && ! cskip_op_any_;
+    if( use_fast )
+    {   local::sweep::fast_reverse(
+            &play_,
+            q - 1,
+            cap_order_taylor_,
+            taylor_.data(),
+            q,
+            Partial.data()
+        );
+    }
+    else
+    {   local::play::const_sequential_iterator play_itr = play_.end();
+        local::sweep::reverse(
+            q - 1,
+            n,
+            num_var_tape_,
+            &play_,
+            cap_order_taylor_,
+            taylor_.data(),
+            q,
+            Partial.data(),
+            cskip_op_.data(),
+            load_op2var_,
+            play_itr,
+            not_used_rec_base
+        );
+    }
 
     // return the derivative values
     BaseVector value(n * q);
@@ -204,6 +218,158 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     return value;
 }
 
+/*!
+Use reverse mode to compute derivatives of forward mode Taylor coefficients
+for multiple weight directions.
+
+This is the same as Reverse(q, w) except that there are r different
+weight vectors and one reverse sweep is used for all of them.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param q
+is the number of the number of Taylor coefficients that are being
+differentiated (per variable).
+
+\param r
+is the number of weight directions.
+
+\param w
+is the weighting for each of the Taylor coefficients corresponding
+to dependent variables and each direction.
+If the argument w has size <tt>r * m * q</tt>,
+for \f$ \ell = 0 , \ldots , r-1 \f$,
+\f$ k = 0 , \ldots , q-1 \f$ and \f$ i = 0, \ldots , m-1 \f$,
+the weight \f$ w_i^{(k)} \f$ for direction \f$ \ell \f$ is
+<tt>w[ r * (i * q + k) + ell ]</tt>.
+If the argument w has size <tt>r * m</tt>,
+the weight \f$ w_i^{(q-1)} \f$ for direction \f$ \ell \f$ is
+<tt>w[ r * i + ell ]</tt> and the other weights are zero.
+
+\return
+Is a vector dw of size <tt>r * n * q</tt> such that
+<tt>dw[ r * (j * q + k) + ell ]</tt> is the value that
+<tt>Reverse(q, w_ell)[ j * q + k ]</tt> would return where
+w_ell is the weight vector corresponding to direction ell.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::Reverse(
+    size_t q, size_t r, const BaseVector &w)
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base;
+
+    // constants
+    const Base zero(0);
+
+    // number of independent variables
+    size_t n = ind_taddr_.size();
+
+    // number of dependent variables
+    size_t m = dep_taddr_.size();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        r > 0,
+        "Reverse(q, r, w): the number of directions r is zero."
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == r * m || size_t(w.size()) == (r * m * q),
+        "Reverse(q, r, w): w.size() is not equal r * m or r * m * q."
+    );
+    CPPAD_ASSERT_KNOWN(
+        q > 0,
+        "The first argument to Reverse must be greater than zero."
+    );
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ >= q,
+        "Less than q Taylor coefficients are currently stored"
+        " in this ADFun object."
+    );
+    // special case where multiple forward directions have been computed,
+    // but we are only using the one direction zero order results
+    if( (q == 1) & (num_direction_taylor_ > 1) )
+    {   num_order_taylor_ = 1;        // number of orders to copy
+        size_t c = cap_order_taylor_; // keep the same capacity setting
+        capacity_order(c, 1);
+    }
+    CPPAD_ASSERT_KNOWN(
+        num_direction_taylor_ == 1,
+        "Reverse mode for Forward(q, r, xq) with more than one direction"
+        "\n(r > 1) is not yet supported for q > 1."
+    );
+    bool last_order_only = size_t(w.size()) == r * m;
+
+    // initialize entire Partial matrix to zero
+    // (the partials for one variable and all directions are contiguous)
+    local::pod_vector_maybe<Base> Partial(num_var_tape_ * r * q);
+    for(size_t i = 0; i < num_var_tape_ * r * q; i++)
+        Partial[i] = zero;
+
+    // set the dependent variable directions
+    for(size_t i = 0; i < m; i++)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+        for(size_t ell = 0; ell < r; ell++)
+        {   size_t index = (dep_taddr_[i] * r + ell) * q;
+            if( last_order_only )
+                Partial[index + q - 1] += w[r * i + ell];
+            else
+            {   for(size_t k = 0; k < q; k++)
+                    Partial[index + k] = w[r * (i * q + k) + ell];
+            }
+        }
+    }
+
+    // evaluate the derivatives
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
+    local::play::const_sequential_iterator play_itr = play_.end();
+    local::sweep::reverse_dir(
+        q - 1,
+        n,
+        num_var_tape_,
+        &play_,
+        cap_order_taylor_,
+        taylor_.data(),
+        r,
+        q,
+        Partial.data(),
+        cskip_op_.data(),
+        load_op2var_,
+        play_itr,
+        not_used_rec_base
+    );
+
+    // return the derivative values
+    BaseVector value(r * n * q);
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_  );
+
+        // independent variable taddr equals its operator taddr
+        CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+
+        for(size_t ell = 0; ell < r; ell++)
+        {   size_t index = (ind_taddr_[j] * r + ell) * q;
+            // see Reverse Identity Theorem in Reverse(q, w)
+            for(size_t k = 0; k < q; k++)
+            {   if( last_order_only )
+                    value[r * (j * q + k) + ell] = Partial[index + q - 1 - k];
+                else
+                    value[r * (j * q + k) + ell] = Partial[index + k];
+            }
+        }
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(value) && check_for_nan_ ) ,
+        "dw = f.Reverse(q, r, w): has a nan,\n"
+        "but none of its Taylor coefficents are nan."
+    );
+
+    return value;
+}
+
 
 } // END_CPPAD_NAMESPACE
 # endif
@@ -0,0 +1,200 @@
+# ifndef CPPAD_CORE_SLOT_EVAL_HPP
+# define CPPAD_CORE_SLOT_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin slot_eval$$
+$spell
+    bool
+    const
+    VecAD
+    PrintFor
+    Taylor
+    taylor
+$$
+
+$section Zero Order Forward Mode Using Less Memory$$
+
+$head Syntax$$
+$icode%ok% = %f%.prepare_slot_eval()
+%$$
+$icode%y% = %f%.forward_slot(%x%)
+%$$
+$icode%s% = %f%.size_slot()%$$
+
+$head Purpose$$
+Zero order forward mode $cref/f.Forward(0, x)/forward_zero/$$
+stores the value of every variable in the operation sequence
+so that they can be used by subsequent calls to forward and reverse mode.
+If only the value $latex y = F(x)$$ is needed,
+most of these values are only used by a few operations
+that come soon after the operation that computes them.
+The routine $code prepare_slot_eval$$ determines the last operation that
+uses each variable and assigns the variables to a smaller set of slots,
+so that a slot is re-used once its variable is no longer needed.
+The routine $code forward_slot$$ then evaluates $latex F(x)$$ using
+one value per slot, which uses much less memory bandwidth
+for large operation sequences.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$
+for $code prepare_slot_eval$$ and $code forward_slot$$.
+
+$head prepare_slot_eval$$
+This creates the
+$cref/pre-decoded operations/prepare_fast_eval/$$, if necessary,
+and a copy of them that uses slot indices.
+The return value $icode ok$$ has prototype
+$codei%
+    bool %ok%
+%$$
+If it is false, the operation sequence contains an operation that is not
+supported by the pre-decoded operations
+($cref VecAD$$ operations, $cref atomic$$ function calls,
+or $cref PrintFor$$ operations)
+and $code forward_slot$$ uses $codei%%f%.Forward(0, %x%)%$$.
+The slot indices are discarded when the operation sequence
+for $icode f$$ changes.
+They are copied when $icode f$$ is assigned to another $code ADFun$$ object.
+
+$head forward_slot$$
+
+$subhead x$$
+The argument $icode x$$ has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+(see $icode BaseVector$$ below)
+and its size must be equal to $icode%n% = %f%.Domain()%$$.
+It specifies the point at which to evaluate $latex F(x)$$.
+
+$subhead y$$
+The result $icode y$$ has prototype
+$codei%
+    %BaseVector% %y%
+%$$
+its size is equal to $icode%m% = %f%.Range()%$$,
+and its value is $latex F(x)$$.
+
+$subhead Taylor Coefficients$$
+If $code prepare_slot_eval$$ returned true,
+$code forward_slot$$ does not change the Taylor coefficients stored
+in $icode f$$; e.g., $cref size_order$$ is the same before and after
+the call.
+Thus it cannot be followed by a higher order forward mode or reverse mode
+calculation that uses the point $icode x$$.
+
+$subhead Comparisons$$
+The comparison operations are not evaluated by $code forward_slot$$;
+i.e., $cref compare_change$$ is not changed by this call.
+
+$subhead Dynamic Parameters$$
+The current value of the $cref/dynamic/new_dynamic/$$ parameters is used.
+
+$head size_slot$$
+The result $icode s$$ has prototype
+$codei%
+    size_t %s%
+%$$
+If $code prepare_slot_eval$$ returned true,
+it is the number of slots used by $code forward_slot$$; i.e.,
+the number of $icode Base$$ values it uses for temporary storage.
+This is less than or equal to $cref/size_var/seq_property/size_var/$$.
+Otherwise it is zero.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+The routine $cref CheckSimpleVector$$ will generate an error message
+if this is not the case.
+
+$children%
+    example/general/slot_eval.cpp
+%$$
+$head Example$$
+The file $cref slot_eval.cpp$$
+contains an example and test of these operations.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file slot_eval.hpp
+Zero order forward mode that re-uses the memory for variables that are
+no longer needed.
+*/
+
+/*!
+Create the slot evaluation instructions used by forward_slot.
+
+\return
+is true if the operation sequence can be evaluated using the
+slot evaluation instructions.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::prepare_slot_eval(void)
+{   return local::sweep::slot_setup(&play_, ind_taddr_.size(), dep_taddr_);
+}
+
+/*!
+Zero order forward mode that only computes the dependent variable values.
+
+\tparam BaseVector
+is a simple vector with elements of type Base.
+
+\param x
+is the value of the independent variables.
+
+\return
+is the corresponding value of the dependent variables.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_slot(const BaseVector& x)
+{   // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "forward_slot: size of x not equal Domain dimension for f"
+    );
+    if( play_.num_slot() == 0 )
+        return Forward(0, x);
+    //
+    // slot[0] corresponds to the phantom variable and slot[j+1]
+    // to the j-th independent variable
+    local::pod_vector_maybe<Base> slot( play_.num_slot() );
+    slot[0] = CppAD::numeric_limits<Base>::quiet_NaN();
+    for(size_t j = 0; j < n; ++j)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == j + 1 );
+        slot[j + 1] = x[j];
+    }
+    local::sweep::slot_forward0(&play_, slot.data());
+    //
+    BaseVector y(m);
+    const local::pod_vector<addr_t>& slot_dep( play_.slot_dep() );
+    for(size_t i = 0; i < m; ++i)
+        y[i] = slot[ slot_dep[i] ];
+    return y;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -33,7 +33,7 @@ $section Computing Sparse Hessians$$
 
 $head Syntax$$
 $icode%n_sweep% = %f%.sparse_hes(
-    %x%, %w%, %subset%, %pattern%, %coloring%, %work%
+    %x%, %w%, %subset%, %pattern%, %coloring%, %work%, %n_thread%
 )%$$
 
 $head Purpose$$
@@ -152,6 +152,22 @@ $subhead cppad.general$$
 This is the same as the sparse Jacobian
 $cref/cppad/sparse_jac/coloring/cppad/$$ method
 which does not take advantage of symmetry.
+The $cref/ordering/sparse_jac/coloring/Ordering/$$ can be specified
+using $codei%cppad.general.%ordering%$$; e.g.,
+$code cppad.general.smallest_last$$.
+
+$subhead cppad.star$$
+This is a star coloring of the adjacency graph for the Hessian;
+i.e., adjacent rows have different colors and
+every path of four rows uses at least three colors.
+It takes advantage of symmetry and
+often requires fewer sweeps than $code cppad.symmetric$$
+when the Hessian has a band or block structure.
+The rows are colored in smallest last order.
+Other orderings can be specified
+using $codei%cppad.star.%ordering%$$; e.g., $code cppad.star.random$$.
+(Acyclic coloring, which can require even fewer sweeps,
+would need recovery by substitution and is not provided.)
 
 $subhead colpack.symmetric$$
 If $cref colpack_prefix$$ was specified on the
@@ -190,6 +206,22 @@ for $icode f$$ and the sparsity pattern in $icode subset$$ are the same.
 If either of these values change, use $icode%work%.clear()%$$ to
 empty this structure.
 
+$head n_thread$$
+This optional argument has prototype
+$codei%
+    size_t %n_thread%
+%$$
+and must be greater than zero.
+If it is not present, the value one is used.
+If $icode n_thread$$ is greater than one,
+the colors are divided among $icode n_thread$$ threads
+and each thread uses its own memory for the first order Taylor coefficients
+and the second order partial derivatives.
+The zero order forward sweep is done by the current thread and
+the information in $icode work$$ is shared by all the threads.
+The other conditions for using multiple threads are the same as for
+$cref/sparse_jac/sparse_jac/n_thread/$$.
+
 $head n_sweep$$
 The return value $icode n_sweep$$ has prototype
 $codei%
@@ -236,6 +268,7 @@ $end
 # include <cppad/local/sparse/internal.hpp>
 # include <cppad/local/color_general.hpp>
 # include <cppad/local/color_symmetric.hpp>
+# include <cppad/local/color_thread.hpp>
 
 /*!
 \file sparse_hes.hpp
@@ -271,6 +304,237 @@ class sparse_hes_work {
         }
 };
 // ----------------------------------------------------------------------------
+namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+Information shared by the threads that evaluate the colors
+for a sparse Hessian; see sparse_hes_thread_worker.
+*/
+template <class Base>
+struct sparse_hes_thread_info {
+    /// number of independent variables
+    size_t                    n;
+    /// number of dependent variables
+    size_t                    m;
+    /// number of variables in the recording
+    size_t                    num_var;
+    /// number of colors that have elements in the subset
+    size_t                    n_group;
+    /// number of threads
+    size_t                    n_thread;
+    /// the operation sequence
+    const player<Base>*       play;
+    /// taylor[i] is the zero order Taylor coefficient for the i-th variable
+    const Base*               taylor;
+    /// conditional skip flags from the zero order forward sweep
+    const bool*               cskip_op;
+    /// variable index for each load instruction
+    const pod_vector<addr_t>* load_op2var;
+    /// variable index for each independent variable
+    const size_t*             ind_taddr;
+    /// variable index for each dependent variable
+    const size_t*             dep_taddr;
+    /// weights for the dependent variables
+    const Base*               w;
+    /// color for each column of the Hessian
+    const size_t*             color;
+    /// group_color[g] is the color corresponding to group g
+    const size_t*             group_color;
+    /// group_begin[g] is the first element in color order for group g
+    const size_t*             group_begin;
+    /// row for each element in color order
+    const size_t*             elem_row;
+    /// Hessian value for each element in color order
+    Base*                     elem_val;
+};
+/*!
+Evaluate the colors that correspond to one thread.
+
+\tparam Base
+base type for the operation sequence.
+
+\tparam RecBase
+base type used for recording operation sequences.
+
+\param thread [in]
+the groups g with g % n_thread == thread are computed by this call.
+
+\param void_info [in,out]
+is a pointer to the corresponding sparse_hes_thread_info<Base> object.
+The elements of elem_val corresponding to the groups for this thread
+are set by this call.
+*/
+template <class Base, class RecBase>
+void sparse_hes_thread_worker(size_t thread, void* void_info)
+{   const sparse_hes_thread_info<Base>& info =
+        *static_cast< sparse_hes_thread_info<Base>* >(void_info);
+    RecBase not_used_rec_base;
+    //
+    Base zero(0.0);
+    Base one(1.0);
+    size_t num_var = info.num_var;
+    //
+    // Taylor coefficients and partials for this thread
+    pod_vector_maybe<Base> taylor(num_var * 2), partial(num_var * 2);
+    //
+    for(size_t g = thread; g < info.n_group; g += info.n_thread)
+    {   size_t ell = info.group_color[g];
+        //
+        // first order forward in the direction for this color
+        for(size_t i = 0; i < num_var; i++)
+        {   taylor[i * 2 + 0] = info.taylor[i];
+            taylor[i * 2 + 1] = zero;
+        }
+        for(size_t j = 0; j < info.n; j++)
+        {   if( info.color[j] == ell )
+                taylor[ info.ind_taddr[j] * 2 + 1 ] = one;
+        }
+        size_t q = 1;
+        size_t r = 1;
+        size_t J = 2;
+        sweep::forward2(info.play, q, r, info.n, num_var, J,
+            taylor.data(), info.cskip_op, *info.load_op2var,
+            not_used_rec_base
+        );
+        //
+        // second order reverse for w^T F(x)
+        for(size_t i = 0; i < num_var * 2; i++)
+            partial[i] = zero;
+        for(size_t i = 0; i < info.m; i++)
+            partial[ info.dep_taddr[i] * 2 + 1 ] += info.w[i];
+        size_t d = 1;
+        size_t K = 2;
+        play::const_sequential_iterator play_itr = info.play->end();
+        sweep::reverse_dir(d, info.n, num_var, info.play, J,
+            taylor.data(), r, K, partial.data(), info.cskip_op,
+            *info.load_op2var, play_itr, not_used_rec_base
+        );
+        //
+        // set the elements of the Hessian for this color
+        // (partial derivative with respect to zero order coefficients)
+        for(size_t k = info.group_begin[g]; k < info.group_begin[g+1]; k++)
+        {   size_t index = info.ind_taddr[ info.elem_row[k] ] * 2 + 0;
+            info.elem_val[k] = partial[index];
+        }
+    }
+}
+} // END_CPPAD_LOCAL_NAMESPACE
+// ----------------------------------------------------------------------------
+/*!
+Evaluate the colors for a sparse Hessian using multiple threads.
+
+The zero order Taylor coefficients must correspond to the point at
+which the Hessian is evaluated.
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+
+\param w
+weights for the dependent variables.
+
+\param n_color
+number of colors.
+
+\param n_thread
+number of threads; see color_thread_run.
+
+\param row
+row indices for the elements of the subset
+(some may be reflected by symmetric coloring algorithms).
+
+\param col
+column indices for the elements of the subset
+(some may be reflected by symmetric coloring algorithms).
+
+\param color
+color for each column as computed by sparse_hes.
+
+\param order
+indices that sort the elements of subset in color order.
+
+\param subset
+On input, its sparsity pattern specifies the elements to compute.
+Upon return, its values are the corresponding Hessian values.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+void ADFun<Base,RecBase>::sparse_hes_thread(
+    const BaseVector&                    w         ,
+    size_t                               n_color   ,
+    size_t                               n_thread  ,
+    const vector<size_t>&                row       ,
+    const vector<size_t>&                col       ,
+    const vector<size_t>&                color     ,
+    const vector<size_t>&                order     ,
+    sparse_rcv<SizeVector, BaseVector>&  subset    )
+{   size_t m = dep_taddr_.size();
+    size_t K = subset.nnz();
+    //
+    // subset elements in color order
+    local::pod_vector<size_t>     elem_row(K);
+    local::pod_vector_maybe<Base> elem_val(K);
+    for(size_t k = 0; k < K; k++)
+        elem_row[k] = row[ order[k] ];
+    //
+    // colors that have elements in the subset
+    // (colpack may return colors that are not used)
+    local::pod_vector<size_t> group_color, group_begin;
+    size_t k = 0;
+    while( k < K )
+    {   size_t ell = color[ col[ order[k] ] ];
+        CPPAD_ASSERT_UNKNOWN( ell < n_color );
+        group_color.push_back(ell);
+        group_begin.push_back(k);
+        while( k < K && color[ col[ order[k] ] ] == ell )
+            ++k;
+    }
+    group_begin.push_back(K);
+    size_t n_group = group_color.size();
+    //
+    // zero order Taylor coefficients for all the variables
+    size_t stride = (cap_order_taylor_ - 1) * num_direction_taylor_ + 1;
+    local::pod_vector_maybe<Base> taylor(num_var_tape_);
+    for(size_t i = 0; i < num_var_tape_; i++)
+        taylor[i] = taylor_[i * stride];
+    //
+    // weights
+    local::pod_vector_maybe<Base> weight(m);
+    for(size_t i = 0; i < m; i++)
+        weight[i] = w[i];
+    //
+    local::sparse_hes_thread_info<Base> info;
+    info.n           = ind_taddr_.size();
+    info.m           = m;
+    info.num_var     = num_var_tape_;
+    info.n_group     = n_group;
+    info.n_thread    = n_thread;
+    info.play        = &play_;
+    info.taylor      = taylor.data();
+    info.cskip_op    = cskip_op_.data();
+    info.load_op2var = &load_op2var_;
+    info.ind_taddr   = ind_taddr_.data();
+    info.dep_taddr   = dep_taddr_.data();
+    info.w           = weight.data();
+    info.color       = color.data();
+    info.group_color = group_color.data();
+    info.group_begin = group_begin.data();
+    info.elem_row    = elem_row.data();
+    info.elem_val    = elem_val.data();
+    //
+    local::color_thread_run<Base>(
+        n_thread, local::sparse_hes_thread_worker<Base, RecBase>, &info
+    );
+    //
+    // store results in subset
+    for(k = 0; k < K; k++)
+        subset.set( order[k], elem_val[k] );
+}
+// ----------------------------------------------------------------------------
 /*!
 Calculate sparse Hessians using forward mode
 
@@ -304,8 +568,9 @@ where m is number of dependent variables in f.
 
 \param coloring
 determines which coloring algorithm is used.
-This must be cppad.symmetric, cppad.general, colpack.symmetic,
-or colpack.star.
+This must be cppad.symmetric, cppad.general, cppad.star, colpack.symmetic,
+or colpack.star. The cppad.general and cppad.star methods may be followed
+by a "." and an ordering; see color_order_method.
 
 \param work
 this structure must be empty, or contain the information stored
@@ -313,6 +578,9 @@ by a previous call to sparse_hes.
 The previous call must be for the same ADFun object f
 and the same subset.
 
+\param n_thread
+number of threads used to evaluate the colors.
+
 \return
 This is the number of first order forward
 (and second order reverse) sweeps used to compute thhe Hessian.
@@ -325,9 +593,14 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     sparse_rcv<SizeVector , BaseVector>& subset   ,
     const sparse_rc<SizeVector>&         pattern  ,
     const std::string&                   coloring ,
-    sparse_hes_work&                     work     )
+    sparse_hes_work&                     work     ,
+    size_t                               n_thread )
 {   size_t n = Domain();
     //
+    CPPAD_ASSERT_KNOWN(
+        n_thread > 0,
+        "sparse_hes: n_thread is zero"
+    );
     CPPAD_ASSERT_KNOWN(
         subset.nr() == n,
         "sparse_hes: subset.nr() not equal domain dimension for f"
@@ -430,8 +703,15 @@ size_t ADFun<Base,RecBase>::sparse_hes(
         // execute coloring algorithm
         // (we are using transpose becasue coloring groups rows, not columns)
         color.resize(n);
-        if( coloring == "cppad.general" )
-            local::color_general_cppad(internal_pattern, col, row, color);
+        // (ordering is the default for cppad.general and cppad.star)
+        local::color_order_enum general = local::color_order_natural;
+        local::color_order_enum star    = local::color_order_smallest_last;
+        if( local::color_order_method(coloring, "cppad.general", general) )
+            local::color_general_cppad(
+                internal_pattern, col, row, color, general
+            );
+        else if( local::color_order_method(coloring, "cppad.star", star) )
+            local::color_star_cppad(internal_pattern, col, row, color, star);
         else if( coloring == "cppad.symmetric" )
             local::color_symmetric_cppad(internal_pattern, col, row, color);
         else if( coloring == "colpack.general" )
@@ -485,6 +765,19 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     for(size_t k = 0; k < K; k++)
         subset.set(k, zero);
     //
+    // check for case where colors are evaluated by multiple threads
+    n_thread = std::min(n_thread, n_color);
+    for(size_t i_op = 0; i_op < play_.num_op_rec() && n_thread > 1; ++i_op)
+    {   if( play_.GetOp(i_op) == local::AFunOp )
+            n_thread = 1;
+    }
+    if( n_thread > 1 )
+    {   sparse_hes_thread(
+            w, n_color, n_thread, row, col, color, order, subset
+        );
+        return n_color;
+    }
+    //
     // direction vector for calls to first order forward
     BaseVector dx(n);
     //
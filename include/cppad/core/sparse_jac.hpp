@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_SPARSE_JAC_HPP
 # define CPPAD_CORE_SPARSE_JAC_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -28,18 +28,32 @@ $spell
     Cppad
     Colpack
     cmake
+    csr
+    csc
+    rcv
+    ptr
+    ind
 $$
 
 $section Computing Sparse Jacobians$$
 
 $head Syntax$$
 $icode%n_color% = %f%.sparse_jac_for(
-    %group_max%, %x%, %subset%, %pattern%, %coloring%, %work%
+    %group_max%, %x%, %subset%, %pattern%, %coloring%, %work%, %n_thread%
 )
 %$$
 $icode%n_color% = %f%.sparse_jac_rev(
     %x%, %subset%, %pattern%, %coloring%, %work%
 )%$$
+$icode%n_color% = %f%.sparse_jac_rev(
+    %group_max%, %x%, %subset%, %pattern%, %coloring%, %work%, %n_thread%
+)%$$
+$icode%n_color% = %f%.sparse_jac_for(%group_max%, %x%,
+    %subset_rc%, %pattern%, %coloring%, %work%, %layout%, %val%, %n_thread%
+)%$$
+$icode%n_color% = %f%.sparse_jac_rev(%group_max%, %x%,
+    %subset_rc%, %pattern%, %coloring%, %work%, %layout%, %val%, %n_thread%
+)%$$
 
 $head Purpose$$
 We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
@@ -89,15 +103,19 @@ $codei%
 %$$
 and must be greater than zero.
 It specifies the maximum number of colors to group during
-a single forward sweep.
+a single forward (reverse) sweep.
 If a single color is in a group,
 a single direction for of first order forward mode
-$cref forward_one$$ is used for each color.
+$cref forward_one$$ (reverse mode $cref reverse_one$$)
+is used for each color.
 If multiple colors are in a group,
 the multiple direction for of first order forward mode
-$cref forward_dir$$ is used with one direction for each color.
+$cref forward_dir$$ (reverse mode $cref reverse_dir$$)
+is used with one direction for each color.
 This uses separate memory for each direction (more memory),
 but my be significantly faster.
+If $icode group_max$$ is not present in the call to $code sparse_jac_rev$$,
+the value one is used.
 
 $head x$$
 This argument has prototype
@@ -123,6 +141,60 @@ of the Jacobian.
 All of the row, column pairs in $icode subset$$ must also appear in
 $icode pattern$$; i.e., they must be possibly non-zero.
 
+$head subset_rc$$
+This argument has prototype
+$codei%
+    const sparse_rc<%SizeVector%>& %subset_rc%
+%$$
+It is the same as the sparsity pattern for $icode subset$$; i.e.,
+$icode%subset%.pat()%$$.
+The Jacobian values are returned in $icode val$$ instead of
+the value vector for $icode subset$$.
+
+$head layout$$
+This argument has prototype
+$codei%
+    const std::string& %layout%
+%$$
+It specifies the order of the Jacobian values in $icode val$$
+and must be one of the following:
+
+$subhead rcv$$
+The same order as the row and column vectors in $icode subset_rc$$.
+
+$subhead csr$$
+Compressed sparse row order; i.e.,
+the order of the column indices $icode col_ind$$ in
+$codei%
+    %subset_rc%.get_csr(%row_ptr%, %col_ind%, %row_major%)
+%$$
+see $cref/get_csr/sparse_rc/get_csr/$$.
+
+$subhead csc$$
+Compressed sparse column order; i.e.,
+the order of the row indices $icode row_ind$$ in
+$codei%
+    %subset_rc%.get_csc(%col_ptr%, %row_ind%, %col_major%)
+%$$
+see $cref/get_csc/sparse_rc/get_csc/$$.
+
+$head val$$
+This argument has prototype
+$codei%
+    %BaseVector%& %val%
+%$$
+If its input size is not $icode%subset_rc%.nnz()%$$ it is resized.
+Upon return it contains the Jacobian values in the order specified
+by $icode layout$$.
+Thus, the arrays used by a linear solver can be passed directly
+to this routine; i.e.,
+the row and column indices for compressed format are computed once
+and the Jacobian values are written directly to $icode val$$
+without being stored in a $code sparse_rcv$$ object first.
+The indices that map the elements of $icode subset_rc$$ to the
+$icode layout$$ order are stored in $icode work$$ and only recomputed
+when $icode layout$$ changes or $icode work$$ is empty.
+
 $head pattern$$
 This argument has prototype
 $codei%
@@ -146,6 +218,37 @@ after the $icode work$$ constructor or $icode%work%.clear()%$$.
 
 $subhead cppad$$
 This uses a general purpose coloring algorithm written for Cppad.
+The rows (reverse) or columns (forward) are colored in their natural order.
+
+$subhead Ordering$$
+The order in which the rows or columns are colored can change the number
+of colors, and hence the number of sweeps.
+You can set $icode coloring$$ to $codei%cppad.%ordering%$$ where
+$icode ordering$$ is one of the following:
+$table
+$code natural$$ $cnext
+    increasing index order; i.e., the same as $code cppad$$
+$rnext
+$code largest_first$$ $cnext
+    decreasing number of conflicts with other rows (columns)
+$rnext
+$code smallest_last$$ $cnext
+    repeatedly remove the row (column) with the fewest conflicts
+    among those that remain and color in the reverse of that order
+$rnext
+$code incidence_degree$$ $cnext
+    next is the row (column) that conflicts with the most
+    that are already colored
+$rnext
+$code random$$ $cnext
+    the best of $code smallest_last$$ and ten pseudo random orders
+    (the same for every call)
+$tend
+Two rows (columns) conflict if they cannot be computed during the same sweep.
+Note that these orderings form the graph of conflicts,
+which requires more memory than the $code cppad$$ method.
+For example, a Jacobian with a few dense rows and a band structure
+otherwise may require fewer colors using $code cppad.smallest_last$$.
 
 $subhead colpack$$
 If $cref colpack_prefix$$ is specified on the
@@ -171,13 +274,55 @@ for $icode f$$ and the sparsity pattern in $icode subset$$ are the same.
 If any of these values change, use $icode%work%.clear()%$$ to
 empty this structure.
 
+$head n_thread$$
+This optional argument has prototype
+$codei%
+    size_t %n_thread%
+%$$
+and must be greater than zero.
+If it is not present, the value one is used.
+If $icode n_thread$$ is greater than one,
+the color groups (see $icode group_max$$ above) are divided among
+$icode n_thread$$ threads and each thread uses its own memory
+for the first order Taylor coefficients (partial derivatives).
+The zero order forward sweep is done by the current thread and
+the information in $icode work$$ is shared by all the threads.
+$list number$$
+The threads are created using $code std::thread$$.
+If $cref/C++11/configure.hpp/CPPAD_USE_CPLUSPLUS_2011/$$ is not available,
+the color groups are computed sequentially by the current thread.
+$lnext
+This routine must be called in sequential execution mode and
+$cref/thread_alloc::num_threads()/ta_num_threads/$$ must be one; i.e.,
+$cref/parallel_setup/ta_parallel_setup/$$ must not have been used
+to set up another multi-threading environment.
+This routine sets up $code thread_alloc$$ for its threads
+and returns it to single thread mode before it returns
+(even if an exception is thrown).
+$lnext
+The routine $cref/parallel_ad<Base>()/parallel_ad/$$ must be called
+before this routine is called with $icode%n_thread% > 1%$$.
+$lnext
+If a thread throws an exception, the other threads run to completion
+and then the exception is thrown by the current thread.
+$lnext
+If $icode f$$ contains $cref atomic$$ function calls,
+or if $icode%n_thread% == 1%$$,
+all the computations are done by the current thread.
+$lnext
+The $icode Base$$ operations must be thread safe; e.g.,
+$icode Base$$ cannot be $codei%AD<%Other%>%$$.
+$lnext
+Using more threads than there are color groups does not help.
+$lend
+
 $head n_color$$
 The return value $icode n_color$$ has prototype
 $codei%
     size_t %n_color%
 %$$
 If $code sparse_jac_for$$ ($code sparse_jac_rev$$) is used,
-$icode n_color$$ is the number of first order forward directions
+$icode n_color$$ is the number of first order forward (reverse) directions
 used to compute the requested Jacobian values.
 It is also the number of colors determined by the coloring method
 mentioned above.
@@ -185,7 +330,6 @@ This is proportional to the total computational work,
 not counting the zero order forward sweep,
 or combining multiple columns (rows) into a single sweep.
 Note that if $icode%group_max% == 1%$$,
-or if we are using $code sparse_jac_rev$$,
 $icode n_color$$ is equal to the number of sweeps.
 
 $head Uses Forward$$
@@ -213,6 +357,7 @@ $end
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/sparse/internal.hpp>
 # include <cppad/local/color_general.hpp>
+# include <cppad/local/color_thread.hpp>
 # include <cppad/utility/vector.hpp>
 
 /*!
@@ -230,6 +375,10 @@ class sparse_jac_work {
         CppAD::vector<size_t> order;
         /// results of the coloring algorithm
         CppAD::vector<size_t> color;
+        /// layout for the Jacobian values that val_index corresponds to
+        std::string           layout;
+        /// index in the Jacobian values for each element of subset
+        CppAD::vector<size_t> val_index;
         //
         /// constructor
         sparse_jac_work(void)
@@ -239,11 +388,348 @@ class sparse_jac_work {
         void clear(void)
         {   order.clear();
             color.clear();
+            layout.clear();
+            val_index.clear();
+        }
+};
+// ----------------------------------------------------------------------------
+namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+Information shared by the threads that evaluate the color groups
+for a sparse Jacobian; see sparse_jac_thread_worker.
+*/
+template <class Base>
+struct sparse_jac_thread_info {
+    /// is this forward mode (true) or reverse mode (false)
+    bool                      forward;
+    /// number of independent variables
+    size_t                    n;
+    /// number of dependent variables
+    size_t                    m;
+    /// number of variables in the recording
+    size_t                    num_var;
+    /// maximum number of colors in a group
+    size_t                    group_max;
+    /// number of colors
+    size_t                    n_color;
+    /// number of color groups
+    size_t                    n_group;
+    /// number of threads
+    size_t                    n_thread;
+    /// the operation sequence
+    const player<Base>*       play;
+    /// taylor[i] is the zero order Taylor coefficient for the i-th variable
+    const Base*               taylor;
+    /// conditional skip flags from the zero order forward sweep
+    const bool*               cskip_op;
+    /// variable index for each load instruction
+    const pod_vector<addr_t>* load_op2var;
+    /// variable index for each independent variable
+    const size_t*             ind_taddr;
+    /// variable index for each dependent variable
+    const size_t*             dep_taddr;
+    /// color for each column (forward) or row (reverse)
+    const size_t*             color;
+    /// group_begin[g] is the first element in color order for group g
+    const size_t*             group_begin;
+    /// color for each element in color order
+    const size_t*             elem_color;
+    /// row (forward) or column (reverse) for each element in color order
+    const size_t*             elem_index;
+    /// Jacobian value for each element in color order
+    Base*                     elem_val;
+};
+/*!
+Evaluate the color groups that correspond to one thread.
+
+\tparam Base
+base type for the operation sequence.
+
+\tparam RecBase
+base type used for recording operation sequences.
+
+\param thread [in]
+the color groups g with g % n_thread == thread are computed by this call.
+
+\param void_info [in,out]
+is a pointer to the corresponding sparse_jac_thread_info<Base> object.
+The elements of elem_val corresponding to the color groups for this thread
+are set by this call.
+*/
+template <class Base, class RecBase>
+void sparse_jac_thread_worker(size_t thread, void* void_info)
+{   const sparse_jac_thread_info<Base>& info =
+        *static_cast< sparse_jac_thread_info<Base>* >(void_info);
+    RecBase not_used_rec_base;
+    //
+    Base zero(0.0);
+    Base one(1.0);
+    size_t num_var = info.num_var;
+    //
+    // Taylor coefficients (forward) or partials (reverse) for this thread
+    pod_vector_maybe<Base> buffer;
+    //
+    for(size_t g = thread; g < info.n_group; g += info.n_thread)
+    {   // colors in this group
+        size_t color_begin = g * info.group_max;
+        size_t r = std::min(info.group_max, info.n_color - color_begin);
+        size_t color_end   = color_begin + r;
+        //
+        if( info.forward )
+        {   // Taylor coefficients for orders zero and one, r directions
+            size_t stride = r + 1;
+            buffer.resize(num_var * stride);
+            for(size_t i = 0; i < num_var; i++)
+            {   buffer[i * stride] = info.taylor[i];
+                for(size_t ell = 0; ell < r; ell++)
+                    buffer[i * stride + 1 + ell] = zero;
+            }
+            for(size_t j = 0; j < info.n; j++)
+            {   size_t c = info.color[j];
+                if( color_begin <= c && c < color_end )
+                {   size_t index = info.ind_taddr[j] * stride;
+                    buffer[index + 1 + c - color_begin] = one;
+                }
+            }
+            size_t q = 1;
+            size_t J = 2;
+            sweep::forward2(info.play, q, r, info.n, num_var, J,
+                buffer.data(), info.cskip_op, *info.load_op2var,
+                not_used_rec_base
+            );
+            for(size_t k = info.group_begin[g]; k < info.group_begin[g+1]; k++)
+            {   size_t ell   = info.elem_color[k] - color_begin;
+                size_t index = info.dep_taddr[ info.elem_index[k] ] * stride;
+                info.elem_val[k] = buffer[index + 1 + ell];
+            }
         }
+        else
+        {   // partials for order zero, r directions
+            buffer.resize(num_var * r);
+            for(size_t i = 0; i < num_var * r; i++)
+                buffer[i] = zero;
+            for(size_t i = 0; i < info.m; i++)
+            {   size_t c = info.color[i];
+                if( color_begin <= c && c < color_end )
+                    buffer[info.dep_taddr[i] * r + c - color_begin] += one;
+            }
+            size_t d = 0;
+            size_t J = 1;
+            size_t K = 1;
+            play::const_sequential_iterator play_itr = info.play->end();
+            sweep::reverse_dir(d, info.n, num_var, info.play, J,
+                info.taylor, r, K, buffer.data(), info.cskip_op,
+                *info.load_op2var, play_itr, not_used_rec_base
+            );
+            for(size_t k = info.group_begin[g]; k < info.group_begin[g+1]; k++)
+            {   size_t ell   = info.elem_color[k] - color_begin;
+                size_t index = info.ind_taddr[ info.elem_index[k] ] * r;
+                info.elem_val[k] = buffer[index + ell];
+            }
+        }
+    }
+}
+/*!
+Determine where the Jacobian values go for a specified layout.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\param layout
+is rcv, csr, or csc; see the sparse_jac user documentation.
+
+\param subset
+is the sparsity pattern for the Jacobian values.
+
+\param val_index [out]
+is the index in the Jacobian value vector for each element of subset;
+i.e., the value for element k of subset goes to val_index[k].
+*/
+template <class SizeVector>
+void sparse_jac_val_index(
+    const std::string&           layout    ,
+    const sparse_rc<SizeVector>& subset    ,
+    vector<size_t>&              val_index )
+{   size_t K = subset.nnz();
+    val_index.resize(K);
+    if( layout == "rcv" )
+    {   for(size_t k = 0; k < K; k++)
+            val_index[k] = k;
+        return;
+    }
+    CPPAD_ASSERT_KNOWN(
+        layout == "csr" || layout == "csc",
+        "sparse_jac: layout is not rcv, csr, or csc"
+    );
+    SizeVector major(
+        layout == "csr" ? subset.row_major() : subset.col_major()
+    );
+    // inverse of the major order permutation
+    for(size_t ell = 0; ell < K; ell++)
+        val_index[ major[ell] ] = ell;
+}
+/*!
+Destination for sparse Jacobian values that is a sparse_rcv object.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+*/
+template <class SizeVector, class BaseVector>
+class sparse_jac_rcv_dest {
+private:
+    /// the values in this object are set
+    sparse_rcv<SizeVector, BaseVector>& subset_;
+public:
+    /// constructor
+    sparse_jac_rcv_dest(sparse_rcv<SizeVector, BaseVector>& subset)
+    : subset_(subset)
+    { }
+    /// set the value for element k of subset
+    void set(size_t k, const typename BaseVector::value_type& value)
+    {   subset_.set(k, value); }
 };
+/*!
+Destination for sparse Jacobian values that is a vector in a specified layout.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+*/
+template <class BaseVector>
+class sparse_jac_val_dest {
+private:
+    /// index in val_ for each element of subset; see sparse_jac_val_index
+    const vector<size_t>& val_index_;
+    /// the Jacobian values in the specified layout
+    BaseVector&           val_;
+public:
+    /// constructor
+    sparse_jac_val_dest(const vector<size_t>& val_index, BaseVector& val)
+    : val_index_(val_index), val_(val)
+    { }
+    /// set the value for element k of subset
+    void set(size_t k, const typename BaseVector::value_type& value)
+    {   val_[ val_index_[k] ] = value; }
+};
+} // END_CPPAD_LOCAL_NAMESPACE
+// ----------------------------------------------------------------------------
+/*!
+Evaluate the color groups for a sparse Jacobian using multiple threads.
+
+The zero order Taylor coefficients must correspond to the point at
+which the Jacobian is evaluated.
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\tparam ValueDest
+is sparse_jac_rcv_dest or sparse_jac_val_dest.
+
+\param forward
+if true (false) forward (reverse) mode is used and color is for
+the columns (rows) of the Jacobian.
+
+\param group_max
+maximum number of colors in a group.
+
+\param n_color
+number of colors.
+
+\param n_thread
+number of threads; see color_thread_run.
+
+\param color
+color for each column (forward) or row (reverse) as computed by
+sparse_jac_for (sparse_jac_rev).
+
+\param order
+indices that sort the elements of subset in color order.
+
+\param subset
+specifies the elements of the Jacobian to compute.
+
+\param dest
+Upon return, dest.set(k, value) has been called with the Jacobian value
+for each element k of subset.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class ValueDest>
+void ADFun<Base,RecBase>::sparse_jac_thread(
+    bool                                 forward   ,
+    size_t                               group_max ,
+    size_t                               n_color   ,
+    size_t                               n_thread  ,
+    const vector<size_t>&                color     ,
+    const vector<size_t>&                order     ,
+    const sparse_rc<SizeVector>&         subset    ,
+    ValueDest&                           dest      )
+{   // index that is colored (col for forward) and other index
+    const SizeVector& colored( forward ? subset.col() : subset.row() );
+    const SizeVector& other(   forward ? subset.row() : subset.col() );
+    size_t K       = subset.nnz();
+    size_t n_group = (n_color + group_max - 1) / group_max;
+    //
+    // subset elements in color order
+    local::pod_vector<size_t>     elem_color(K), elem_index(K);
+    local::pod_vector_maybe<Base> elem_val(K);
+    for(size_t k = 0; k < K; k++)
+    {   elem_color[k] = color[ colored[ order[k] ] ];
+        elem_index[k] = other[ order[k] ];
+    }
+    //
+    // first element in color order for each group
+    local::pod_vector<size_t> group_begin(n_group + 1);
+    size_t k = 0;
+    for(size_t g = 0; g <= n_group; g++)
+    {   while( k < K && elem_color[k] < g * group_max )
+            ++k;
+        group_begin[g] = k;
+    }
+    CPPAD_ASSERT_UNKNOWN( group_begin[n_group] == K );
+    //
+    // zero order Taylor coefficients for all the variables
+    size_t stride = (cap_order_taylor_ - 1) * num_direction_taylor_ + 1;
+    local::pod_vector_maybe<Base> taylor(num_var_tape_);
+    for(size_t i = 0; i < num_var_tape_; i++)
+        taylor[i] = taylor_[i * stride];
+    //
+    local::sparse_jac_thread_info<Base> info;
+    info.forward     = forward;
+    info.n           = ind_taddr_.size();
+    info.m           = dep_taddr_.size();
+    info.num_var     = num_var_tape_;
+    info.group_max   = group_max;
+    info.n_color     = n_color;
+    info.n_group     = n_group;
+    info.n_thread    = n_thread;
+    info.play        = &play_;
+    info.taylor      = taylor.data();
+    info.cskip_op    = cskip_op_.data();
+    info.load_op2var = &load_op2var_;
+    info.ind_taddr   = ind_taddr_.data();
+    info.dep_taddr   = dep_taddr_.data();
+    info.color       = color.data();
+    info.group_begin = group_begin.data();
+    info.elem_color  = elem_color.data();
+    info.elem_index  = elem_index.data();
+    info.elem_val    = elem_val.data();
+    //
+    local::color_thread_run<Base>(
+        n_thread, local::sparse_jac_thread_worker<Base, RecBase>, &info
+    );
+    //
+    // store results in dest
+    for(k = 0; k < K; k++)
+        dest.set( order[k], elem_val[k] );
+}
 // ----------------------------------------------------------------------------
 /*!
-Calculate sparse Jacobains using forward mode
+Calculate sparse Jacobains using forward mode and store them using dest.
 
 \tparam Base
 the base type for the recording that is stored in the ADFun object.
@@ -254,6 +740,9 @@ a simple vector class with elements of type size_t.
 \tparam BaseVector
 a simple vector class with elements of type Base.
 
+\tparam ValueDest
+is sparse_jac_rcv_dest or sparse_jac_val_dest.
+
 \param group_max
 specifies the maximum number of colors to group during a single forward sweep.
 This must be greater than zero and group_max = 1 minimizes memory usage.
@@ -275,7 +764,8 @@ where m is number of dependent variables in f.
 
 \param coloring
 determines which coloring algorithm is used.
-This must be cppad or colpack.
+This must be cppad or colpack. The cppad method may be followed by
+a "." and an ordering; see color_order_method.
 
 \param work
 this structure must be empty, or contain the information stored
@@ -283,22 +773,35 @@ by a previous call to sparse_jac_for.
 The previous call must be for the same ADFun object f
 and the same subset.
 
+\param dest
+Upon return, dest.set(k, value) has been called with the Jacobian value
+for each element k of subset.
+
+\param n_thread
+number of threads used to evaluate the color groups.
+
 \return
 This is the number of first order forward sweeps used to compute
 the Jacobian.
 */
 template <class Base, class RecBase>
-template <class SizeVector, class BaseVector>
-size_t ADFun<Base,RecBase>::sparse_jac_for(
+template <class SizeVector, class BaseVector, class ValueDest>
+size_t ADFun<Base,RecBase>::sparse_jac_for_dest(
     size_t                               group_max  ,
     const BaseVector&                    x          ,
-    sparse_rcv<SizeVector, BaseVector>&  subset     ,
+    const sparse_rc<SizeVector>&         subset     ,
     const sparse_rc<SizeVector>&         pattern    ,
     const std::string&                   coloring   ,
-    sparse_jac_work&                     work       )
+    sparse_jac_work&                     work       ,
+    ValueDest&                           dest       ,
+    size_t                               n_thread   )
 {   size_t m = Range();
     size_t n = Domain();
     //
+    CPPAD_ASSERT_KNOWN(
+        n_thread > 0,
+        "sparse_jac_for: n_thread is zero"
+    );
     CPPAD_ASSERT_KNOWN(
         subset.nr() == m,
         "sparse_jac_for: subset.nr() not equal range dimension for f"
@@ -358,8 +861,11 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
         // execute coloring algorithm
         // (we are using transpose because coloring groups rows, not columns).
         color.resize(n);
-        if( coloring == "cppad" )
-            local::color_general_cppad(pattern_transpose, col, row, color);
+        local::color_order_enum ordering = local::color_order_natural;
+        if( local::color_order_method(coloring, "cppad", ordering) )
+            local::color_general_cppad(
+                pattern_transpose, col, row, color, ordering
+            );
         else if( coloring == "colpack" )
         {
 # if CPPAD_HAS_COLPACK
@@ -394,7 +900,21 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
     //
     // initialize the return Jacobian values as zero
     for(size_t k = 0; k < K; k++)
-        subset.set(k, zero);
+        dest.set(k, zero);
+    //
+    // check for case where color groups are evaluated by multiple threads
+    n_thread = std::min(n_thread, (n_color + group_max - 1) / group_max);
+    for(size_t i_op = 0; i_op < play_.num_op_rec() && n_thread > 1; ++i_op)
+    {   if( play_.GetOp(i_op) == local::AFunOp )
+            n_thread = 1;
+    }
+    if( n_thread > 1 )
+    {   bool forward = true;
+        sparse_jac_thread(
+            forward, group_max, n_color, n_thread, color, order, subset, dest
+        );
+        return n_color;
+    }
     //
     // index in subset
     size_t k = 0;
@@ -428,7 +948,7 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
             while(k < K && color[ col[ order[k] ] ] == ell + color_count )
             {   // subset element with index order[k] is included in this color
                 size_t r = row[ order[k] ];
-                subset.set( order[k], dy[ r * group_size + ell ] );
+                dest.set( order[k], dy[ r * group_size + ell ] );
                 ++k;
             }
         }
@@ -441,7 +961,7 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
 }
 // ----------------------------------------------------------------------------
 /*!
-Calculate sparse Jacobains using reverse mode
+Calculate sparse Jacobains using reverse mode and store them using dest.
 
 \tparam Base
 the base type for the recording that is stored in the ADFun object.
@@ -452,6 +972,13 @@ a simple vector class with elements of type size_t.
 \tparam BaseVector
 a simple vector class with elements of type Base.
 
+\tparam ValueDest
+is sparse_jac_rcv_dest or sparse_jac_val_dest.
+
+\param group_max
+specifies the maximum number of colors to group during a single reverse sweep.
+This must be greater than zero and group_max = 1 minimizes memory usage.
+
 \param x
 a vector of length n, the number of independent variables in f
 (this ADFun object).
@@ -469,7 +996,8 @@ where m is number of dependent variables in f.
 
 \param coloring
 determines which coloring algorithm is used.
-This must be cppad or colpack.
+This must be cppad or colpack. The cppad method may be followed by
+a "." and an ordering; see color_order_method.
 
 \param work
 this structure must be empty, or contain the information stored
@@ -477,21 +1005,40 @@ by a previous call to sparse_jac_rev.
 The previous call must be for the same ADFun object f
 and the same subset.
 
+\param dest
+Upon return, dest.set(k, value) has been called with the Jacobian value
+for each element k of subset.
+
+\param n_thread
+number of threads used to evaluate the color groups.
+
 \return
-This is the number of first order reverse sweeps used to compute
+This is the number of first order reverse directions used to compute
 the Jacobian.
 */
 template <class Base, class RecBase>
-template <class SizeVector, class BaseVector>
-size_t ADFun<Base,RecBase>::sparse_jac_rev(
+template <class SizeVector, class BaseVector, class ValueDest>
+size_t ADFun<Base,RecBase>::sparse_jac_rev_dest(
+    size_t                               group_max,
     const BaseVector&                    x        ,
-    sparse_rcv<SizeVector, BaseVector>&  subset   ,
+    const sparse_rc<SizeVector>&         subset   ,
     const sparse_rc<SizeVector>&         pattern  ,
     const std::string&                   coloring ,
-    sparse_jac_work&                     work     )
+    sparse_jac_work&                     work     ,
+    ValueDest&                           dest     ,
+    size_t                               n_thread )
 {   size_t m = Range();
     size_t n = Domain();
     //
+    CPPAD_ASSERT_KNOWN(
+        group_max > 0,
+        "sparse_jac_rev: group_max is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        n_thread > 0,
+        "sparse_jac_rev: n_thread is zero"
+    );
+    //
     CPPAD_ASSERT_KNOWN(
         subset.nr() == m,
         "sparse_jac_rev: subset.nr() not equal range dimension for f"
@@ -550,8 +1097,11 @@ size_t ADFun<Base,RecBase>::sparse_jac_rev(
         //
         // execute coloring algorithm
         color.resize(m);
-        if( coloring == "cppad" )
-            local::color_general_cppad(internal_pattern, row, col, color);
+        local::color_order_enum ordering = local::color_order_natural;
+        if( local::color_order_method(coloring, "cppad", ordering) )
+            local::color_general_cppad(
+                internal_pattern, row, col, color, ordering
+            );
         else if( coloring == "colpack" )
         {
 # if CPPAD_HAS_COLPACK
@@ -586,44 +1136,197 @@ size_t ADFun<Base,RecBase>::sparse_jac_rev(
     //
     // initialize the return Jacobian values as zero
     for(size_t k = 0; k < K; k++)
-        subset.set(k, zero);
+        dest.set(k, zero);
     //
-    // weighting vector and return values for calls to Reverse
-    BaseVector w(m), dw(n);
-    //
-    // loop over colors
-    size_t k = 0;
-    for(size_t ell = 0; ell < n_color; ell++)
-    if( k  == K )
-    {   // kludge because colpack returns colors that are not used
-        // (it does not know about the subset corresponding to row, col)
-        CPPAD_ASSERT_UNKNOWN( coloring == "colpack" );
+    // check for case where color groups are evaluated by multiple threads
+    n_thread = std::min(n_thread, (n_color + group_max - 1) / group_max);
+    for(size_t i_op = 0; i_op < play_.num_op_rec() && n_thread > 1; ++i_op)
+    {   if( play_.GetOp(i_op) == local::AFunOp )
+            n_thread = 1;
     }
-    else if( color[ row[ order[k] ] ] != ell )
-    {   // kludge because colpack returns colors that are not used
-        // (it does not know about the subset corresponding to row, col)
-        CPPAD_ASSERT_UNKNOWN( coloring == "colpack" );
+    if( n_thread > 1 )
+    {   bool forward = false;
+        sparse_jac_thread(
+            forward, group_max, n_color, n_thread, color, order, subset, dest
+        );
+        return n_color;
     }
-    else
-    {   CPPAD_ASSERT_UNKNOWN( color[ row[ order[k] ] ] == ell );
+    //
+    // index in subset
+    size_t k = 0;
+    // number of colors computed so far
+    size_t color_count = 0;
+    //
+    while( color_count < n_color )
+    {   // number of colors that will be in this group
+        size_t group_size = std::min<size_t>(group_max, n_color - color_count);
         //
-        // combine all rows with this color
-        for(size_t i = 0; i < m; i++)
-        {   w[i] = zero;
-            if( color[i] == ell )
-                w[i] = one;
+        // weighting vector and return values for calls to Reverse
+        BaseVector w(m * group_size), dw(n * group_size);
+        //
+        // set w
+        for(size_t ell = 0; ell < group_size; ell++)
+        {   // combine all rows with this color
+            for(size_t i = 0; i < m; i++)
+            {   w[i * group_size + ell] = zero;
+                if( color[i] == ell + color_count )
+                    w[i * group_size + ell] = one;
+            }
         }
         // call reverse mode for all these rows at once
-        dw = Reverse(1, w);
+        if( group_size == 1 )
+            dw = Reverse(1, w);
+        else
+            dw = Reverse(1, group_size, w);
         //
         // set the corresponding components of the result
-        while( k < K && color[ row[order[k]] ] == ell )
-        {   subset.set(order[k], dw[col[order[k]]] );
-            k++;
+        for(size_t ell = 0; ell < group_size; ell++)
+        {   // color with index ell + color_count is in this group
+            while(k < K && color[ row[ order[k] ] ] == ell + color_count )
+            {   // subset element with index order[k] is included in this color
+                size_t c = col[ order[k] ];
+                dest.set( order[k], dw[ c * group_size + ell ] );
+                ++k;
+            }
         }
+        // advance color count
+        color_count += group_size;
     }
+    CPPAD_ASSERT_UNKNOWN( color_count == n_color );
+    //
     return n_color;
 }
+// ----------------------------------------------------------------------------
+/*!
+Calculate sparse Jacobains using forward mode and return them in a vector.
+
+This is the same as sparse_jac_for_dest with the values stored in val.
+
+\param layout
+is rcv, csr, or csc and specifies the order of the values in val.
+
+\param val
+Upon return, it contains the Jacobian values in the order specified by layout.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+size_t ADFun<Base,RecBase>::sparse_jac_for(
+    size_t                               group_max  ,
+    const BaseVector&                    x          ,
+    const sparse_rc<SizeVector>&         subset     ,
+    const sparse_rc<SizeVector>&         pattern    ,
+    const std::string&                   coloring   ,
+    sparse_jac_work&                     work       ,
+    const std::string&                   layout     ,
+    BaseVector&                          val        ,
+    size_t                               n_thread   )
+{   size_t K = subset.nnz();
+    if( size_t( val.size() ) != K )
+        val.resize(K);
+    //
+    // check for case where val_index needs to be computed
+    if( work.color.size() == 0 || work.layout != layout )
+    {   local::sparse_jac_val_index(layout, subset, work.val_index);
+        work.layout = layout;
+    }
+    local::sparse_jac_val_dest<BaseVector> dest(work.val_index, val);
+    return sparse_jac_for_dest(
+        group_max, x, subset, pattern, coloring, work, dest, n_thread
+    );
+}
+/*!
+Calculate sparse Jacobains using reverse mode and return them in a vector.
+
+This is the same as sparse_jac_rev_dest with the values stored in val.
+
+\param layout
+is rcv, csr, or csc and specifies the order of the values in val.
+
+\param val
+Upon return, it contains the Jacobian values in the order specified by layout.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+size_t ADFun<Base,RecBase>::sparse_jac_rev(
+    size_t                               group_max,
+    const BaseVector&                    x        ,
+    const sparse_rc<SizeVector>&         subset   ,
+    const sparse_rc<SizeVector>&         pattern  ,
+    const std::string&                   coloring ,
+    sparse_jac_work&                     work     ,
+    const std::string&                   layout   ,
+    BaseVector&                          val      ,
+    size_t                               n_thread )
+{   size_t K = subset.nnz();
+    if( size_t( val.size() ) != K )
+        val.resize(K);
+    //
+    // check for case where val_index needs to be computed
+    if( work.color.size() == 0 || work.layout != layout )
+    {   local::sparse_jac_val_index(layout, subset, work.val_index);
+        work.layout = layout;
+    }
+    local::sparse_jac_val_dest<BaseVector> dest(work.val_index, val);
+    return sparse_jac_rev_dest(
+        group_max, x, subset, pattern, coloring, work, dest, n_thread
+    );
+}
+/*!
+Calculate sparse Jacobains using forward mode and return them in subset.
+
+This is the same as sparse_jac_for_dest with the values stored in subset.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+size_t ADFun<Base,RecBase>::sparse_jac_for(
+    size_t                               group_max  ,
+    const BaseVector&                    x          ,
+    sparse_rcv<SizeVector, BaseVector>&  subset     ,
+    const sparse_rc<SizeVector>&         pattern    ,
+    const std::string&                   coloring   ,
+    sparse_jac_work&                     work       ,
+    size_t                               n_thread   )
+{   local::sparse_jac_rcv_dest<SizeVector, BaseVector> dest(subset);
+    return sparse_jac_for_dest(
+        group_max, x, subset.pat(), pattern, coloring, work, dest, n_thread
+    );
+}
+/*!
+Calculate sparse Jacobains using reverse mode and return them in subset.
+
+This is the same as sparse_jac_rev_dest with the values stored in subset.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+size_t ADFun<Base,RecBase>::sparse_jac_rev(
+    size_t                               group_max,
+    const BaseVector&                    x        ,
+    sparse_rcv<SizeVector, BaseVector>&  subset   ,
+    const sparse_rc<SizeVector>&         pattern  ,
+    const std::string&                   coloring ,
+    sparse_jac_work&                     work     ,
+    size_t                               n_thread )
+{   local::sparse_jac_rcv_dest<SizeVector, BaseVector> dest(subset);
+    return sparse_jac_rev_dest(
+        group_max, x, subset.pat(), pattern, coloring, work, dest, n_thread
+    );
+}
+/*!
+Calculate sparse Jacobains using reverse mode and one color per sweep.
+
+This is the same as sparse_jac_rev with group_max equal to one.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+size_t ADFun<Base,RecBase>::sparse_jac_rev(
+    const BaseVector&                    x        ,
+    sparse_rcv<SizeVector, BaseVector>&  subset   ,
+    const sparse_rc<SizeVector>&         pattern  ,
+    const std::string&                   coloring ,
+    sparse_jac_work&                     work     )
+{   size_t group_max = 1;
+    return sparse_jac_rev(group_max, x, subset, pattern, coloring, work);
+}
 
 } // END_CPPAD_NAMESPACE
 # endif
@@ -0,0 +1,248 @@
+# ifndef CPPAD_CORE_UPDATE_EVAL_HPP
+# define CPPAD_CORE_UPDATE_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin update_eval$$
+$spell
+    bool
+    const
+    VecAD
+    PrintFor
+    Taylor
+    eval
+$$
+
+$section Zero Order Forward Mode When Only Some Arguments Change$$
+
+$head Syntax$$
+$icode%ok% = %f%.prepare_update_eval()
+%$$
+$icode%y% = %f%.forward_update(%changed%, %value%)%$$
+
+$head Purpose$$
+Line searches and coordinate updates often evaluate
+$latex y = F(x)$$ at a sequence of points where only a few components of
+$icode x$$ change from one point to the next.
+The routine $code prepare_update_eval$$ determines, for each variable,
+the operations that use the variable as an argument.
+The routine $code forward_update$$ then changes the specified
+components of $icode x$$ and only evaluates the operations that depend
+on the components that changed.
+The values of the other variables are the same as for the previous
+zero order forward calculation.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$
+for $code prepare_update_eval$$ and $code forward_update$$.
+
+$head prepare_update_eval$$
+This creates the
+$cref/pre-decoded operations/prepare_fast_eval/$$, if necessary,
+and the users of each variable.
+The return value $icode ok$$ has prototype
+$codei%
+    bool %ok%
+%$$
+If it is false, the operation sequence contains an operation that is not
+supported by the pre-decoded operations
+($cref VecAD$$ operations, $cref atomic$$ function calls,
+or $cref PrintFor$$ operations)
+and $code forward_update$$ uses $codei%%f%.Forward(0, %x%)%$$
+where $icode x$$ is the previous argument with the changes.
+The users are discarded when the operation sequence
+for $icode f$$ changes.
+They are copied when $icode f$$ is assigned to another $code ADFun$$ object.
+
+$head forward_update$$
+
+$subhead Previous Point$$
+The previous argument $icode x$$ is the value of the independent
+variables for the previous zero order forward calculation; e.g.,
+$codei%%f%.Forward(0, %x%)%$$ or a previous call to $code forward_update$$.
+It is an error to call $code forward_update$$ when the zero order
+Taylor coefficients are not stored in $icode f$$; e.g.,
+directly after a call to $cref new_dynamic$$ or
+$codei%%f%.capacity_order(0)%$$.
+
+$subhead changed$$
+The argument $icode changed$$ has prototype
+$codei%
+    const %SizeVector%& %changed%
+%$$
+Each of its elements is less than $icode%n% = %f%.Domain()%$$.
+It specifies the components of $icode x$$ that change.
+
+$subhead value$$
+The argument $icode value$$ has prototype
+$codei%
+    const %BaseVector%& %value%
+%$$
+and its size is the same as $icode changed$$.
+For each $icode k$$, the new value of the component
+$icode%x%[ %changed%[%k%] ]%$$ is $icode%value%[%k%]%$$.
+
+$subhead y$$
+The result $icode y$$ has prototype
+$codei%
+    %BaseVector% %y%
+%$$
+its size is equal to $icode%m% = %f%.Range()%$$,
+and its value is $latex F(x)$$ at the new point $icode x$$.
+
+$subhead Taylor Coefficients$$
+Upon return, the zero order Taylor coefficients for $icode f$$
+correspond to the new point $icode x$$ and
+$cref size_order$$ is one.
+Thus it can be followed by a first order forward or reverse mode
+calculation at the new point.
+
+$subhead Comparisons$$
+The comparison operations are not evaluated by $code forward_update$$
+(unless it uses $codei%%f%.Forward(0, %x%)%$$);
+i.e., $cref compare_change$$ is not changed by this call.
+
+$subhead Conditional Skip$$
+If the previous zero order forward calculation skipped some operations
+(see $cref number_skip$$), $code forward_update$$ uses
+$codei%%f%.Forward(0, %x%)%$$.
+
+$head SizeVector$$
+The type $icode SizeVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$children%
+    example/general/update_eval.cpp
+%$$
+$head Example$$
+The file $cref update_eval.cpp$$
+contains an example and test of these operations.
+
+$end
+-----------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file update_eval.hpp
+Zero order forward mode that only evaluates the operations that depend on
+the independent variables that changed.
+*/
+
+/*!
+Create the users of each variable that are used by forward_update.
+
+\return
+is true if the operation sequence can be evaluated using
+forward_update.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::prepare_update_eval(void)
+{   return local::sweep::update_setup(&play_);
+}
+
+/*!
+Zero order forward mode when only some of the independent variables change.
+
+\tparam SizeVector
+is a simple vector with elements of type size_t.
+
+\tparam BaseVector
+is a simple vector with elements of type Base.
+
+\param changed
+is the index of the independent variables that change.
+
+\param value
+is the new value for each of the independent variables in changed.
+
+\return
+is the corresponding value of the dependent variables.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_update(
+    const SizeVector& changed, const BaseVector& value
+)
+{   // check the vector types
+    CheckSimpleVector<size_t, SizeVector>();
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    size_t n         = ind_taddr_.size();
+    size_t m         = dep_taddr_.size();
+    size_t n_changed = size_t( changed.size() );
+    CPPAD_ASSERT_KNOWN(
+        size_t( value.size() ) == n_changed,
+        "forward_update: size of value not equal size of changed"
+    );
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ > 0,
+        "forward_update: the zero order Taylor coefficients are not stored"
+        "\nin this ADFun object; e.g., new_dynamic was called since the"
+        "\nprevious zero order forward mode calculation."
+    );
+    for(size_t k = 0; k < n_changed; ++k)
+    {   CPPAD_ASSERT_KNOWN(
+            changed[k] < n,
+            "forward_update: an element of changed is >= Domain dimension"
+        );
+    }
+    //
+    // number of columns in the taylor matrix
+    size_t C = (cap_order_taylor_ - 1) * num_direction_taylor_ + 1;
+    //
+    // check if the previous zero order forward skipped any operators
+    bool use_update = play_.update_start().size() > 0;
+    if( play_.update_cskip() )
+        use_update &= ! cskip_op_any_;
+    if( ! use_update )
+    {   BaseVector x(n);
+        for(size_t j = 0; j < n; ++j)
+            x[j] = taylor_[ C * ind_taddr_[j] ];
+        for(size_t k = 0; k < n_changed; ++k)
+            x[ changed[k] ] = value[k];
+        return Forward(0, x);
+    }
+    //
+    // set the new values for the independent variables that change
+    local::pod_vector<size_t> changed_var(n_changed);
+    for(size_t k = 0; k < n_changed; ++k)
+    {   changed_var[k] = ind_taddr_[ changed[k] ];
+        taylor_[ C * changed_var[k] ] = value[k];
+    }
+    //
+    // evaluate the operators that depend on the changes
+    local::sweep::update_forward0(
+        &play_, n_changed, changed_var.data(), C, taylor_.data()
+    );
+    //
+    // only the zero order coefficients correspond to the new point
+    num_order_taylor_ = 1;
+    //
+    BaseVector y(m);
+    for(size_t i = 0; i < m; ++i)
+        y[i] = taylor_[ C * dep_taddr_[i] ];
+    return y;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,548 @@
+# ifndef CPPAD_EXAMPLE_BASE_SIMD_HPP
+# define CPPAD_EXAMPLE_BASE_SIMD_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin base_simd.hpp$$
+$spell
+    simd
+    avx
+    sse
+    op
+    const
+    bool
+    inline
+    isnan
+    azmul
+    abs_geq
+    fabs
+    erf
+    erfc
+    expm1
+    log1p
+    asinh
+    acosh
+    atanh
+    Rel
+    Lt Le Eq Ge Gt
+    Cond
+    std
+    namespace
+    CppAD
+    cppad.hpp
+    hpp
+    VecAD
+    ostream
+    struct
+$$
+
+$section Enable use of AD<Base> where Base is a Vector of SIMD Lanes$$
+
+$head Syntax$$
+$codei%# include <cppad/example/base_simd.hpp>
+%$$
+$codei%simd_double<%N%> %z%
+%$$
+$codei%simd_double<%N%> %z%(%d%)
+%$$
+$icode%z%[%ell%] = %d%
+%$$
+$icode%d% = %z%[%ell%]
+%$$
+
+$head Purpose$$
+The type $codei%simd_double<%N%>%$$ is a vector of $icode N$$
+$code double$$ values (lanes) that satisfies the
+$cref/Base type requirements/base_require/$$.
+Each $icode Base$$ operation is applied to every lane,
+so one sweep using an
+$codei%ADFun< simd_double<%N%> >%$$ object evaluates
+$icode N$$ scenarios; e.g., $icode N$$ different values for the
+independent variables.
+If the compiler flags enable AVX ($code __AVX__$$ is defined)
+or SSE2 ($code __SSE2__$$ is defined),
+the arithmetic operators use the corresponding vector instructions
+when $icode N$$ is a multiple of four (two); otherwise a loop over the
+lanes is used.
+
+$head N$$
+This is a $code size_t$$ template parameter that
+is the number of lanes; e.g., $code 4$$.
+
+$head d$$
+This is a $code double$$ value.
+The constructor $codei%simd_double<%N%> %z%(%d%)%$$
+sets every lane equal to $icode d$$;
+the default constructor sets every lane to zero.
+
+$head ell$$
+This is a $code size_t$$ index less than $icode N$$.
+The syntax $icode%z%[%ell%]%$$ is the value of the corresponding lane.
+
+$head Lane-wise Operations$$
+The unary and binary operators, the standard math functions,
+$code pow$$, $code sign$$, $code azmul$$, and the
+$cref/CondExpOp/base_cond_exp/CondExpOp/$$ and
+$cref/CondExpRel/base_cond_exp/CondExpRel/$$ functions
+act independently on each lane.
+Hence a $cref CondExp$$ in the recording can choose a different case
+for each scenario.
+
+$head Bool Results$$
+The operations that return a $code bool$$ can not be lane-wise.
+The comparison operators $code ==$$,
+$code <$$, $code <=$$, $code >$$, $code >=$$,
+and the $cref/ordered/base_ordered/$$ functions,
+return true if the result is true for every lane.
+The operator $code !=$$ returns true if the result is true for any lane.
+It follows that the comparison of two $codei%AD< simd_double<%N%> >%$$
+values during a recording chooses one branch for all the scenarios.
+Use $cref CondExp$$ for lane-wise choices.
+$pre
+
+$$
+The $cref/EqualOpSeq/base_identical/EqualOpSeq/$$ and
+$cref/Identical/base_identical/Identical/$$ functions are true if they
+are true for every lane; e.g., $code IdenticalZero$$ is true if every
+lane is zero.
+The function $code isnan$$ is true if any lane is $code nan$$.
+$pre
+
+$$
+The $cref/AbsGeq/LuFactor/AbsGeq/$$ function is specialized for
+$codei%simd_double<%N%>%$$ and $codei%AD< simd_double<%N%> >%$$
+so that $cref LuFactor$$ chooses a pivot that has the maximum
+absolute value in every lane it is compared with.
+(The default $code AbsGeq$$ does not work when the lanes have
+different signs.)
+
+$head Integer$$
+The $cref/Integer/base_integer/$$ value is the integer
+part of lane zero.
+Thus $cref VecAD$$ indices should have the same value in every lane.
+
+$head Output$$
+The output operator $code <<$$, and $cref to_string$$,
+write the lanes between curly brackets and separated by commas.
+
+$children%
+    example/general/base_simd.cpp
+%$$
+$head Example$$
+The file $cref base_simd.cpp$$
+contains an example and test using this type.
+
+$end
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <sstream>
+# include <iomanip>
+# include <cppad/base_require.hpp>
+# if defined(__AVX__) || defined(__SSE2__)
+# include <immintrin.h>
+# endif
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file base_simd.hpp
+A vector of double values that satisfies the Base type requirements.
+*/
+
+/*!
+Lane-wise arithmetic for simd_double.
+
+The general case loops over the lanes. The specializations below
+use vector instructions when they are available.
+*/
+template <size_t N, size_t Width>
+struct simd_arith {
+    static void add(const double* x, const double* y, double* z)
+    {   for(size_t ell = 0; ell < N; ++ell)
+            z[ell] = x[ell] + y[ell];
+    }
+    static void sub(const double* x, const double* y, double* z)
+    {   for(size_t ell = 0; ell < N; ++ell)
+            z[ell] = x[ell] - y[ell];
+    }
+    static void mul(const double* x, const double* y, double* z)
+    {   for(size_t ell = 0; ell < N; ++ell)
+            z[ell] = x[ell] * y[ell];
+    }
+    static void div(const double* x, const double* y, double* z)
+    {   for(size_t ell = 0; ell < N; ++ell)
+            z[ell] = x[ell] / y[ell];
+    }
+};
+# if defined(__AVX__)
+/// the number of lanes in one AVX instruction
+# define CPPAD_SIMD_WIDTH 4
+/// apply an AVX instruction to N lanes four at a time
+# define CPPAD_SIMD_ARITH(name, intrinsic)                                 \
+    static void name(const double* x, const double* y, double* z)          \
+    {   for(size_t ell = 0; ell < N; ell += 4)                             \
+        {   __m256d xv = _mm256_loadu_pd(x + ell);                         \
+            __m256d yv = _mm256_loadu_pd(y + ell);                         \
+            _mm256_storeu_pd(z + ell, intrinsic(xv, yv) );                 \
+        }                                                                  \
+    }
+template <size_t N>
+struct simd_arith<N, 4> {
+    CPPAD_SIMD_ARITH(add, _mm256_add_pd)
+    CPPAD_SIMD_ARITH(sub, _mm256_sub_pd)
+    CPPAD_SIMD_ARITH(mul, _mm256_mul_pd)
+    CPPAD_SIMD_ARITH(div, _mm256_div_pd)
+};
+# undef CPPAD_SIMD_ARITH
+# elif defined(__SSE2__)
+/// the number of lanes in one SSE2 instruction
+# define CPPAD_SIMD_WIDTH 2
+/// apply an SSE2 instruction to N lanes two at a time
+# define CPPAD_SIMD_ARITH(name, intrinsic)                                 \
+    static void name(const double* x, const double* y, double* z)          \
+    {   for(size_t ell = 0; ell < N; ell += 2)                             \
+        {   __m128d xv = _mm_loadu_pd(x + ell);                            \
+            __m128d yv = _mm_loadu_pd(y + ell);                            \
+            _mm_storeu_pd(z + ell, intrinsic(xv, yv) );                    \
+        }                                                                  \
+    }
+template <size_t N>
+struct simd_arith<N, 2> {
+    CPPAD_SIMD_ARITH(add, _mm_add_pd)
+    CPPAD_SIMD_ARITH(sub, _mm_sub_pd)
+    CPPAD_SIMD_ARITH(mul, _mm_mul_pd)
+    CPPAD_SIMD_ARITH(div, _mm_div_pd)
+};
+# undef CPPAD_SIMD_ARITH
+# else
+/// no vector instructions are available
+# define CPPAD_SIMD_WIDTH 1
+# endif
+
+/*!
+A vector of N double values, each value is a lane.
+
+\tparam N
+is the number of lanes.
+*/
+template <size_t N>
+class simd_double {
+private:
+    /// the lanes
+    double lane_[N];
+
+    /// type used for lane-wise arithmetic
+    typedef simd_arith<
+        N, (N % CPPAD_SIMD_WIDTH == 0) ? CPPAD_SIMD_WIDTH : 1
+    > arith;
+public:
+    /// default constructor (all lanes zero)
+    simd_double(void)
+    {   for(size_t ell = 0; ell < N; ++ell)
+            lane_[ell] = 0.0;
+    }
+    /// double constructor (all lanes equal d)
+    simd_double(double d)
+    {   for(size_t ell = 0; ell < N; ++ell)
+            lane_[ell] = d;
+    }
+    /// value of one lane
+    double& operator[](size_t ell)
+    {   CPPAD_ASSERT_UNKNOWN( ell < N );
+        return lane_[ell];
+    }
+    /// value of one lane
+    const double& operator[](size_t ell) const
+    {   CPPAD_ASSERT_UNKNOWN( ell < N );
+        return lane_[ell];
+    }
+    // ----------------------------------------------------------------------
+    // unary operators
+    simd_double operator+(void) const
+    {   return *this; }
+    simd_double operator-(void) const
+    {   simd_double z;
+        for(size_t ell = 0; ell < N; ++ell)
+            z.lane_[ell] = - lane_[ell];
+        return z;
+    }
+    // ----------------------------------------------------------------------
+    // binary operators
+    simd_double operator+(const simd_double& y) const
+    {   simd_double z;
+        arith::add(lane_, y.lane_, z.lane_);
+        return z;
+    }
+    simd_double operator-(const simd_double& y) const
+    {   simd_double z;
+        arith::sub(lane_, y.lane_, z.lane_);
+        return z;
+    }
+    simd_double operator*(const simd_double& y) const
+    {   simd_double z;
+        arith::mul(lane_, y.lane_, z.lane_);
+        return z;
+    }
+    simd_double operator/(const simd_double& y) const
+    {   simd_double z;
+        arith::div(lane_, y.lane_, z.lane_);
+        return z;
+    }
+    // ----------------------------------------------------------------------
+    // compound assignment operators
+    simd_double& operator+=(const simd_double& y)
+    {   arith::add(lane_, y.lane_, lane_);
+        return *this;
+    }
+    simd_double& operator-=(const simd_double& y)
+    {   arith::sub(lane_, y.lane_, lane_);
+        return *this;
+    }
+    simd_double& operator*=(const simd_double& y)
+    {   arith::mul(lane_, y.lane_, lane_);
+        return *this;
+    }
+    simd_double& operator/=(const simd_double& y)
+    {   arith::div(lane_, y.lane_, lane_);
+        return *this;
+    }
+    // ----------------------------------------------------------------------
+    // bool operators (true for all lanes, except != is true for any lane)
+    bool operator==(const simd_double& y) const
+    {   bool result = true;
+        for(size_t ell = 0; ell < N; ++ell)
+            result &= lane_[ell] == y.lane_[ell];
+        return result;
+    }
+    bool operator!=(const simd_double& y) const
+    {   return ! (*this == y); }
+    bool operator<(const simd_double& y) const
+    {   bool result = true;
+        for(size_t ell = 0; ell < N; ++ell)
+            result &= lane_[ell] < y.lane_[ell];
+        return result;
+    }
+    bool operator<=(const simd_double& y) const
+    {   bool result = true;
+        for(size_t ell = 0; ell < N; ++ell)
+            result &= lane_[ell] <= y.lane_[ell];
+        return result;
+    }
+    bool operator>(const simd_double& y) const
+    {   return y < *this; }
+    bool operator>=(const simd_double& y) const
+    {   return y <= *this; }
+};
+// ---------------------------------------------------------------------------
+// CondExpOp
+template <size_t N>
+simd_double<N> CondExpOp(
+    enum CompareOp         cop          ,
+    const simd_double<N>&  left         ,
+    const simd_double<N>&  right        ,
+    const simd_double<N>&  exp_if_true  ,
+    const simd_double<N>&  exp_if_false )
+{   simd_double<N> result;
+    for(size_t ell = 0; ell < N; ++ell)
+    {   result[ell] = CondExpTemplate(cop,
+            left[ell], right[ell], exp_if_true[ell], exp_if_false[ell]
+        );
+    }
+    return result;
+}
+// CondExpRel
+# define CPPAD_SIMD_COND_EXP_REL(Rel, Op)                                  \
+    template <size_t N>                                                    \
+    simd_double<N> CondExp##Rel(                                           \
+        const simd_double<N>& left         ,                               \
+        const simd_double<N>& right        ,                               \
+        const simd_double<N>& exp_if_true  ,                               \
+        const simd_double<N>& exp_if_false )                               \
+    {   return CondExpOp(Op, left, right, exp_if_true, exp_if_false); }
+CPPAD_SIMD_COND_EXP_REL(Lt, CompareLt)
+CPPAD_SIMD_COND_EXP_REL(Le, CompareLe)
+CPPAD_SIMD_COND_EXP_REL(Eq, CompareEq)
+CPPAD_SIMD_COND_EXP_REL(Ge, CompareGe)
+CPPAD_SIMD_COND_EXP_REL(Gt, CompareGt)
+# undef CPPAD_SIMD_COND_EXP_REL
+// ---------------------------------------------------------------------------
+// EqualOpSeq
+template <size_t N>
+bool EqualOpSeq(const simd_double<N>& x, const simd_double<N>& y)
+{   return x == y; }
+// Identical
+template <size_t N>
+bool IdenticalCon(const simd_double<N>&)
+{   return true; }
+template <size_t N>
+bool IdenticalZero(const simd_double<N>& x)
+{   return x == simd_double<N>(0.0); }
+template <size_t N>
+bool IdenticalOne(const simd_double<N>& x)
+{   return x == simd_double<N>(1.0); }
+template <size_t N>
+bool IdenticalEqualCon(const simd_double<N>& x, const simd_double<N>& y)
+{   return x == y; }
+// ---------------------------------------------------------------------------
+// Integer
+template <size_t N>
+int Integer(const simd_double<N>& x)
+{   return static_cast<int>( x[0] ); }
+// ---------------------------------------------------------------------------
+// azmul
+template <size_t N>
+simd_double<N> azmul(const simd_double<N>& x, const simd_double<N>& y)
+{   simd_double<N> z;
+    for(size_t ell = 0; ell < N; ++ell)
+        z[ell] = x[ell] == 0.0 ? 0.0 : x[ell] * y[ell];
+    return z;
+}
+// ---------------------------------------------------------------------------
+// Ordered
+template <size_t N>
+bool GreaterThanZero(const simd_double<N>& x)
+{   return x > simd_double<N>(0.0); }
+template <size_t N>
+bool GreaterThanOrZero(const simd_double<N>& x)
+{   return x >= simd_double<N>(0.0); }
+template <size_t N>
+bool LessThanZero(const simd_double<N>& x)
+{   return x < simd_double<N>(0.0); }
+template <size_t N>
+bool LessThanOrZero(const simd_double<N>& x)
+{   return x <= simd_double<N>(0.0); }
+template <size_t N>
+bool abs_geq(const simd_double<N>& x, const simd_double<N>& y)
+{   bool result = true;
+    for(size_t ell = 0; ell < N; ++ell)
+        result &= std::fabs( x[ell] ) >= std::fabs( y[ell] );
+    return result;
+}
+// AbsGeq (used by LuFactor to choose pivots)
+template <size_t N>
+bool AbsGeq(const simd_double<N>& x, const simd_double<N>& y)
+{   return abs_geq(x, y); }
+template <size_t N>
+bool AbsGeq(const AD< simd_double<N> >& x, const AD< simd_double<N> >& y)
+{   return abs_geq( Value( Var2Par(x) ), Value( Var2Par(y) ) ); }
+// ---------------------------------------------------------------------------
+// Unary Standard Math
+# define CPPAD_SIMD_STD_MATH(fun)                                          \
+    template <size_t N>                                                    \
+    simd_double<N> fun(const simd_double<N>& x)                            \
+    {   simd_double<N> z;                                                  \
+        for(size_t ell = 0; ell < N; ++ell)                                \
+            z[ell] = std::fun( x[ell] );                                   \
+        return z;                                                          \
+    }
+CPPAD_SIMD_STD_MATH(acos)
+CPPAD_SIMD_STD_MATH(asin)
+CPPAD_SIMD_STD_MATH(atan)
+CPPAD_SIMD_STD_MATH(cos)
+CPPAD_SIMD_STD_MATH(cosh)
+CPPAD_SIMD_STD_MATH(exp)
+CPPAD_SIMD_STD_MATH(fabs)
+CPPAD_SIMD_STD_MATH(log)
+CPPAD_SIMD_STD_MATH(log10)
+CPPAD_SIMD_STD_MATH(sin)
+CPPAD_SIMD_STD_MATH(sinh)
+CPPAD_SIMD_STD_MATH(sqrt)
+CPPAD_SIMD_STD_MATH(tan)
+CPPAD_SIMD_STD_MATH(tanh)
+# if CPPAD_USE_CPLUSPLUS_2011
+CPPAD_SIMD_STD_MATH(asinh)
+CPPAD_SIMD_STD_MATH(acosh)
+CPPAD_SIMD_STD_MATH(atanh)
+CPPAD_SIMD_STD_MATH(erf)
+CPPAD_SIMD_STD_MATH(erfc)
+CPPAD_SIMD_STD_MATH(expm1)
+CPPAD_SIMD_STD_MATH(log1p)
+# endif
+# undef CPPAD_SIMD_STD_MATH
+// abs
+template <size_t N>
+simd_double<N> abs(const simd_double<N>& x)
+{   return fabs(x); }
+// isnan
+template <size_t N>
+bool isnan(const simd_double<N>& x)
+{   bool result = false;
+    for(size_t ell = 0; ell < N; ++ell)
+        result |= x[ell] != x[ell];
+    return result;
+}
+// sign
+template <size_t N>
+simd_double<N> sign(const simd_double<N>& x)
+{   simd_double<N> z;
+    for(size_t ell = 0; ell < N; ++ell)
+    {   if( x[ell] > 0.0 )
+            z[ell] = 1.0;
+        else if( x[ell] == 0.0 )
+            z[ell] = 0.0;
+        else
+            z[ell] = -1.0;
+    }
+    return z;
+}
+// pow
+template <size_t N>
+simd_double<N> pow(const simd_double<N>& x, const simd_double<N>& y)
+{   simd_double<N> z;
+    for(size_t ell = 0; ell < N; ++ell)
+        z[ell] = std::pow( x[ell], y[ell] );
+    return z;
+}
+// ---------------------------------------------------------------------------
+// numeric_limits
+template <size_t N>
+class numeric_limits< simd_double<N> > {
+public:
+    static simd_double<N> min(void)
+    {   return simd_double<N>( std::numeric_limits<double>::min() ); }
+    static simd_double<N> max(void)
+    {   return simd_double<N>( std::numeric_limits<double>::max() ); }
+    static simd_double<N> epsilon(void)
+    {   return simd_double<N>( std::numeric_limits<double>::epsilon() ); }
+    static simd_double<N> quiet_NaN(void)
+    {   return simd_double<N>( std::numeric_limits<double>::quiet_NaN() ); }
+    static const int digits10 = std::numeric_limits<double>::digits10;
+};
+// ---------------------------------------------------------------------------
+// output operator
+template <size_t N>
+std::ostream& operator<<(std::ostream& os, const simd_double<N>& x)
+{   os << "{";
+    for(size_t ell = 0; ell < N; ++ell)
+    {   if( ell > 0 )
+            os << ", ";
+        os << x[ell];
+    }
+    os << "}";
+    return os;
+}
+// to_string
+template <size_t N>
+struct to_string_struct< simd_double<N> > {
+    std::string operator()(const simd_double<N>& value)
+    {   std::stringstream os;
+        int n_digits = 1 + std::numeric_limits<double>::digits10;
+        os << std::setprecision(n_digits);
+        os << value;
+        return os.str();
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+
+# undef CPPAD_SIMD_WIDTH
+# endif
@@ -144,6 +144,19 @@ public:
         ADBaseVector&   dynamic
     );
 
+    // public function only used by CppAD::Independent
+    template <class Fun>
+    void reserve(const Fun& hint)
+    {   Rec_.reserve(
+            hint.size_op()       ,
+            hint.size_op_arg()   ,
+            hint.size_par()      ,
+            hint.size_dyn_par()  ,
+            hint.size_dyn_arg()  ,
+            hint.size_text()     ,
+            hint.size_VecAD()
+        );
+    }
 };
 // ---------------------------------------------------------------------------
 // Private functions
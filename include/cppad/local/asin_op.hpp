@@ -123,6 +123,12 @@ void forward_asin_op_dir(
 
     size_t k, ell;
     size_t m = (q-1) * r + 1;
+    if( q == 1 )
+    {   forward_dir_first_mul(r, x + 1, - x[0], b + 1);
+        forward_dir_first_div(r, b + 1, b[0], b + 1);
+        forward_dir_first_div(r, x + 1, b[0], z + 1);
+        return;
+    }
     for(ell = 0; ell < r; ell ++)
     {   Base uq = - 2.0 * x[m + ell] * x[0];
         for(k = 1; k < q; k++)
@@ -116,6 +116,11 @@ void forward_atanh_op_dir(
     Base* b = z      -       num_taylor_per_var; // called y in documentation
 
     size_t m = (q-1) * r + 1;
+    if( q == 1 )
+    {   forward_dir_first_mul(r, x + 1, - Base(2.0) * x[0], b + 1);
+        forward_dir_first_div(r, x + 1, b[0], z + 1);
+        return;
+    }
     for(size_t ell = 0; ell < r; ell++)
     {   b[m+ell] = - Base(2.0) * x[m+ell] * x[0];
         z[m+ell] = Base(double(q)) * x[m+ell];
@@ -0,0 +1,346 @@
+# ifndef CPPAD_LOCAL_BINARY_IO_HPP
+# define CPPAD_LOCAL_BINARY_IO_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <iostream>
+# include <algorithm>
+# include <string>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/op_code_var.hpp>
+# include <cppad/local/op_code_dyn.hpp>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file binary_io.hpp
+Routines that read and write the binary representation of an operation
+sequence. The values are stored in the native byte order and sizes of
+the machine; see binary_header_write and binary_header_read.
+*/
+
+/// Current version of the binary file format
+# define CPPAD_BINARY_IO_VERSION 1
+
+/*!
+Report an error in the binary representation being read.
+
+The error is reported using ErrorHandler::Call, which is not removed
+when NDEBUG is defined, because the input comes from outside the program.
+
+\param msg
+is the message describing the error.
+
+\return
+is always false (so that the caller can return it).
+*/
+inline bool binary_error(const char* msg)
+{   bool known       = true;
+    int  line        = __LINE__;
+    const char* file = __FILE__;
+    const char* exp  = "from_binary";
+    ErrorHandler::Call(known, line, file, exp, msg);
+    return false;
+}
+
+/*!
+Write a plain old data value.
+
+\param os
+stream that the value is written to.
+
+\param value
+value that is written.
+*/
+template <class Type>
+void binary_write(std::ostream& os, const Type& value)
+{   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() );
+    os.write( reinterpret_cast<const char*>( &value ), sizeof(Type) );
+}
+
+/*!
+Read a plain old data value.
+
+\param is
+stream that the value is read from.
+
+\param value
+the input value does not matter. Upon return it is the value read.
+
+\return
+is false (and an error has been reported) if the value could not be read.
+*/
+template <class Type>
+bool binary_read(std::istream& is, Type& value)
+{   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() );
+    is.read( reinterpret_cast<char*>( &value ), sizeof(Type) );
+    if( ! is.good() ) return binary_error(
+        "from_binary: unexpected end of input or read error"
+    );
+    return true;
+}
+
+/*!
+Write a vector of plain old data values.
+The length of the vector is written followed by the memory
+for the elements in one block.
+
+\tparam Vector
+is pod_vector<Type> or pod_vector_maybe<Type> where Type is plain old data.
+
+\param os
+stream that the vector is written to.
+
+\param vec
+vector that is written.
+*/
+template <class Vector>
+void binary_write_vec(std::ostream& os, const Vector& vec)
+{   size_t length = vec.size();
+    binary_write(os, length);
+    if( length > 0 ) os.write(
+        reinterpret_cast<const char*>( vec.data() ), std::streamsize(
+        length * sizeof( vec[0] ) )
+    );
+}
+
+/*!
+Read a vector of plain old data values.
+
+\tparam Vector
+is pod_vector<Type> or pod_vector_maybe<Type> where Type is plain old data.
+
+\param is
+stream that the vector is read from.
+
+\param vec
+the input value does not matter. Upon return it is the vector read.
+The memory for the elements is read in blocks
+(there is no parsing of the elements).
+
+\return
+is false (and an error has been reported) if the vector could not be read.
+
+\par Length
+The length is checked against the rest of the stream before any memory
+is allocated. If the stream does not support seeking, the vector is
+read in blocks of at most 1MB so that a bad length does not allocate
+more than one block beyond the data that is actually in the stream.
+*/
+template <class Vector>
+bool binary_read_vec(std::istream& is, Vector& vec)
+{   size_t length;
+    if( ! binary_read(is, length) )
+        return false;
+    size_t element = sizeof( vec[0] );
+    //
+    // check length against the rest of the stream (if it can seek)
+    bool checked       = false;
+    std::streampos pos = is.tellg();
+    if( pos != std::streampos(-1) )
+    {   is.seekg(0, std::ios::end);
+        std::streampos end = is.tellg();
+        is.seekg(pos);
+        if( end != std::streampos(-1) && is.good() )
+        {   if( end < pos || length > size_t(end - pos) / element )
+                return binary_error(
+                    "from_binary: vector length is longer than the input"
+                );
+            checked = true;
+        }
+        is.clear();
+    }
+    size_t block = length;
+    if( ! checked )
+        block = std::max( size_t(1), size_t(1 << 20) / element );
+    //
+    vec.resize(0);
+    while( vec.size() < length )
+    {   size_t n     = std::min(block, length - vec.size() );
+        size_t start = vec.extend(n);
+        is.read(
+            reinterpret_cast<char*>( vec.data() + start ),
+            std::streamsize( n * element )
+        );
+        if( ! is.good() ) return binary_error(
+            "from_binary: unexpected end of input or read error"
+        );
+    }
+    return true;
+}
+
+/*!
+Write a bool value as one byte that is zero or one.
+
+\param os
+stream that the value is written to.
+
+\param value
+value that is written.
+*/
+inline void binary_write_bool(std::ostream& os, bool value)
+{   unsigned char byte = static_cast<unsigned char>( value );
+    binary_write(os, byte);
+}
+
+/*!
+Read a bool value written by binary_write_bool.
+
+\param is
+stream that the value is read from.
+
+\param value
+the input value does not matter. Upon return it is the value read.
+
+\return
+is false (and an error has been reported) if the value could not be read
+or the byte read is not zero or one.
+*/
+inline bool binary_read_bool(std::istream& is, bool& value)
+{   unsigned char byte;
+    if( ! binary_read(is, byte) )
+        return false;
+    if( byte > 1 ) return binary_error(
+        "from_binary: a bool value is not zero or one"
+    );
+    value = byte == 1;
+    return true;
+}
+
+/*!
+Write a vector of bool values as bytes that are zero or one.
+
+\param os
+stream that the vector is written to.
+
+\param vec
+vector that is written.
+*/
+inline void binary_write_vec_bool(
+    std::ostream& os, const pod_vector<bool>& vec
+)
+{   pod_vector<unsigned char> byte( vec.size() );
+    for(size_t i = 0; i < vec.size(); ++i)
+        byte[i] = static_cast<unsigned char>( vec[i] );
+    binary_write_vec(os, byte);
+}
+
+/*!
+Read a vector of bool values written by binary_write_vec_bool.
+
+\param is
+stream that the vector is read from.
+
+\param vec
+the input value does not matter. Upon return it is the vector read.
+
+\return
+is false (and an error has been reported) if the vector could not be read
+or one of the bytes read is not zero or one.
+*/
+inline bool binary_read_vec_bool(std::istream& is, pod_vector<bool>& vec)
+{   pod_vector<unsigned char> byte;
+    if( ! binary_read_vec(is, byte) )
+        return false;
+    vec.resize( byte.size() );
+    for(size_t i = 0; i < byte.size(); ++i)
+    {   if( byte[i] > 1 ) return binary_error(
+            "from_binary: a bool value is not zero or one"
+        );
+        vec[i] = byte[i] == 1;
+    }
+    return true;
+}
+
+/*!
+Write the header for a binary operation sequence.
+
+\tparam Base
+is the base type for the operation sequence.
+
+\param os
+stream that the header is written to.
+The header identifies the format, its version, the byte order,
+the size of the types stored, and the number of operator codes.
+*/
+template <class Base>
+void binary_header_write(std::ostream& os)
+{   const char* magic = "CppADbin";
+    os.write(magic, 8);
+    binary_write(os, unsigned(CPPAD_BINARY_IO_VERSION) );
+    binary_write(os, unsigned(0x01020304) );
+    binary_write(os, unsigned( sizeof(size_t) ) );
+    binary_write(os, unsigned( sizeof(addr_t) ) );
+    binary_write(os, unsigned( sizeof(opcode_t) ) );
+    binary_write(os, unsigned( sizeof(Base) ) );
+    binary_write(os, unsigned( NumberOp ) );
+    binary_write(os, unsigned( number_dyn ) );
+}
+
+/*!
+Read and check the header for a binary operation sequence.
+
+\tparam Base
+is the base type for the operation sequence.
+
+\param is
+stream that the header is read from.
+
+\return
+is false (and an error has been reported)
+if the header does not agree with the one that binary_header_write
+would write on this machine.
+*/
+template <class Base>
+bool binary_header_read(std::istream& is)
+{   char magic[9];
+    is.read(magic, 8);
+    magic[8] = '\0';
+    if( ! is.good() || std::string(magic) != "CppADbin" )
+        return binary_error(
+            "from_binary: input is not a CppAD binary operation sequence"
+        );
+    // expected value and corresponding error message for each header value
+    const unsigned expected[] = {
+        unsigned(CPPAD_BINARY_IO_VERSION),
+        unsigned(0x01020304),
+        unsigned( sizeof(size_t) ),
+        unsigned( sizeof(addr_t) ),
+        unsigned( sizeof(opcode_t) ),
+        unsigned( sizeof(Base) ),
+        unsigned( NumberOp ),
+        unsigned( number_dyn )
+    };
+    const char* msg[] = {
+        "from_binary: input was written with a different format version",
+        "from_binary: input was written with a different byte order",
+        "from_binary: input was written with a different sizeof(size_t)",
+        "from_binary: input was written with a different tape address type",
+        "from_binary: input was written with a different operator code type",
+        "from_binary: input was written with a different Base type",
+        "from_binary: input was written by a different version of CppAD",
+        "from_binary: input was written by a different version of CppAD"
+    };
+    size_t n_value = sizeof(expected) / sizeof(expected[0]);
+    for(size_t i = 0; i < n_value; ++i)
+    {   unsigned value;
+        if( ! binary_read(is, value) )
+            return false;
+        if( value != expected[i] )
+            return binary_error( msg[i] );
+    }
+    return true;
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
@@ -14,6 +14,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 # include <cppad/configure.hpp>
 # include <cppad/local/cppad_colpack.hpp>
+# include <cppad/local/color_order.hpp>
 
 namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
 /*!
@@ -67,13 +68,21 @@ It follows that neither of these pairs appear in the set of
 This routine tries to minimize, with respect to the choice of colors,
 the maximum, with respct to k, of <code>color[ row[k] ]</code>
 (not counting the indices k for which row[k] == m).
+
+\param ordering [in]
+is the order in which the rows are colored.
+If it is color_order_natural, the rows are colored in increasing order
+without forming the graph of rows that cannot have the same color.
+Otherwise this graph is formed and colored using color_order_vertices
+and color_greedy.
 */
 template <class SetVector, class SizeVector>
 void color_general_cppad(
     const SetVector&        pattern ,
     const SizeVector&       row     ,
     const SizeVector&       col     ,
-    CppAD::vector<size_t>&  color   )
+    CppAD::vector<size_t>&  color   ,
+    color_order_enum        ordering = color_order_natural )
 {
     size_t K = row.size();
     size_t m = pattern.n_set();
@@ -126,6 +135,65 @@ void color_general_cppad(
     for(size_t j = 0; j < n; ++j)
         not_appear.process_post(j);
 
+    if( ordering != color_order_natural )
+    {   // edges of the graph; i.e., rows that cannot have the same color
+        // (same conditions as in the natural order algorithm below)
+        CppAD::vector<size_t> first, second;
+        for(size_t i = 0; i < m; i++) if( row_appear[i] )
+        {   typename SetVector::const_iterator pattern_itr(pattern, i);
+            size_t j = *pattern_itr;
+            while( j != pattern.end() )
+            {   typename SetVector::const_iterator c2r_itr(c2r_appear, j);
+                size_t r = *c2r_itr;
+                while( r != c2r_appear.end() )
+                {   if( r < i )
+                    {   first.push_back(i);
+                        second.push_back(r);
+                    }
+                    r = *(++c2r_itr);
+                }
+                j = *(++pattern_itr);
+            }
+            typename SetVector::const_iterator r2c_itr(r2c_appear, i);
+            j = *r2c_itr;
+            while( j != r2c_appear.end() )
+            {   typename SetVector::const_iterator not_itr(not_appear, j);
+                size_t r = *not_itr;
+                while( r != not_appear.end() )
+                {   if( row_appear[r] )
+                    {   first.push_back(i);
+                        second.push_back(r);
+                    }
+                    r = *(++not_itr);
+                }
+                j = *(++r2c_itr);
+            }
+        }
+        CppAD::vector<size_t> adj_ptr, adj, order, trial_color(m);
+        color_graph(m, first, second, adj_ptr, adj);
+        //
+        // color the graph, keeping the best result when there are trials
+        size_t n_trial = 1;
+        if( ordering == color_order_random )
+            n_trial += color_order_n_random;
+        size_t n_color = m + 1;
+        color.resize(m);
+        for(size_t trial = 0; trial < n_trial; ++trial)
+        {   color_order_vertices(
+                adj_ptr, adj, row_appear, ordering, trial, order
+            );
+            size_t n_trial_color = color_greedy(
+                adj_ptr, adj, order, trial_color
+            );
+            if( n_trial_color < n_color )
+            {   n_color = n_trial_color;
+                for(size_t i = 0; i < m; ++i)
+                    color[i] = trial_color[i];
+            }
+        }
+        return;
+    }
+
     // initial coloring
     color.resize(m);
     size_t ell = 0;
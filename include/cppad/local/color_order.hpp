@@ -0,0 +1,405 @@
+# ifndef CPPAD_LOCAL_COLOR_ORDER_HPP
+# define CPPAD_LOCAL_COLOR_ORDER_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <algorithm>
+# include <string>
+# include <cppad/utility/vector.hpp>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file color_order.hpp
+Vertex orderings and greedy coloring for the CppAD coloring algorithms.
+*/
+
+/// orderings in which the vertices of a graph are colored
+enum color_order_enum {
+    /// increasing vertex index
+    color_order_natural,
+    /// decreasing degree
+    color_order_largest_first,
+    /// repeatedly remove a vertex of minimum degree, color in reverse order
+    color_order_smallest_last,
+    /// next vertex has the most neighbors that are already ordered
+    color_order_incidence_degree,
+    /// best of smallest last and color_order_n_random random orderings
+    color_order_random
+};
+
+/// number of pseudo random orderings tried by color_order_random
+const size_t color_order_n_random = 10;
+
+// --------------------------------------------------------------------------
+/*!
+Check for a coloring method with an optional ordering suffix.
+
+\param coloring [in]
+is the coloring method requested by the user; e.g., "cppad.smallest_last".
+
+\param method [in]
+is the method without the ordering suffix; e.g., "cppad".
+
+\param ordering [in/out]
+The input value is the ordering used when coloring is equal to method.
+If coloring is method followed by a "." and the name of an ordering,
+the output value is that ordering.
+
+\return
+is true if coloring is method, or method followed by a "." and one of the
+names natural, largest_first, smallest_last, incidence_degree, random.
+*/
+inline bool color_order_method(
+    const std::string& coloring ,
+    const std::string& method   ,
+    color_order_enum&  ordering )
+{   if( coloring == method )
+        return true;
+    size_t n = method.size();
+    if( coloring.size() <= n + 1 )
+        return false;
+    if( coloring.compare(0, n, method) != 0 || coloring[n] != '.' )
+        return false;
+    std::string name = coloring.substr(n + 1);
+    if( name == "natural" )
+        ordering = color_order_natural;
+    else if( name == "largest_first" )
+        ordering = color_order_largest_first;
+    else if( name == "smallest_last" )
+        ordering = color_order_smallest_last;
+    else if( name == "incidence_degree" )
+        ordering = color_order_incidence_degree;
+    else if( name == "random" )
+        ordering = color_order_random;
+    else
+        return false;
+    return true;
+}
+// --------------------------------------------------------------------------
+/*!
+Doubly linked lists of vertices, one list for each bucket (degree value).
+The value n_vertex is used for the end of a list.
+*/
+class color_bucket {
+private:
+    /// number of vertices (also used for null links)
+    size_t                n_vertex_;
+    /// first vertex in each bucket
+    CppAD::vector<size_t> first_;
+    /// next vertex in the same bucket
+    CppAD::vector<size_t> next_;
+    /// previous vertex in the same bucket
+    CppAD::vector<size_t> previous_;
+public:
+    /// create n_bucket empty buckets for vertices less than n_vertex
+    color_bucket(size_t n_bucket, size_t n_vertex)
+    : n_vertex_(n_vertex)
+    , first_(n_bucket)
+    , next_(n_vertex)
+    , previous_(n_vertex)
+    {   for(size_t b = 0; b < n_bucket; ++b)
+            first_[b] = n_vertex;
+    }
+    /// first vertex in bucket b (n_vertex if it is empty)
+    size_t first(size_t b) const
+    {   return first_[b]; }
+    /// add vertex v to the front of bucket b
+    void insert(size_t b, size_t v)
+    {   next_[v]     = first_[b];
+        previous_[v] = n_vertex_;
+        if( first_[b] != n_vertex_ )
+            previous_[ first_[b] ] = v;
+        first_[b] = v;
+    }
+    /// remove vertex v from bucket b
+    void remove(size_t b, size_t v)
+    {   if( previous_[v] == n_vertex_ )
+            first_[b] = next_[v];
+        else
+            next_[ previous_[v] ] = next_[v];
+        if( next_[v] != n_vertex_ )
+            previous_[ next_[v] ] = previous_[v];
+    }
+};
+// --------------------------------------------------------------------------
+/*!
+Convert a list of edges to the adjacency lists for an undirected graph.
+
+\param n_vertex [in]
+is the number of vertices in the graph.
+
+\param first [in]
+is the first vertex for each edge.
+
+\param second [in]
+is the second vertex for each edge (same size as first).
+Edges with first[k] == second[k] are ignored and both
+(first[k], second[k]) and (second[k], first[k]) are included in the graph.
+
+\param adj_ptr [out]
+has size n_vertex + 1.
+The neighbors of vertex v are adj[ adj_ptr[v] ], ..., adj[ adj_ptr[v+1] - 1].
+
+\param adj [out]
+is the neighbors for each vertex (without duplicates).
+*/
+inline void color_graph(
+    size_t                       n_vertex ,
+    const CppAD::vector<size_t>& first    ,
+    const CppAD::vector<size_t>& second   ,
+    CppAD::vector<size_t>&       adj_ptr  ,
+    CppAD::vector<size_t>&       adj      )
+{   size_t n_edge = first.size();
+    CPPAD_ASSERT_UNKNOWN( second.size() == n_edge );
+    //
+    // count number of entries for each vertex (with duplicates)
+    CppAD::vector<size_t> count(n_vertex + 1);
+    for(size_t v = 0; v <= n_vertex; ++v)
+        count[v] = 0;
+    for(size_t k = 0; k < n_edge; ++k)
+    if( first[k] != second[k] )
+    {   ++count[ first[k] ];
+        ++count[ second[k] ];
+    }
+    CppAD::vector<size_t> start(n_vertex + 1);
+    start[0] = 0;
+    for(size_t v = 0; v < n_vertex; ++v)
+        start[v + 1] = start[v] + count[v];
+    //
+    // adjacency lists with duplicates
+    CppAD::vector<size_t> all( start[n_vertex] );
+    for(size_t v = 0; v < n_vertex; ++v)
+        count[v] = start[v];
+    for(size_t k = 0; k < n_edge; ++k)
+    if( first[k] != second[k] )
+    {   all[ count[ first[k] ]++ ]  = second[k];
+        all[ count[ second[k] ]++ ] = first[k];
+    }
+    //
+    // remove duplicates
+    CppAD::vector<size_t> mark(n_vertex);
+    for(size_t v = 0; v < n_vertex; ++v)
+        mark[v] = n_vertex;
+    adj_ptr.resize(n_vertex + 1);
+    adj.resize( start[n_vertex] );
+    size_t n_adj = 0;
+    for(size_t v = 0; v < n_vertex; ++v)
+    {   adj_ptr[v] = n_adj;
+        for(size_t ell = start[v]; ell < start[v + 1]; ++ell)
+        {   size_t w = all[ell];
+            if( mark[w] != v )
+            {   mark[w]      = v;
+                adj[n_adj++] = w;
+            }
+        }
+    }
+    adj_ptr[n_vertex] = n_adj;
+    adj.resize(n_adj);
+}
+// --------------------------------------------------------------------------
+/*!
+Determine the order in which to color the vertices of a graph.
+
+\param adj_ptr [in]
+the neighbors of vertex v are adj[ adj_ptr[v] ], ...
+adj[ adj_ptr[v+1] - 1 ]; see color_graph.
+
+\param adj [in]
+is the neighbors for each vertex. The neighbors of a vertex that is
+not included must also not be included.
+
+\param include [in]
+is true for the vertices that are colored.
+
+\param ordering [in]
+is the ordering algorithm.
+
+\param trial [in]
+If ordering is color_order_random,
+trial zero is smallest last and other trials are pseudo random
+(and only depend on trial). Otherwise trial is not used.
+
+\param order [out]
+is the included vertices in the order they should be colored.
+*/
+inline void color_order_vertices(
+    const CppAD::vector<size_t>& adj_ptr  ,
+    const CppAD::vector<size_t>& adj      ,
+    const CppAD::vector<bool>&   include  ,
+    color_order_enum             ordering ,
+    size_t                       trial    ,
+    CppAD::vector<size_t>&       order    )
+{   size_t n_vertex = include.size();
+    CPPAD_ASSERT_UNKNOWN( adj_ptr.size() == n_vertex + 1 );
+    //
+    // list of included vertices and the maximum degree
+    size_t n_include = 0;
+    size_t max_degree = 0;
+    for(size_t v = 0; v < n_vertex; ++v) if( include[v] )
+    {   ++n_include;
+        max_degree = std::max(max_degree, adj_ptr[v + 1] - adj_ptr[v]);
+    }
+    order.resize(n_include);
+    //
+    if( ordering == color_order_random && trial == 0 )
+        ordering = color_order_smallest_last;
+    //
+    if( ordering == color_order_natural || ordering == color_order_random )
+    {   size_t o = 0;
+        for(size_t v = 0; v < n_vertex; ++v) if( include[v] )
+            order[o++] = v;
+        if( ordering == color_order_natural )
+            return;
+        //
+        // Fisher-Yates shuffle using a linear congruential generator
+        size_t state = 12345 + 1000 * trial;
+        for(size_t i = n_include; i > 1; --i)
+        {   state = (1103515245 * state + 12345) & 0x7fffffff;
+            size_t j = (state >> 8) % i;
+            std::swap(order[i - 1], order[j]);
+        }
+        return;
+    }
+    // largest first: counting sort by decreasing degree
+    if( ordering == color_order_largest_first )
+    {   CppAD::vector<size_t> start(max_degree + 2);
+        for(size_t d = 0; d < max_degree + 2; ++d)
+            start[d] = 0;
+        for(size_t v = 0; v < n_vertex; ++v) if( include[v] )
+            ++start[ max_degree - (adj_ptr[v + 1] - adj_ptr[v]) + 1 ];
+        for(size_t d = 0; d <= max_degree; ++d)
+            start[d + 1] += start[d];
+        for(size_t v = 0; v < n_vertex; ++v) if( include[v] )
+            order[ start[ max_degree - (adj_ptr[v+1] - adj_ptr[v]) ]++ ] = v;
+        return;
+    }
+    // degree of each vertex and bucket lists indexed by degree
+    CppAD::vector<size_t> degree(n_vertex);
+    CppAD::vector<bool>   done(n_vertex);
+    color_bucket bucket(max_degree + 1, n_vertex);
+    for(size_t v = n_vertex; v > 0; --v) if( include[v - 1] )
+    {   degree[v - 1] = adj_ptr[v] - adj_ptr[v - 1];
+        done[v - 1]   = false;
+    }
+    //
+    if( ordering == color_order_smallest_last )
+    {   // repeatedly remove a vertex with smallest degree in remaining graph
+        for(size_t v = n_vertex; v > 0; --v) if( include[v - 1] )
+            bucket.insert(degree[v - 1], v - 1);
+        size_t min_degree = 0;
+        for(size_t o = n_include; o > 0; --o)
+        {   while( bucket.first(min_degree) == n_vertex )
+                ++min_degree;
+            size_t v = bucket.first(min_degree);
+            bucket.remove(min_degree, v);
+            done[v]      = true;
+            order[o - 1] = v;
+            for(size_t ell = adj_ptr[v]; ell < adj_ptr[v + 1]; ++ell)
+            {   size_t w = adj[ell];
+                if( ! done[w] )
+                {   bucket.remove(degree[w], w);
+                    --degree[w];
+                    bucket.insert(degree[w], w);
+                    min_degree = std::min(min_degree, degree[w]);
+                }
+            }
+        }
+        return;
+    }
+    CPPAD_ASSERT_UNKNOWN( ordering == color_order_incidence_degree );
+    //
+    // incidence degree: next vertex has most neighbors already ordered;
+    // ties are broken using largest first (first vertex in a bucket).
+    CppAD::vector<size_t> largest_first;
+    color_order_vertices(
+        adj_ptr, adj, include, color_order_largest_first, 0, largest_first
+    );
+    for(size_t o = n_include; o > 0; --o)
+    {   size_t v  = largest_first[o - 1];
+        degree[v] = 0;
+        bucket.insert(0, v);
+    }
+    size_t max_incidence = 0;
+    for(size_t o = 0; o < n_include; ++o)
+    {   while( bucket.first(max_incidence) == n_vertex )
+            --max_incidence;
+        size_t v = bucket.first(max_incidence);
+        bucket.remove(max_incidence, v);
+        done[v]  = true;
+        order[o] = v;
+        for(size_t ell = adj_ptr[v]; ell < adj_ptr[v + 1]; ++ell)
+        {   size_t w = adj[ell];
+            if( ! done[w] )
+            {   bucket.remove(degree[w], w);
+                ++degree[w];
+                bucket.insert(degree[w], w);
+                max_incidence = std::max(max_incidence, degree[w]);
+            }
+        }
+    }
+    return;
+}
+// --------------------------------------------------------------------------
+/*!
+Greedy distance one coloring of a graph.
+
+\param adj_ptr [in]
+see color_order_vertices.
+
+\param adj [in]
+see color_order_vertices.
+
+\param order [in]
+is the vertices that are colored, in the order they are colored.
+
+\param color [out]
+has size equal to the number of vertices n_vertex.
+If v is in order, color[v] is the smallest color that is not used by
+a neighbor of v that comes before it in order.
+Otherwise color[v] == n_vertex.
+
+\return
+is the number of colors used.
+*/
+inline size_t color_greedy(
+    const CppAD::vector<size_t>& adj_ptr  ,
+    const CppAD::vector<size_t>& adj      ,
+    const CppAD::vector<size_t>& order    ,
+    CppAD::vector<size_t>&       color    )
+{   size_t n_vertex = adj_ptr.size() - 1;
+    CPPAD_ASSERT_UNKNOWN( color.size() == n_vertex );
+    for(size_t v = 0; v < n_vertex; ++v)
+        color[v] = n_vertex;
+    //
+    // forbidden[c] == v if color c is forbidden for vertex v
+    CppAD::vector<size_t> forbidden(n_vertex);
+    for(size_t c = 0; c < n_vertex; ++c)
+        forbidden[c] = n_vertex;
+    size_t n_color = 0;
+    for(size_t o = 0; o < order.size(); ++o)
+    {   size_t v = order[o];
+        for(size_t ell = adj_ptr[v]; ell < adj_ptr[v + 1]; ++ell)
+        {   size_t c = color[ adj[ell] ];
+            if( c < n_vertex )
+                forbidden[c] = v;
+        }
+        size_t c = 0;
+        while( forbidden[c] == v )
+            ++c;
+        color[v] = c;
+        n_color  = std::max(n_color, c + 1);
+    }
+    return n_color;
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+# endif
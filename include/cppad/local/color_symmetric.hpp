@@ -2,6 +2,7 @@
 # define CPPAD_LOCAL_COLOR_SYMMETRIC_HPP
 # include <cppad/configure.hpp>
 # include <cppad/local/cppad_colpack.hpp>
+# include <cppad/local/color_order.hpp>
 
 /* --------------------------------------------------------------------------
 CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
@@ -214,6 +215,195 @@ void color_symmetric_cppad(
     return;
 }
 
+// --------------------------------------------------------------------------
+/*!
+Greedy star coloring of a graph; i.e., a distance one coloring such that
+every path of four vertices uses at least three colors.
+This is Algorithm 4.1 in
+What Color Is Your Jacobian? Graph Coloring for Computing Derivatives
+by Assefaw Gebremedhin, Fredrik Manne, and Alex Pothen.
+
+\param adj_ptr [in]
+see color_order_vertices.
+
+\param adj [in]
+see color_order_vertices.
+
+\param order [in]
+is the vertices that are colored, in the order they are colored.
+
+\param color [out]
+has size equal to the number of vertices n_vertex.
+If v is in order, color[v] is its color,
+otherwise color[v] == n_vertex.
+
+\return
+is the number of colors used.
+*/
+inline size_t color_star_greedy(
+    const CppAD::vector<size_t>& adj_ptr  ,
+    const CppAD::vector<size_t>& adj      ,
+    const CppAD::vector<size_t>& order    ,
+    CppAD::vector<size_t>&       color    )
+{   size_t n_vertex = adj_ptr.size() - 1;
+    CPPAD_ASSERT_UNKNOWN( color.size() == n_vertex );
+    for(size_t v = 0; v < n_vertex; ++v)
+        color[v] = n_vertex;
+    //
+    // forbidden[c] == v if color c is forbidden for vertex v
+    CppAD::vector<size_t> forbidden(n_vertex);
+    for(size_t c = 0; c < n_vertex; ++c)
+        forbidden[c] = n_vertex;
+    size_t n_color = 0;
+    for(size_t o = 0; o < order.size(); ++o)
+    {   size_t v = order[o];
+        for(size_t ell = adj_ptr[v]; ell < adj_ptr[v + 1]; ++ell)
+        {   size_t w = adj[ell];
+            if( color[w] < n_vertex )
+                forbidden[ color[w] ] = v;
+        }
+        for(size_t ell = adj_ptr[v]; ell < adj_ptr[v + 1]; ++ell)
+        {   size_t w = adj[ell];
+            for(size_t e2 = adj_ptr[w]; e2 < adj_ptr[w + 1]; ++e2)
+            {   size_t x = adj[e2];
+                if( x != v && color[x] < n_vertex )
+                {   if( color[w] == n_vertex )
+                    {   // path v, w, x with w not yet colored
+                        forbidden[ color[x] ] = v;
+                    }
+                    else
+                    {   // path v, w, x, y would use two colors
+                        size_t e3 = adj_ptr[x];
+                        while( e3 < adj_ptr[x + 1] )
+                        {   size_t y = adj[e3++];
+                            if( y != w && color[y] == color[w] )
+                            {   forbidden[ color[x] ] = v;
+                                e3 = adj_ptr[x + 1];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        size_t c = 0;
+        while( forbidden[c] == v )
+            ++c;
+        color[v] = c;
+        n_color  = std::max(n_color, c + 1);
+    }
+    return n_color;
+}
+// --------------------------------------------------------------------------
+/*!
+CppAD star coloring algorithm for determining which rows of a symmetric
+sparse matrix can be computed together.
+
+\copydetails CppAD::local::color_symmetric_cppad
+
+\param ordering
+is the order in which the rows are colored; see color_order_vertices.
+*/
+template <class SetVector>
+void color_star_cppad(
+    const SetVector&        pattern   ,
+    CppAD::vector<size_t>&  row       ,
+    CppAD::vector<size_t>&  col       ,
+    CppAD::vector<size_t>&  color     ,
+    color_order_enum        ordering  )
+{
+    size_t K = row.size();
+    size_t m = pattern.n_set();
+    CPPAD_ASSERT_UNKNOWN( m == pattern.end() );
+    CPPAD_ASSERT_UNKNOWN( color.size() == m );
+    CPPAD_ASSERT_UNKNOWN( col.size()   == K );
+
+    // rows that are in some pair ( row[k], col[k] )
+    CppAD::vector<bool> include(m);
+    for(size_t i = 0; i < m; ++i)
+        include[i] = false;
+    for(size_t k = 0; k < K; ++k)
+    {   CPPAD_ASSERT_UNKNOWN( pattern.is_element(row[k], col[k]) );
+        include[ row[k] ] = true;
+        include[ col[k] ] = true;
+    }
+
+    // adjacency graph for the included rows
+    CppAD::vector<size_t> first, second;
+    for(size_t i = 0; i < m; ++i) if( include[i] )
+    {   typename SetVector::const_iterator pattern_itr(pattern, i);
+        size_t j = *pattern_itr;
+        while( j != pattern.end() )
+        {   if( include[j] )
+            {   first.push_back(i);
+                second.push_back(j);
+            }
+            j = *(++pattern_itr);
+        }
+    }
+    CppAD::vector<size_t> adj_ptr, adj, order, trial_color(m);
+    color_graph(m, first, second, adj_ptr, adj);
+
+    // star coloring, keeping the best result when there are trials
+    size_t n_trial = 1;
+    if( ordering == color_order_random )
+        n_trial += color_order_n_random;
+    size_t n_color = m + 1;
+    for(size_t trial = 0; trial < n_trial; ++trial)
+    {   color_order_vertices(adj_ptr, adj, include, ordering, trial, order);
+        size_t n_trial_color = color_star_greedy(
+            adj_ptr, adj, order, trial_color
+        );
+        if( n_trial_color < n_color )
+        {   n_color = n_trial_color;
+            for(size_t i = 0; i < m; ++i)
+                color[i] = trial_color[i];
+        }
+    }
+
+    // Entry (i, j) can be computed using the color for row i if no other
+    // neighbor of j has that color. Otherwise, the star coloring
+    // ensures it can be computed using the color for row j.
+    CppAD::vector<bool> used(m);
+    for(size_t i = 0; i < m; ++i)
+        used[i] = false;
+    for(size_t k = 0; k < K; ++k)
+    {   size_t i = row[k];
+        size_t j = col[k];
+        bool reflect = false;
+        for(size_t ell = adj_ptr[j]; ell < adj_ptr[j + 1]; ++ell)
+        {   size_t i2 = adj[ell];
+            reflect |= (i2 != i) & (color[i2] == color[i]);
+        }
+        if( reflect )
+        {   row[k] = j;
+            col[k] = i;
+# ifndef NDEBUG
+            for(size_t ell = adj_ptr[i]; ell < adj_ptr[i + 1]; ++ell)
+            {   size_t j2 = adj[ell];
+                CPPAD_ASSERT_UNKNOWN( j2 == j || color[j2] != color[j] );
+            }
+# endif
+        }
+        used[ row[k] ] = true;
+    }
+
+    // rows that are not used do not need a color, renumber the colors
+    // so that each color from zero to the number of colors is used
+    CppAD::vector<size_t> new_color(m + 1);
+    for(size_t c = 0; c <= m; ++c)
+        new_color[c] = m;
+    n_color = 0;
+    for(size_t i = 0; i < m; ++i)
+    {   if( ! used[i] )
+            color[i] = m;
+        else
+        {   if( new_color[ color[i] ] == m )
+                new_color[ color[i] ] = n_color++;
+            color[i] = new_color[ color[i] ];
+        }
+    }
+    return;
+}
 // --------------------------------------------------------------------------
 /*!
 Colpack algorithm for determining which rows of a symmetric sparse matrix
@@ -0,0 +1,280 @@
+# ifndef CPPAD_LOCAL_COLOR_THREAD_HPP
+# define CPPAD_LOCAL_COLOR_THREAD_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/configure.hpp>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <atomic>
+# include <exception>
+# include <thread>
+# include <vector>
+# endif
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file color_thread.hpp
+Run the work for different colors of a sparse derivative
+calculation on different threads.
+*/
+
+/*!
+Is a team of threads created by color_thread_run currently running.
+
+\return
+reference to the flag that is true while the team is running.
+*/
+inline bool& color_thread_active(void)
+{   static bool active = false;
+    return active;
+}
+
+/*!
+Thread number of the current thread as assigned by color_thread_run.
+
+\return
+reference to the thread number for the current thread.
+If C++11 threads are not available, there is only one such number.
+*/
+inline size_t& color_thread_index(void)
+{
+# if CPPAD_USE_CPLUSPLUS_2011
+    static thread_local size_t index = 0;
+# else
+    static size_t index = 0;
+# endif
+    return index;
+}
+
+/// in_parallel routine passed to thread_alloc::parallel_setup
+inline bool color_thread_in_parallel(void)
+{   return color_thread_active(); }
+
+/// thread_num routine passed to thread_alloc::parallel_setup
+inline size_t color_thread_num(void)
+{   return color_thread_index(); }
+
+/*!
+Has parallel_ad<Base>() been called.
+
+\return
+reference to the flag that parallel_ad<Base> sets to true.
+*/
+template <class Base>
+bool& color_thread_parallel_ad(void)
+{   static bool called = false;
+    return called;
+}
+
+# if CPPAD_USE_CPLUSPLUS_2011
+/*!
+Function executed by each of the threads (except the master thread).
+
+\param thread [in]
+is the thread number for this thread.
+
+\param worker [in]
+is the routine that does the work for each thread.
+
+\param info [in]
+is the information passed to worker.
+
+\param state [in]
+The thread waits while *state is zero. It then calls worker if *state
+is one and returns without calling worker if *state is two
+(the team could not be started).
+
+\param error [out]
+if worker throws an exception, it is caught and stored in *error.
+*/
+inline void color_thread_start(
+    size_t              thread           ,
+    void (*worker)(size_t, void*)        ,
+    void*               info             ,
+    std::atomic<int>*   state            ,
+    std::exception_ptr* error            )
+{   while( state->load() == 0 )
+        std::this_thread::yield();
+    if( state->load() != 1 )
+        return;
+    color_thread_index() = thread;
+    try
+    {   worker(thread, info); }
+    catch(...)
+    {   *error = std::current_exception(); }
+}
+
+/*!
+A team of threads used by color_thread_run.
+
+The constructor sets up thread_alloc for the team.
+The threads that are started wait until run is called,
+so that a worker does not wait for threads that could not be started.
+The destructor waits for the threads that were started and
+returns thread_alloc to single thread mode, so this is done
+even when an exception is thrown.
+*/
+class color_thread_team {
+private:
+    /// number of threads in the team (including the master thread)
+    const size_t n_thread_;
+    /// the threads that have been started
+    std::vector<std::thread> team_;
+    /// zero (wait), one (run the workers), or two (do not run the workers)
+    std::atomic<int> state_;
+public:
+    /// set up thread_alloc for a team with n_thread threads
+    color_thread_team(size_t n_thread) : n_thread_(n_thread), state_(0)
+    {   // so that start does not need to allocate memory
+        team_.reserve(n_thread - 1);
+        //
+        // a system thread keeps its thread number until the team is done
+        color_thread_index() = 0;
+        bool cache_thread_num = true;
+        thread_alloc::parallel_setup(
+            n_thread, color_thread_in_parallel, color_thread_num,
+            cache_thread_num
+        );
+        color_thread_active() = true;
+    }
+    /// start the thread with the specified thread number
+    void start(
+        size_t              thread           ,
+        void (*worker)(size_t, void*)        ,
+        void*               info             ,
+        std::exception_ptr* error            )
+    {   CPPAD_ASSERT_UNKNOWN( team_.size() + 1 == thread );
+        team_.emplace_back(
+            color_thread_start, thread, worker, info, &state_, error
+        );
+    }
+    /// the threads that have been started can call their workers
+    void run(void)
+    {   state_.store(1); }
+    /// wait for the threads and return thread_alloc to single thread mode
+    ~color_thread_team(void)
+    {   if( state_.load() == 0 )
+            state_.store(2);
+        for(size_t i = 0; i < team_.size(); ++i)
+            team_[i].join();
+        color_thread_active() = false;
+        for(size_t thread = 1; thread < n_thread_; ++thread)
+            thread_alloc::free_available(thread);
+        thread_alloc::parallel_setup(1, CPPAD_NULL, CPPAD_NULL);
+    }
+};
+# endif
+
+/*!
+Execute the work for each thread in a team.
+
+\tparam Base
+is the base type for the calculation;
+parallel_ad<Base>() must have been called if n_thread is greater than one.
+
+\param n_thread [in]
+is the number of threads in the team (including the current thread).
+If n_thread is one, worker is called by the current thread.
+Otherwise, the current program must be in sequential execution mode
+and thread_alloc::num_threads() must be one; i.e., the user has not
+set up thread_alloc for another multi-threading environment.
+This routine sets up thread_alloc for the team and then returns it to
+its single thread mode (the same as the state before the call).
+
+\param worker [in]
+For thread = 0, ..., n_thread-1, the call <code>worker(thread, info)</code>
+does the work corresponding to this thread. The work for thread zero
+is done by the current thread.
+Any memory allocated by a worker using thread_alloc
+must be returned before the worker returns.
+
+\param info [in,out]
+is the information passed to each call to worker.
+
+\par Exceptions
+If a worker throws an exception, it is caught and the other threads
+run to completion (workers that wait for each other must
+continue to do so after an exception).
+Then thread_alloc is returned to single thread mode
+and the exception is thrown again by the current thread
+(if more than one worker throws, the one with the lowest thread number
+is thrown).
+If one of the threads cannot be started, no worker is called
+and the exception from std::thread is thrown after the threads that
+were started have finished.
+
+\par C++11
+If C++11 is not available, the work for all the threads is executed
+sequentially by the current thread.
+*/
+template <class Base>
+void color_thread_run(
+    size_t n_thread                      ,
+    void (*worker)(size_t, void*)        ,
+    void*  info                          )
+{   CPPAD_ASSERT_UNKNOWN( n_thread > 0 );
+    if( n_thread == 1 )
+    {   worker(0, info);
+        return;
+    }
+    CPPAD_ASSERT_KNOWN(
+        color_thread_parallel_ad<Base>() ,
+        "n_thread > 1 and parallel_ad<Base>() has not been called"
+    );
+# if ! CPPAD_USE_CPLUSPLUS_2011
+    for(size_t thread = 0; thread < n_thread; ++thread)
+        worker(thread, info);
+# else
+    CPPAD_ASSERT_KNOWN(
+        ! thread_alloc::in_parallel() ,
+        "n_thread > 1 and currently in parallel execution mode"
+    );
+    CPPAD_ASSERT_KNOWN(
+        thread_alloc::num_threads() == 1 ,
+        "n_thread > 1 and thread_alloc::num_threads() is not one"
+    );
+    CPPAD_ASSERT_KNOWN(
+        n_thread <= CPPAD_MAX_NUM_THREADS ,
+        "n_thread is greater than CPPAD_MAX_NUM_THREADS"
+    );
+    // exception thrown by each thread (if any)
+    std::vector<std::exception_ptr> error(n_thread);
+    {   // set up thread_alloc for this team
+        color_thread_team team(n_thread);
+        //
+        // start the other threads
+        for(size_t thread = 1; thread < n_thread; ++thread)
+            team.start(thread, worker, info, &error[thread]);
+        team.run();
+        //
+        // work for the master thread
+        try
+        {   worker(0, info); }
+        catch(...)
+        {   error[0] = std::current_exception(); }
+        //
+        // the team destructor waits for the other threads to finish
+        // and returns thread_alloc to single thread mode
+    }
+    for(size_t thread = 0; thread < n_thread; ++thread)
+    {   if( error[thread] )
+            std::rethrow_exception( error[thread] );
+    }
+# endif
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
@@ -114,9 +114,12 @@ is the zeroth order Taylor coefficient corresponding to right.
 is vector specifying which operations are at this point are know to be
 unecessary and can be skipped.
 This is both an input and an output.
+
+\return
+is true if this operation set any of the elements of cskip_op to true.
 */
 template <class Base>
-void forward_cskip_op_0(
+bool forward_cskip_op_0(
     size_t               i_z            ,
     const addr_t*        arg            ,
     size_t               num_par        ,
@@ -151,7 +154,7 @@ void forward_cskip_op_0(
     }
     bool ok_to_skip = IdenticalCon(left) & IdenticalCon(right);
     if( ! ok_to_skip )
-        return;
+        return false;
 
     // initialize to avoid compiler warning
     bool true_case = false;
@@ -188,12 +191,11 @@ void forward_cskip_op_0(
     if( true_case )
     {   for(addr_t i = 0; i < arg[4]; i++)
             cskip_op[ arg[6+i] ] = true;
+        return arg[4] > 0;
     }
-    else
-    {   for(addr_t i = 0; i < arg[5]; i++)
-            cskip_op[ arg[6+arg[4]+i] ] = true;
-    }
-    return;
+    for(addr_t i = 0; i < arg[5]; i++)
+        cskip_op[ arg[6+arg[4]+i] ] = true;
+    return arg[5] > 0;
 }
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
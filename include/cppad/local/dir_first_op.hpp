@@ -0,0 +1,117 @@
+# ifndef CPPAD_LOCAL_DIR_FIRST_OP_HPP
+# define CPPAD_LOCAL_DIR_FIRST_OP_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file dir_first_op.hpp
+Loops over the directions used by the forward_*_op_dir routines when q == 1.
+
+The first order coefficients for the r directions are contiguous.
+The zero order coefficients used by these loops are passed by value,
+so they are not read from memory that is written by the loop.
+*/
+
+/*!
+First order coefficients that are a multiple of the argument coefficients.
+
+\param r
+number of directions.
+
+\param x
+<code>x[ell]</code> is the first order coefficient for the argument and
+direction ell, for ell = 0, ..., r-1.
+
+\param a
+multiplier for the argument coefficients.
+
+\param z
+<code>z[ell] = x[ell] * a</code> for ell = 0, ..., r-1.
+The vectors x and z are either equal or do not overlap.
+*/
+template <class Base>
+inline void forward_dir_first_mul(
+    size_t      r  ,
+    const Base* x  ,
+    Base        a  ,
+    Base*       z  )
+{   for(size_t ell = 0; ell < r; ell++)
+        z[ell] = x[ell] * a;
+}
+
+/*!
+First order coefficients that are a quotient of the argument coefficients.
+
+\param r
+number of directions.
+
+\param x
+<code>x[ell]</code> is the first order coefficient for the argument and
+direction ell, for ell = 0, ..., r-1.
+
+\param a
+divisor for the argument coefficients.
+
+\param z
+<code>z[ell] = x[ell] / a</code> for ell = 0, ..., r-1.
+The vectors x and z are either equal or do not overlap.
+*/
+template <class Base>
+inline void forward_dir_first_div(
+    size_t      r  ,
+    const Base* x  ,
+    Base        a  ,
+    Base*       z  )
+{   for(size_t ell = 0; ell < r; ell++)
+        z[ell] = x[ell] / a;
+}
+
+/*!
+First order coefficients that are a linear combination of
+two argument coefficients.
+
+\param r
+number of directions.
+
+\param x
+<code>x[ell]</code> is the first order coefficient for the first argument
+and direction ell, for ell = 0, ..., r-1.
+
+\param a
+multiplier for the first argument coefficients.
+
+\param y
+<code>y[ell]</code> is the first order coefficient for the second argument
+and direction ell, for ell = 0, ..., r-1.
+
+\param b
+multiplier for the second argument coefficients.
+
+\param z
+<code>z[ell] = x[ell] * a + y[ell] * b</code> for ell = 0, ..., r-1.
+The vector z does not overlap x or y.
+*/
+template <class Base>
+inline void forward_dir_first_dot(
+    size_t      r  ,
+    const Base* x  ,
+    Base        a  ,
+    const Base* y  ,
+    Base        b  ,
+    Base*       z  )
+{   for(size_t ell = 0; ell < r; ell++)
+        z[ell] = x[ell] * a + y[ell] * b;
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+# endif
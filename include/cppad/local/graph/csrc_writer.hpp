@@ -0,0 +1,70 @@
+# ifndef CPPAD_LOCAL_GRAPH_CSRC_WRITER_HPP
+# define CPPAD_LOCAL_GRAPH_CSRC_WRITER_HPP
+
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+  CppAD is distributed under the terms of the
+               Eclipse Public License Version 2.0.
+
+  This Source Code may also be made available under the following
+  Secondary License when the conditions for such availability set forth
+  in the Eclipse Public License, Version 2.0 are satisfied:
+        GNU General Public License, Version 2.0 or later.
+-------------------------------------------------------------------------- */
+
+# include <string>
+# include <ostream>
+# include <cppad/utility/vector.hpp>
+# include <cppad/local/graph/cpp_graph_op.hpp>
+
+/*
+$begin csrc_writer$$
+$spell
+    csrc
+    CppAD
+    obj
+    os
+    NDEBUG
+$$
+
+$section C Source Code Writer for an AD Graph$$
+
+$head Syntax$$
+$icode%ok% = csrc_writer( %os%, %graph_obj%, %function_name% )
+%$$
+
+$head os$$
+The C source code for a function that evaluates
+the AD graph is written to this stream; see
+$cref/to_csrc/to_csrc/C Function/$$ for a specification of the function.
+
+$head graph_obj$$
+This is a $code cpp_graph$$ object.
+It must not contain any discrete or atomic function operators.
+
+$head function_name$$
+is the name of the C function.
+
+$head ok$$
+If $icode graph_obj$$ contains an operator that cannot be converted
+to C source code, an error is reported using $cref ErrorHandler$$,
+nothing is written to $icode os$$, and $icode ok$$ is false.
+Otherwise, $icode ok$$ is true.
+This check is done even when $code NDEBUG$$ is defined.
+
+$head Prototype$$
+$srccode%hpp% */
+namespace CppAD { namespace local { namespace graph {
+    bool csrc_writer(
+        std::ostream&      os            ,
+        const cpp_graph&   graph_obj     ,
+        const std::string& function_name
+    );
+} } }
+/* %$$
+$end
+*/
+
+
+# endif
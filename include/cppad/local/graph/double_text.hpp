@@ -0,0 +1,102 @@
+# ifndef CPPAD_LOCAL_GRAPH_DOUBLE_TEXT_HPP
+# define CPPAD_LOCAL_GRAPH_DOUBLE_TEXT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cstdio>
+# include <cstdlib>
+# include <clocale>
+# include <cppad/configure.hpp>
+# include <cppad/core/cppad_assert.hpp>
+
+/*
+$begin graph_double_text$$
+$spell
+    const
+    snprintf
+    strtod
+    struct
+    Json
+    lconv
+$$
+
+$section Text for a Double That Converts Back to the Same Value$$
+
+$head Syntax$$
+$codei%double_text %text%(%value%)
+%$$
+$icode%text%.c_str()%$$
+
+$head value$$
+is the $code double$$ value that is converted to text.
+
+$head c_str$$
+is the $code '\0'$$ terminated text for $icode value$$.
+It uses the fewest significant digits, between 15 and 17,
+that convert back to $icode value$$.
+If $icode value$$ is not finite, it is the $code %g$$ text for
+$icode value$$; e.g., $code inf$$ or $code nan$$.
+This is used by the $cref json_writer$$ and
+the $cref csrc_writer$$.
+
+$head Locale$$
+The conversion uses $code std::snprintf$$ and $code std::strtod$$,
+which use the decimal point for the $code LC_NUMERIC$$ category of the
+current C locale.
+If this is not a period, it is replaced by a period in the text;
+i.e., the result does not depend on the C locale
+(the locale is not changed because that is not thread safe).
+
+$head Prototype$$
+$srccode%hpp% */
+namespace CppAD { namespace local { namespace graph {
+class double_text {
+private:
+    char text_[32];
+public:
+    double_text(double value);
+    const char* c_str(void) const
+    {   return text_; }
+};
+} } }
+/* %$$
+$end
+*/
+namespace CppAD { namespace local { namespace graph {
+
+inline double_text::double_text(double value)
+{   // a double has at most 17 significant digits, so this fits in text_
+    int n_digit = 15;
+    while( true )
+    {
+# if CPPAD_USE_CPLUSPLUS_2011
+        std::snprintf(text_, sizeof(text_), "%.*g", n_digit, value);
+# else
+        std::sprintf(text_, "%.*g", n_digit, value);
+# endif
+        if( n_digit == 17 || std::strtod(text_, CPPAD_NULL) == value )
+            break;
+        ++n_digit;
+    }
+    //
+    // replace the decimal point for the current locale by a period
+    const char* point = std::localeconv()->decimal_point;
+    if( point[0] != '.' && point[0] != '\0' && point[1] == '\0' )
+    {   for(char* ptr = text_; *ptr != '\0'; ++ptr)
+            if( *ptr == point[0] )
+                *ptr = '.';
+    }
+}
+
+} } }
+
+# endif
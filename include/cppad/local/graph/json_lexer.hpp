@@ -13,6 +13,7 @@ CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
 -------------------------------------------------------------------------- */
 
 # include <string>
+# include <istream>
 # include <cppad/core/cppad_assert.hpp>
 
 // BEGIN_NAMESPACE_CPPAD_LOCAL_GRAPH
@@ -32,14 +33,39 @@ $$
 
 $section json lexer: Private Data$$
 
-$head graph_$$
-The $cref json_ad_graph$$.
+$head json_$$
+If $code is_$$ is null, this is the entire $cref json_ad_graph$$.
+Otherwise, it is $code buffer_$$.
+
+$head is_$$
+If this is not null, the graph is read from this stream
+and only part of it is stored in $code buffer_$$.
+
+$head buffer_$$
+If $code is_$$ is not null, this contains the characters in the graph
+that have been read from the stream and are still needed.
+This includes the characters starting with the previous line
+that are used for error reporting,
+but at most $code json_lexer_n_context$$ characters before
+the current character (so that the size of $code buffer_$$ is bounded
+when the graph is one long line).
+
+$head buffer_start_$$
+is the index in the graph corresponding to the first character
+in $code json_$$ (it is always zero when $code is_$$ is null).
 
 $head index_$$
 is the index in the graph for the current character.
 If a token is returned, this corresponds to the last character
 it the token.
 
+$head line_start_$$
+is the index in the graph for the first character in the current line.
+
+$head prev_line_start_$$
+is the index in the graph for the first character in the previous line
+(it is zero when the current line is the first line).
+
 $head line_number_$$
 line number in the graph for the current character
 
@@ -72,8 +98,13 @@ sets the value of $code function_name_$$.
 $head Source Code$$
 $srccode%hpp% */
 private:
-    const std::string& json_;
+    const std::string* json_;
+    std::istream*      is_;
+    std::string        buffer_;
+    size_t             buffer_start_;
     size_t             index_;
+    size_t             line_start_;
+    size_t             prev_line_start_;
     size_t             line_number_;
     size_t             char_number_;
     std::string        token_;
@@ -139,7 +170,7 @@ is a $code local::graph::json_lexer$$ object.
 $head index_$$
 The input value of $code index_$$ is increased by one.
 It is an error to call this routine when the input value
-of $code index_$$ is greater than or equal $code json_.size()$$.
+of $code index_$$ does not correspond to a character in the graph.
 
 $head line_number_$$
 If the previous character, before  the call, was a new line,
@@ -157,6 +188,51 @@ private:
 /* %$$
 $end
 -------------------------------------------------------------------------------
+$begin json_lexer_get_char$$
+$spell
+    json
+    lexer
+    bool
+    ch
+$$
+
+$section json lexer: Access a Character in the Graph$$
+
+$head Syntax$$
+$icode%ok% = %json_lexer%.have_char(%index%)
+%$$
+$icode%ch% = %json_lexer%.get_char(%index%)
+%$$
+
+$head index$$
+is the index in the graph for the character.
+It must be greater than or equal the index for the first character
+in the previous line, and greater than or equal the index for the
+current character minus $code json_lexer_n_context$$.
+
+$head ok$$
+is true if the graph has a character with this index.
+If the graph is being read from a stream,
+more of the stream is read as necessary
+and characters that are no longer needed are discarded.
+
+$head ch$$
+is the character in the graph with this index.
+The value $icode%json_lexer%.have_char(%index%)%$$ must be true
+before this call.
+
+$head Prototype$$
+$srccode%hpp% */
+private:
+    bool have_char(size_t index);
+    char get_char(size_t index) const
+    {   CPPAD_ASSERT_UNKNOWN( buffer_start_ <= index );
+        CPPAD_ASSERT_UNKNOWN( index < buffer_start_ + json_->size() );
+        return (*json_)[index - buffer_start_];
+    }
+/* %$$
+$end
+-------------------------------------------------------------------------------
 $begin json_lexer_skip_white_space$$
 $spell
     json
@@ -176,7 +252,7 @@ is a json lexer object.
 $head Discussion$$
 This member functions is used to increase $code index_$$ until either
 a non-white space character is found or $code index_$$ is equal
-to $code json_.size()$$.
+to the number of characters in the graph.
 
 $head Prototype$$
 $srccode%hpp% */
@@ -199,6 +275,7 @@ $section json lexer: Constructor$$
 $head Syntax$$
 $codei%
     local::graph::lexer %json_lexer%(%json%)
+    local::graph::lexer %json_lexer%(%is%)
 %$$
 
 $head json$$
@@ -206,9 +283,16 @@ The argument $icode json$$ is an $cref json_ad_graph$$
 and it is assumed that $icode json$$ does not change
 for as long as $icode json_lexer$$ exists.
 
+$head is$$
+The argument $icode is$$ is a stream that contains a $cref json_ad_graph$$.
+The graph is read incrementally as it is parsed,
+so the entire graph is never stored in memory.
+It is assumed that $icode is$$ exists
+for as long as $icode json_lexer$$ exists.
+
 $head Initialization$$
 The current token, index, line number, and character number
-are set to the first non white space character in $code json_$$.
+are set to the first non white space character in the graph.
 If this is not a left brace character $code '{'$$,
 the error is reported and the constructor does not return.
 
@@ -226,6 +310,9 @@ $head Prototype$$
 $srccode%hpp% */
 public:
     json_lexer(const std::string& json);
+    json_lexer(std::istream& is);
+private:
+    void initialize(void);
 /* %$$
 $end
 -------------------------------------------------------------------------------
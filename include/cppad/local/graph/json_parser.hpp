@@ -14,6 +14,7 @@ CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
 -------------------------------------------------------------------------- */
 
 # include <string>
+# include <istream>
 # include <cppad/utility/vector.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/core/graph/cpp_graph.hpp>
@@ -29,11 +30,18 @@ $$
 $section Json AD Graph Parser$$
 
 $head Syntax$$
-$codei%json_parser(%json%, %graph_obj%)%$$
+$codei%json_parser(%json%, %graph_obj%)
+%$$
+$codei%json_parser(%is%, %graph_obj%)
+%$$
 
 $head json$$
 The $cref json_ad_graph$$.
 
+$head is$$
+A stream containing the $cref json_ad_graph$$.
+It is read incrementally as it is parsed.
+
 $head graph_obj$$
 This is a $code cpp_graph$$ object.
 The input value of the object does not matter.
@@ -46,6 +54,10 @@ namespace CppAD { namespace local { namespace graph {
         const std::string&  json      ,
         cpp_graph&          graph_obj
     );
+    void json_parser(
+        std::istream&       is        ,
+        cpp_graph&          graph_obj
+    );
 } } }
 /* %$$
 $end
@@ -14,6 +14,7 @@ CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
 -------------------------------------------------------------------------- */
 
 # include <string>
+# include <ostream>
 # include <cppad/utility/vector.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 # include <cppad/utility/to_string.hpp>
@@ -24,17 +25,35 @@ $spell
     Json
     CppAD
     obj
+    os
 $$
 
 $section Json AD Graph Writer$$
 
 $head Syntax$$
-$codei%json_writer( %json%, %graph_obj% )%$$
+$codei%json_writer( %json%, %graph_obj% )
+%$$
+$codei%json_writer( %os%, %graph_obj% )
+%$$
 
 $head json$$
 The input value of $icode json$$ does not matter,
 upon return it a $cref/json/json_ad_graph/$$ representation of the AD graph.
 
+$head os$$
+The $cref/json/json_ad_graph/$$ representation of the AD graph
+is written to this stream.
+
+$head Buffering$$
+The output is accumulated in a fixed size buffer and moved to
+$icode json$$ or $icode os$$ when the buffer is full.
+Integers are converted to text directly.
+Floating point values are converted using the fewest significant digits,
+between 15 and 17, that convert back to the same value;
+see $cref graph_double_text$$.
+This text uses a period for the decimal point
+(independent of the C locale) so that it is valid Json.
+
 $head graph_obj$$
 This is a $code cpp_graph$$ object.
 
@@ -45,6 +64,10 @@ namespace CppAD { namespace local { namespace graph {
         std::string&       json        ,
         const cpp_graph&   graph_obj
     );
+    void json_writer(
+        std::ostream&      os          ,
+        const cpp_graph&   graph_obj
+    );
 } } }
 /* %$$
 $end
@@ -102,6 +102,10 @@ void forward_log_op_dir(
     Base* z = taylor + i_z * num_taylor_per_var;
 
     size_t m = (q-1) * r + 1;
+    if( q == 1 )
+    {   forward_dir_first_div(r, x + 1, x[0], z + 1);
+        return;
+    }
     for(size_t ell = 0; ell < r; ell++)
     {   z[m+ell] = Base(double(q)) * x[m+ell];
         for(size_t k = 1; k < q; k++)
@@ -17,6 +17,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 // operations
 # include <cppad/core/std_math_98.hpp>
+# include <cppad/local/dir_first_op.hpp>
 # include <cppad/local/abs_op.hpp>
 # include <cppad/local/add_op.hpp>
 # include <cppad/local/acos_op.hpp>
@@ -0,0 +1,135 @@
+# ifndef CPPAD_LOCAL_PLAY_FAST_INST_HPP
+# define CPPAD_LOCAL_PLAY_FAST_INST_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <algorithm>
+# include <limits>
+# include <cppad/local/play/addr_enum.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file fast_inst.hpp
+Pre-decoded instructions used by the fast evaluation sweeps.
+*/
+
+/*!
+Information that is the same for all the instructions during one
+zero order forward fast evaluation.
+*/
+template <class Base>
+struct fast_forward0_info {
+    /// first element of the argument vector for the recording
+    const addr_t* arg_vec;
+    /// number of parameters in the recording
+    size_t        num_par;
+    /// first element of the parameter vector for the recording
+    const Base*   parameter;
+    /// number of columns in the taylor matrix
+    size_t        cap_order;
+    /// taylor[ i * cap_order + 0 ] is the value of the i-th variable
+    Base*         taylor;
+    /// count at which compare_change_op_index is set (zero for no compare)
+    size_t        compare_change_count;
+    /// number of comparisons that changed
+    size_t        compare_change_number;
+    /// operator index corresponding to compare_change_count
+    size_t        compare_change_op_index;
+};
+
+/*!
+Information that is the same for all the instructions during one
+reverse mode fast evaluation.
+*/
+template <class Base>
+struct fast_reverse_info {
+    /// first element of the argument vector for the recording
+    const addr_t* arg_vec;
+    /// number of parameters in the recording
+    size_t        num_par;
+    /// first element of the parameter vector for the recording
+    const Base*   parameter;
+    /// highest order Taylor coefficient that we are differentiating
+    size_t        d;
+    /// number of columns in the taylor matrix
+    size_t        cap_order;
+    /// Taylor coefficients for all the variables
+    const Base*   taylor;
+    /// number of columns in the partial matrix
+    size_t        nc_partial;
+    /// partial derivatives for all the variables
+    Base*         partial;
+};
+
+/*!
+One pre-decoded instruction; i.e., one operator in the recording.
+
+The operator code, the index of its primary result,
+and its arguments are determined once,
+when the instructions are created, instead of each time the operator
+is evaluated.
+
+\tparam Addr
+is the type used for the indices in the instruction.
+It is the narrowest of unsigned short, unsigned int, and size_t
+that can hold the number of operators, variables, arguments,
+and parameters in the recording; see fast_address_type.
+*/
+template <class Base, class Addr>
+struct fast_inst {
+    /// zero order forward mode evaluation of this operator
+    void (*forward0)(const fast_inst& inst, fast_forward0_info<Base>& info);
+    /// reverse mode evaluation of this operator
+    void (*reverse)(const fast_inst& inst, fast_reverse_info<Base>& info);
+    /// index of this operator in the recording
+    Addr     i_op;
+    /// index of the primary result for this operator
+    Addr     i_var;
+    /// If this operator has at most three arguments, they are arg[0],
+    /// ..., arg[NumArg(op)-1]. Otherwise arg[0] is the index in the
+    /// argument vector of its first argument.
+    Addr     arg[3];
+    /// operator code for this operator
+    opcode_t op;
+};
+
+/*!
+Type used for the indices in the pre-decoded instructions.
+
+\param num_var
+number of variables in the recording.
+
+\param num_op
+number of operators in the recording.
+
+\param num_arg
+number of operator arguments in the recording.
+
+\param num_par
+number of parameters in the recording.
+*/
+inline addr_enum fast_address_type(
+    size_t num_var, size_t num_op, size_t num_arg, size_t num_par
+)
+{   size_t required = std::max( std::max(num_var, num_op), num_arg );
+    required        = std::max( required, num_par );
+    if( required <= std::numeric_limits<unsigned short>::max() )
+        return unsigned_short_enum;
+    if( required <= std::numeric_limits<unsigned int>::max() )
+        return unsigned_int_enum;
+    return size_t_enum;
+}
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_PLAY_PLAYER_HPP
 # define CPPAD_LOCAL_PLAY_PLAYER_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -16,8 +16,10 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/local/play/sequential_iterator.hpp>
 # include <cppad/local/play/subgraph_iterator.hpp>
 # include <cppad/local/play/random_setup.hpp>
+# include <cppad/local/play/fast_inst.hpp>
 # include <cppad/local/atom_state.hpp>
 # include <cppad/local/is_pod.hpp>
+# include <cppad/local/binary_io.hpp>
 
 namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
 /*!
@@ -53,6 +55,16 @@ private:
     /// Number of VecAD vectors in the recording
     size_t num_var_vecad_rec_;
 
+    /// Number of constant parameters put in the recording
+    /// (including those that were found in the hash table).
+    size_t num_con_par_put_;
+
+    /// Number of slots examined in the constant parameter hash table
+    size_t num_con_par_probe_;
+
+    /// Number of slots in the constant parameter hash table
+    size_t num_con_par_slot_;
+
     /// The operators in the recording.
     pod_vector<opcode_t> op_vec_;
 
@@ -106,6 +118,81 @@ private:
     /// This value is valid (invalid) for primary (auxillary) variables.
     pod_vector<unsigned char> var2op_vec_;
 
+    // ----------------------------------------------------------------------
+    /// Pre-decoded instructions used by the fast evaluation sweeps.
+    /// This is empty when fast evaluation has not been setup.
+    /// Otherwise it is a vector of play::fast_inst<Base, Addr> where the
+    /// type Addr corresponds to fast_addr_.
+    pod_vector<unsigned char> fast_vec_;
+
+    /// type used for the indices in the fast evaluation instructions
+    play::addr_enum fast_addr_;
+
+    /// Pre-decoded zero order forward instructions that use slot indices
+    /// instead of variable indices; see sweep::slot_setup.
+    /// This is empty when slot evaluation has not been setup.
+    /// Otherwise it is a vector of play::fast_inst<Base, Addr> where the
+    /// type Addr corresponds to fast_addr_.
+    pod_vector<unsigned char> slot_vec_;
+
+    /// argument vector, with slot indices, for the CExpOp and CSumOp
+    /// instructions in slot_vec_
+    pod_vector<addr_t> slot_arg_;
+
+    /// slot index for each dependent variable
+    pod_vector<addr_t> slot_dep_;
+
+    /// number of slots used by the slot evaluation instructions
+    size_t num_slot_;
+
+    /// For each variable index i_var, the fast evaluation instructions that
+    /// use the variable as an argument are update_user_[k] for
+    /// k = update_start_[i_var], ... , update_start_[i_var+1]-1;
+    /// see sweep::update_setup.
+    /// These are empty when update evaluation has not been setup.
+    pod_vector<addr_t> update_start_;
+    pod_vector<addr_t> update_user_;
+
+    /// one bit for each fast evaluation instruction that is used to mark
+    /// the instructions that need to be evaluated by sweep::update_forward0
+    /// (all the bits are zero between calls)
+    pod_vector<size_t> update_mark_;
+
+    /// does the recording contain a conditional skip operator
+    bool update_cskip_;
+
+    /// For each level, the fast evaluation instructions in the level are
+    /// level_inst_[k] for k = level_start_[level], ... ,
+    /// level_start_[level+1]-1; see sweep::level_setup.
+    /// The instructions for k >= level_split_[level] are CSumOp operators
+    /// that are split between threads.
+    /// These are empty when level evaluation has not been setup.
+    pod_vector<addr_t> level_start_;
+    pod_vector<addr_t> level_split_;
+    pod_vector<addr_t> level_inst_;
+
+    /// For each dynamic parameter operator, the index of its first
+    /// dynamic parameter and the index in dyn_par_arg_ of its first argument;
+    /// see sweep::dynamic_setup. The last element of dyn_op2dyn_ is the
+    /// number of dynamic parameters.
+    /// These are empty when dynamic parameter updates have not been setup.
+    pod_vector<addr_t> dyn_op2dyn_;
+    pod_vector<addr_t> dyn_op2arg_;
+
+    /// For each dynamic parameter index i_dyn, the dynamic parameter
+    /// operators that use the parameter as an argument are dyn_user_[k] for
+    /// k = dyn_user_start_[i_dyn], ... , dyn_user_start_[i_dyn+1]-1.
+    pod_vector<addr_t> dyn_user_start_;
+    pod_vector<addr_t> dyn_user_;
+
+    /// one bit for each dynamic parameter operator that is used to mark
+    /// the operators that need to be evaluated by sweep::dynamic_update
+    /// (all the bits are zero between calls)
+    pod_vector<size_t> dyn_mark_;
+
+    /// has sweep::dynamic_setup been called for this recording
+    bool dyn_update_setup_;
+
 public:
     // =================================================================
     /// default constructor
@@ -115,7 +202,14 @@ public:
     num_dynamic_ind_(0)  ,
     num_var_rec_(0)      ,
     num_var_load_rec_(0)  ,
-    num_var_vecad_rec_(0)
+    num_var_vecad_rec_(0) ,
+    num_con_par_put_(0)   ,
+    num_con_par_probe_(0) ,
+    num_con_par_slot_(0)  ,
+    fast_addr_(play::unsigned_short_enum) ,
+    num_slot_(0)          ,
+    update_cskip_(false)  ,
+    dyn_update_setup_(false)
     { }
     // =================================================================
     /// copy constructor (needed for base2ad)
@@ -182,6 +276,9 @@ public:
         num_dynamic_ind_    = rec.num_dynamic_ind_;
         num_var_rec_        = rec.num_var_rec_;
         num_var_load_rec_   = rec.num_var_load_rec_;
+        num_con_par_put_    = rec.con_par_hash_.n_find();
+        num_con_par_probe_  = rec.con_par_hash_.n_probe();
+        num_con_par_slot_   = rec.con_par_hash_.n_slot();
 
         // op_vec_
         op_vec_.swap(rec.op_vec_);
@@ -209,6 +306,528 @@ public:
         all_var_vecad_ind_.swap(rec.all_var_vecad_ind_);
         CPPAD_ASSERT_UNKNOWN(all_var_vecad_ind_.size() < addr_t_max );
 
+        // information that is derived from the recording
+        set_derived(n_ind);
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Write the operation sequence in this player to a binary stream.
+
+    \param os
+    is the stream that the operation sequence is written to; see
+    binary_io.hpp for the format of the header and vectors.
+    Information derived from the recording, e.g., the random access
+    and fast evaluation information, is not written.
+    */
+    void write_binary(std::ostream& os) const
+    {   CPPAD_ASSERT_UNKNOWN( is_pod<Base>() );
+        binary_write(os, num_dynamic_ind_);
+        binary_write(os, num_var_rec_);
+        binary_write(os, num_var_load_rec_);
+        binary_write_vec(os, op_vec_);
+        binary_write_vec(os, arg_vec_);
+        binary_write_vec(os, all_par_vec_);
+        binary_write_vec_bool(os, dyn_par_is_);
+        binary_write_vec(os, dyn_par_op_);
+        binary_write_vec(os, dyn_par_arg_);
+        binary_write_vec(os, text_vec_);
+        binary_write_vec(os, all_var_vecad_ind_);
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Read an operation sequence, written by write_binary, into this player.
+
+    \param is
+    is the stream that the operation sequence is read from.
+
+    \param n_ind
+    the number of independent variables (only used for error checking
+    when NDEBUG is not defined).
+
+    \return
+    is false (and an error has been reported using binary_error)
+    if the input is not a valid operation sequence.
+    In this case, this player is not changed.
+    */
+    bool read_binary(std::istream& is, size_t n_ind)
+    {   CPPAD_ASSERT_UNKNOWN( is_pod<Base>() );
+        //
+        // read into a temporary player so that this player does not change
+        // when there is an error in the input
+        player rec;
+        bool ok = binary_read(is, rec.num_dynamic_ind_);
+        ok = ok && binary_read(is, rec.num_var_rec_);
+        ok = ok && binary_read(is, rec.num_var_load_rec_);
+        ok = ok && binary_read_vec(is, rec.op_vec_);
+        ok = ok && binary_read_vec(is, rec.arg_vec_);
+        ok = ok && binary_read_vec(is, rec.all_par_vec_);
+        ok = ok && binary_read_vec_bool(is, rec.dyn_par_is_);
+        ok = ok && binary_read_vec(is, rec.dyn_par_op_);
+        ok = ok && binary_read_vec(is, rec.dyn_par_arg_);
+        ok = ok && binary_read_vec(is, rec.text_vec_);
+        ok = ok && binary_read_vec(is, rec.all_var_vecad_ind_);
+        ok = ok && rec.check_binary(n_ind);
+        if( ! ok )
+            return false;
+        //
+        // information that is derived from the recording
+        rec.set_derived(n_ind);
+        swap(rec);
+        return true;
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Check an operation sequence read by read_binary.
+
+    This check is done even when NDEBUG is defined,
+    because the input comes from outside the program.
+    It makes sure that the sizes of the vectors are consistent,
+    that the operators and their arguments can be traversed,
+    and that every index stored in the recording is in range
+    (the other routines in this class and the sweeps assume this is true).
+    Variable arguments must be less than the index of the first result
+    for the operator that uses them and parameter arguments to a
+    dynamic parameter operator must be less than the index of its result.
+
+    \param n_ind
+    the number of independent variables; i.e., the number of InvOp
+    operators that must follow the BeginOp operator.
+
+    \return
+    is false (and an error has been reported using binary_error)
+    if the recording is not valid.
+    */
+    bool check_binary(size_t n_ind) const
+    {   const char* msg =
+            "from_binary: input is not a valid operation sequence";
+        //
+        // lengths that must be representable using addr_t
+        size_t addr_t_max = size_t( std::numeric_limits<addr_t>::max() );
+        if( op_vec_.size() >= addr_t_max || arg_vec_.size() >= addr_t_max )
+            return binary_error(msg);
+        if( all_par_vec_.size() >= addr_t_max )
+            return binary_error(msg);
+        if( dyn_par_arg_.size() >= addr_t_max )
+            return binary_error(msg);
+        if( text_vec_.size() >= addr_t_max )
+            return binary_error(msg);
+        if( all_var_vecad_ind_.size() >= addr_t_max )
+            return binary_error(msg);
+        if( num_var_rec_ >= addr_t_max )
+            return binary_error(msg);
+        //
+        // parameters (index zero is the nan used by BeginOp)
+        size_t n_par = all_par_vec_.size();
+        if( n_par == 0 || dyn_par_is_.size() != n_par || dyn_par_is_[0] )
+            return binary_error(msg);
+        size_t n_dyn = 0;
+        for(size_t i_par = 0; i_par < n_par; ++i_par)
+            if( dyn_par_is_[i_par] )
+                ++n_dyn;
+        if( n_dyn != dyn_par_op_.size() || num_dynamic_ind_ > n_dyn )
+            return binary_error(msg);
+        //
+        // the last PrintFor text must end before the end of text_vec_
+        size_t n_text = text_vec_.size();
+        if( n_text > 0 && text_vec_[n_text - 1] != '\0' )
+            return binary_error(msg);
+        //
+        // size of each VecAD vector followed by its initial values,
+        // vecad_offset[i] is true if i is the offset of a VecAD vector
+        size_t n_vecad = all_var_vecad_ind_.size();
+        pod_vector<bool> vecad_offset(n_vecad + 1);
+        for(size_t i = 0; i <= n_vecad; ++i)
+            vecad_offset[i] = false;
+        size_t i = 0;
+        while( i < n_vecad )
+        {   size_t length = size_t( all_var_vecad_ind_[i] );
+            if( length >= n_vecad - i )
+                return binary_error(msg);
+            for(size_t k = 1; k <= length; ++k)
+                if( size_t( all_var_vecad_ind_[i + k] ) >= n_par )
+                    return binary_error(msg);
+            vecad_offset[i + 1] = true;
+            i += length + 1;
+        }
+        //
+        // operators
+        size_t n_op = op_vec_.size();
+        if( n_op < 2 )
+            return binary_error(msg);
+        if( op_vec_[0] != opcode_t(BeginOp) )
+            return binary_error(msg);
+        if( op_vec_[n_op - 1] != opcode_t(EndOp) )
+            return binary_error(msg);
+        if( n_op - 2 < n_ind )
+            return binary_error(msg);
+        for(size_t i_op = 1; i_op <= n_ind; ++i_op)
+            if( op_vec_[i_op] != opcode_t(InvOp) )
+                return binary_error(msg);
+        //
+        // number of atomic and discrete functions in this program
+        bool   set_null = true;
+        size_t zero     = 0;
+        size_t type     = 0;
+        void*  v_ptr    = CPPAD_NULL;
+        size_t n_atomic =
+            atomic_index<Base>(set_null, zero, type, CPPAD_NULL, v_ptr);
+        size_t n_discrete = discrete<Base>::list_size();
+        //
+        // arguments and results for each operator
+        size_t        n_arg    = arg_vec_.size();
+        size_t        i_arg    = 0;
+        size_t        n_var    = 0;
+        size_t        n_load   = 0;
+        bool          in_afun  = false;
+        size_t        afun_arg = 0;
+        size_t        afun_res = 0;
+        const addr_t* afun     = CPPAD_NULL;
+        for(size_t i_op = 0; i_op < n_op; ++i_op)
+        {   if( size_t( op_vec_[i_op] ) >= size_t(NumberOp) )
+                return binary_error(msg);
+            OpCode op = OpCode( op_vec_[i_op] );
+            size_t n  = NumArg(op);
+            if( op == CSumOp )
+            {   // arg[4] is number of arguments minus one
+                if( n_arg - i_arg < 5 )
+                    return binary_error(msg);
+                n = size_t( arg_vec_[i_arg + 4] ) + 1;
+                if( n < 5 || n_arg - i_arg < n )
+                    return binary_error(msg);
+                if( arg_vec_[i_arg + n - 1] != arg_vec_[i_arg + 4] )
+                    return binary_error(msg);
+            }
+            if( op == CSkipOp )
+            {   // arg[4] + arg[5] is number of arguments minus seven
+                if( n_arg - i_arg < 6 )
+                    return binary_error(msg);
+                size_t n_skip = size_t( arg_vec_[i_arg + 4] );
+                n_skip       += size_t( arg_vec_[i_arg + 5] );
+                if( n_skip > n_arg - i_arg || n_arg - i_arg - n_skip < 7 )
+                    return binary_error(msg);
+                n = 7 + n_skip;
+                if( size_t( arg_vec_[i_arg + n - 1] ) != n_skip )
+                    return binary_error(msg);
+            }
+            if( n_arg - i_arg < n )
+                return binary_error(msg);
+            const addr_t* arg = arg_vec_.data() + i_arg;
+            //
+            // variable arguments must be less than the first result index
+            size_t i_var = n_var;
+            //
+            // only atomic function operators are in an atomic function call
+            bool afun_op = op == AFunOp;
+            afun_op     |= op == FunapOp || op == FunavOp;
+            afun_op     |= op == FunrpOp || op == FunrvOp;
+            if( in_afun && ! afun_op )
+                return binary_error(msg);
+            //
+            bool ok = true;
+            switch(op)
+            {
+                // no arguments
+                case EndOp:
+                case InvOp:
+                break;
+
+                // parameter
+                case BeginOp:
+                case ParOp:
+                ok = size_t(arg[0]) < n_par;
+                break;
+
+                // variable
+                case AbsOp:
+                case AcosOp:
+                case AcoshOp:
+                case AsinOp:
+                case AsinhOp:
+                case AtanOp:
+                case AtanhOp:
+                case CosOp:
+                case CoshOp:
+                case ExpOp:
+                case Expm1Op:
+                case LogOp:
+                case Log1pOp:
+                case SignOp:
+                case SinOp:
+                case SinhOp:
+                case SqrtOp:
+                case TanOp:
+                case TanhOp:
+                ok = size_t(arg[0]) < i_var;
+                break;
+
+                // parameter, variable
+                case AddpvOp:
+                case DivpvOp:
+                case EqpvOp:
+                case LepvOp:
+                case LtpvOp:
+                case MulpvOp:
+                case NepvOp:
+                case PowpvOp:
+                case SubpvOp:
+                case ZmulpvOp:
+                ok = size_t(arg[0]) < n_par && size_t(arg[1]) < i_var;
+                break;
+
+                // variable, parameter
+                case DivvpOp:
+                case LevpOp:
+                case LtvpOp:
+                case PowvpOp:
+                case SubvpOp:
+                case ZmulvpOp:
+                ok = size_t(arg[0]) < i_var && size_t(arg[1]) < n_par;
+                break;
+
+                // variable, variable
+                case AddvvOp:
+                case DivvvOp:
+                case EqvvOp:
+                case LevvOp:
+                case LtvvOp:
+                case MulvvOp:
+                case NevvOp:
+                case PowvvOp:
+                case SubvvOp:
+                case ZmulvvOp:
+                ok = size_t(arg[0]) < i_var && size_t(arg[1]) < i_var;
+                break;
+
+                // parameter, parameter
+                case EqppOp:
+                case LeppOp:
+                case LtppOp:
+                case NeppOp:
+                ok = size_t(arg[0]) < n_par && size_t(arg[1]) < n_par;
+                break;
+
+                // variable, parameter, parameter
+                case ErfOp:
+                case ErfcOp:
+                ok  = size_t(arg[0]) < i_var;
+                ok &= size_t(arg[1]) < n_par && size_t(arg[2]) < n_par;
+                break;
+
+                // discrete function index, variable
+                case DisOp:
+                ok = size_t(arg[0]) < n_discrete && size_t(arg[1]) < i_var;
+                break;
+
+                // VecAD offset, index, load operator index
+                case LdpOp:
+                case LdvOp:
+                ok  = size_t(arg[0]) < n_vecad && vecad_offset[ arg[0] ];
+                if( op == LdpOp )
+                    ok &= size_t(arg[1]) < n_par;
+                else
+                    ok &= size_t(arg[1]) < i_var;
+                ok &= size_t(arg[2]) < num_var_load_rec_;
+                ++n_load;
+                break;
+
+                // VecAD offset, index, value
+                case StppOp:
+                case StpvOp:
+                case StvpOp:
+                case StvvOp:
+                ok  = size_t(arg[0]) < n_vecad && vecad_offset[ arg[0] ];
+                if( op == StppOp || op == StpvOp )
+                    ok &= size_t(arg[1]) < n_par;
+                else
+                    ok &= size_t(arg[1]) < i_var;
+                if( op == StppOp || op == StvpOp )
+                    ok &= size_t(arg[2]) < n_par;
+                else
+                    ok &= size_t(arg[2]) < i_var;
+                break;
+
+                // comparison, flags, left, right, if_true, if_false
+                case CExpOp:
+                ok = size_t(arg[0]) <= size_t(CompareNe);
+                for(size_t k = 0; k < 4; ++k)
+                {   size_t bound = (arg[1] & (1 << k)) ? i_var : n_par;
+                    ok &= size_t(arg[2 + k]) < bound;
+                }
+                break;
+
+                // comparison, flags, left, right, counts, operator indices
+                case CSkipOp:
+                ok = size_t(arg[0]) <= size_t(CompareNe);
+                for(size_t k = 0; k < 2; ++k)
+                {   size_t bound = (arg[1] & (1 << k)) ? i_var : n_par;
+                    ok &= size_t(arg[2 + k]) < bound;
+                }
+                for(size_t k = 6; k < n - 1; ++k)
+                    ok &= size_t(arg[k]) < n_op;
+                break;
+
+                // parameter, argument index for the end of each group,
+                // variables, dynamic parameters
+                case CSumOp:
+                ok  = size_t(arg[0]) < n_par;
+                ok &= 5 <= size_t(arg[1]);
+                ok &= size_t(arg[1]) <= size_t(arg[2]);
+                ok &= 5 < size_t(arg[2]); // at least one variable
+                ok &= size_t(arg[2]) <= size_t(arg[3]);
+                ok &= size_t(arg[3]) <= size_t(arg[4]);
+                if( ok )
+                {   for(size_t k = 5; k < size_t(arg[2]); ++k)
+                        ok &= size_t(arg[k]) < i_var;
+                    for(size_t k = size_t(arg[2]); k < size_t(arg[4]); ++k)
+                        ok &= size_t(arg[k]) < n_par;
+                }
+                break;
+
+                // flags, pos, before, value, after
+                case PriOp:
+                ok  = size_t(arg[1]) < ( (arg[0] & 1) ? i_var : n_par );
+                ok &= size_t(arg[3]) < ( (arg[0] & 2) ? i_var : n_par );
+                ok &= size_t(arg[2]) < n_text && size_t(arg[4]) < n_text;
+                break;
+
+                // atomic index, id, number of arguments, number of results
+                case AFunOp:
+                if( in_afun )
+                {   // end of this atomic function call
+                    ok = afun_arg == 0 && afun_res == 0;
+                    for(size_t k = 0; k < 4; ++k)
+                        ok &= arg[k] == afun[k];
+                    in_afun = false;
+                }
+                else
+                {   // start of an atomic function call
+                    ok = 0 < size_t(arg[0]) && size_t(arg[0]) <= n_atomic;
+                    afun     = arg;
+                    afun_arg = size_t( arg[2] );
+                    afun_res = size_t( arg[3] );
+                    in_afun  = true;
+                }
+                break;
+
+                // atomic function argument
+                case FunapOp:
+                case FunavOp:
+                ok = in_afun && afun_arg > 0;
+                if( op == FunapOp )
+                    ok &= size_t(arg[0]) < n_par;
+                else
+                    ok &= size_t(arg[0]) < i_var;
+                --afun_arg;
+                break;
+
+                // atomic function result
+                case FunrpOp:
+                case FunrvOp:
+                ok = in_afun && afun_arg == 0 && afun_res > 0;
+                if( op == FunrpOp )
+                    ok &= size_t(arg[0]) < n_par;
+                --afun_res;
+                break;
+
+                default:
+                ok = false;
+                break;
+            }
+            if( ! ok )
+                return binary_error(msg);
+            i_arg += n;
+            n_var += NumRes(op);
+        }
+        if( i_arg != n_arg || n_var != num_var_rec_ || in_afun )
+            return binary_error(msg);
+        if( n_load != num_var_load_rec_ )
+            return binary_error(msg);
+        //
+        // dynamic parameter operators and their arguments
+        size_t n_dyn_arg = dyn_par_arg_.size();
+        size_t i_dyn_arg = 0;
+        size_t i_par     = 0;
+        size_t n_result  = 0; // number of result_dyn operators that follow
+        for(size_t i_dyn = 0; i_dyn < n_dyn; ++i_dyn)
+        {   // parameter index for this dynamic parameter
+            ++i_par;
+            while( ! dyn_par_is_[i_par] )
+                ++i_par;
+            //
+            if( size_t( dyn_par_op_[i_dyn] ) >= size_t(number_dyn) )
+                return binary_error(msg);
+            op_code_dyn op = op_code_dyn( dyn_par_op_[i_dyn] );
+            //
+            // the independent dynamic parameters come first
+            if( (op == ind_dyn) != (i_dyn < num_dynamic_ind_) )
+                return binary_error(msg);
+            if( op == ind_dyn && i_par != i_dyn + 1 )
+                return binary_error(msg);
+            //
+            // result_dyn operators follow atom_dyn when there is more
+            // than one dynamic parameter result
+            if( (op == result_dyn) != (n_result > 0) )
+                return binary_error(msg);
+            if( op == result_dyn )
+                --n_result;
+            //
+            const addr_t* arg   = dyn_par_arg_.data() + i_dyn_arg;
+            size_t        avail = n_dyn_arg - i_dyn_arg;
+            size_t        n     = num_arg_dyn(op);
+            bool          ok    = true;
+            if( op == atom_dyn )
+            {   if( avail < 5 )
+                    return binary_error(msg);
+                size_t n_x = size_t( arg[1] );
+                size_t n_y = size_t( arg[2] );
+                if( n_x > avail - 5 || n_y > avail - 5 - n_x )
+                    return binary_error(msg);
+                n   = 5 + n_x + n_y;
+                ok  = size_t( arg[n - 1] ) == n;
+                ok &= 0 < size_t(arg[0]) && size_t(arg[0]) <= n_atomic;
+                for(size_t k = 4; k < 4 + n_x; ++k)
+                    ok &= size_t( arg[k] ) < i_par;
+                size_t count = 0;
+                for(size_t k = 4 + n_x; k < n - 1; ++k)
+                {   // zero for a constant result
+                    ok &= size_t( arg[k] ) < n_par;
+                    ok &= arg[k] == 0 || size_t( arg[k] ) >= i_par;
+                    if( ok && dyn_par_is_[ arg[k] ] )
+                        ++count;
+                }
+                ok &= 0 < count && count == size_t( arg[3] );
+                n_result = count - 1;
+            }
+            else
+            {   if( avail < n )
+                    return binary_error(msg);
+                if( op == cond_exp_dyn )
+                    ok = size_t( arg[0] ) <= size_t(CompareNe);
+                if( op == dis_dyn )
+                    ok = size_t( arg[0] ) < n_discrete;
+                for(size_t k = num_non_par_arg_dyn(op); k < n; ++k)
+                    ok &= size_t( arg[k] ) < i_par;
+            }
+            if( ! ok )
+                return binary_error(msg);
+            i_dyn_arg += n;
+        }
+        if( i_dyn_arg != n_dyn_arg || n_result != 0 )
+            return binary_error(msg);
+        //
+        return true;
+    }
+    // ----------------------------------------------------------------------
+    /*!
+    Set the information that is derived from the recording
+    and check the recording.
+
+    \param n_ind
+    the number of independent variables (only used for error checking
+    when NDEBUG is not defined).
+    */
+    void set_derived(size_t n_ind)
+    {
         // num_var_vecad_rec_
         num_var_vecad_rec_ = 0;
         {   // all_var_vecad_ind_ contains size of each VecAD followed by
@@ -235,6 +854,12 @@ public:
         // random access information
         clear_random();
 
+        // fast evaluation information
+        clear_fast();
+
+        // dynamic parameter update information
+        clear_dyn_update();
+
         // some checks
         check_inv_op(n_ind);
         check_variable_dag();
@@ -506,6 +1131,9 @@ public:
         num_var_rec_        = play.num_var_rec_;
         num_var_load_rec_   = play.num_var_load_rec_;
         num_var_vecad_rec_  = play.num_var_vecad_rec_;
+        num_con_par_put_    = play.num_con_par_put_;
+        num_con_par_probe_  = play.num_con_par_probe_;
+        num_con_par_slot_   = play.num_con_par_slot_;
         //
         // pod_vectors
         op_vec_             = play.op_vec_;
@@ -519,6 +1147,25 @@ public:
         op2arg_vec_         = play.op2arg_vec_;
         op2var_vec_         = play.op2var_vec_;
         var2op_vec_         = play.var2op_vec_;
+        fast_vec_           = play.fast_vec_;
+        fast_addr_          = play.fast_addr_;
+        slot_vec_           = play.slot_vec_;
+        slot_arg_           = play.slot_arg_;
+        slot_dep_           = play.slot_dep_;
+        num_slot_           = play.num_slot_;
+        update_start_       = play.update_start_;
+        update_user_        = play.update_user_;
+        update_mark_        = play.update_mark_;
+        update_cskip_       = play.update_cskip_;
+        level_start_        = play.level_start_;
+        level_split_        = play.level_split_;
+        level_inst_         = play.level_inst_;
+        dyn_op2dyn_         = play.dyn_op2dyn_;
+        dyn_op2arg_         = play.dyn_op2arg_;
+        dyn_user_start_     = play.dyn_user_start_;
+        dyn_user_           = play.dyn_user_;
+        dyn_mark_           = play.dyn_mark_;
+        dyn_update_setup_   = play.dyn_update_setup_;
         //
         // pod_maybe_vectors
         all_par_vec_        = play.all_par_vec_;
@@ -533,6 +1180,9 @@ public:
         num_var_rec_        = play.num_var_rec_;
         num_var_load_rec_   = play.num_var_load_rec_;
         num_var_vecad_rec_  = play.num_var_vecad_rec_;
+        num_con_par_put_    = play.num_con_par_put_;
+        num_con_par_probe_  = play.num_con_par_probe_;
+        num_con_par_slot_   = play.num_con_par_slot_;
         //
         // pod_vectors
         op_vec_.swap(            play.op_vec_);
@@ -546,6 +1196,25 @@ public:
         op2arg_vec_.swap(        play.op2arg_vec_);
         op2var_vec_.swap(        play.op2var_vec_);
         var2op_vec_.swap(        play.var2op_vec_);
+        fast_vec_.swap(          play.fast_vec_);
+        fast_addr_               = play.fast_addr_;
+        slot_vec_.swap(          play.slot_vec_);
+        slot_arg_.swap(          play.slot_arg_);
+        slot_dep_.swap(          play.slot_dep_);
+        num_slot_                = play.num_slot_;
+        update_start_.swap(      play.update_start_);
+        update_user_.swap(       play.update_user_);
+        update_mark_.swap(       play.update_mark_);
+        update_cskip_            = play.update_cskip_;
+        level_start_.swap(       play.level_start_);
+        level_split_.swap(       play.level_split_);
+        level_inst_.swap(        play.level_inst_);
+        dyn_op2dyn_.swap(        play.dyn_op2dyn_);
+        dyn_op2arg_.swap(        play.dyn_op2arg_);
+        dyn_user_start_.swap(    play.dyn_user_start_);
+        dyn_user_.swap(          play.dyn_user_);
+        dyn_mark_.swap(          play.dyn_mark_);
+        dyn_update_setup_        = play.dyn_update_setup_;
         //
         // pod_maybe_vectors
         all_par_vec_.swap(       play.all_par_vec_);
@@ -561,6 +1230,9 @@ public:
         play.num_var_rec_        = num_var_rec_;
         play.num_var_load_rec_   = num_var_load_rec_;
         play.num_var_vecad_rec_  = num_var_vecad_rec_;
+        play.num_con_par_put_    = num_con_par_put_;
+        play.num_con_par_probe_  = num_con_par_probe_;
+        play.num_con_par_slot_   = num_con_par_slot_;
         //
         // pod_vectors
         play.op_vec_             = op_vec_;
@@ -591,6 +1263,9 @@ public:
         std::swap(num_var_rec_,        other.num_var_rec_);
         std::swap(num_var_load_rec_,   other.num_var_load_rec_);
         std::swap(num_var_vecad_rec_,  other.num_var_vecad_rec_);
+        std::swap(num_con_par_put_,    other.num_con_par_put_);
+        std::swap(num_con_par_probe_,  other.num_con_par_probe_);
+        std::swap(num_con_par_slot_,   other.num_con_par_slot_);
         //
         // pod_vectors
         op_vec_.swap(             other.op_vec_);
@@ -604,6 +1279,25 @@ public:
         op2arg_vec_.swap(         other.op2arg_vec_);
         op2var_vec_.swap(         other.op2var_vec_);
         var2op_vec_.swap(         other.var2op_vec_);
+        fast_vec_.swap(           other.fast_vec_);
+        std::swap(fast_addr_,     other.fast_addr_);
+        slot_vec_.swap(           other.slot_vec_);
+        slot_arg_.swap(           other.slot_arg_);
+        slot_dep_.swap(           other.slot_dep_);
+        std::swap(num_slot_,      other.num_slot_);
+        update_start_.swap(       other.update_start_);
+        update_user_.swap(        other.update_user_);
+        update_mark_.swap(        other.update_mark_);
+        std::swap(update_cskip_,  other.update_cskip_);
+        level_start_.swap(        other.level_start_);
+        level_split_.swap(        other.level_split_);
+        level_inst_.swap(         other.level_inst_);
+        dyn_op2dyn_.swap(         other.dyn_op2dyn_);
+        dyn_op2arg_.swap(         other.dyn_op2arg_);
+        dyn_user_start_.swap(     other.dyn_user_start_);
+        dyn_user_.swap(           other.dyn_user_);
+        dyn_mark_.swap(           other.dyn_mark_);
+        std::swap(dyn_update_setup_, other.dyn_update_setup_);
         //
         // pod_maybe_vectors
         all_par_vec_.swap(    other.all_par_vec_);
@@ -633,6 +1327,138 @@ public:
         CPPAD_ASSERT_UNKNOWN( op2var_vec_.size() == 0  );
         CPPAD_ASSERT_UNKNOWN( var2op_vec_.size() == 0  );
     }
+    /// Free memory used by the fast evaluation sweeps
+    void clear_fast(void)
+    {   fast_vec_.clear();
+        slot_vec_.clear();
+        slot_arg_.clear();
+        slot_dep_.clear();
+        num_slot_ = 0;
+        update_start_.clear();
+        update_user_.clear();
+        update_mark_.clear();
+        update_cskip_ = false;
+        level_start_.clear();
+        level_split_.clear();
+        level_inst_.clear();
+    }
+    /// Free memory used by the dynamic parameter updates
+    void clear_dyn_update(void)
+    {   dyn_op2dyn_.clear();
+        dyn_op2arg_.clear();
+        dyn_user_start_.clear();
+        dyn_user_.clear();
+        dyn_mark_.clear();
+        dyn_update_setup_ = false;
+    }
+    /// has the dynamic parameter update information been setup
+    bool dyn_update_setup(void) const
+    {   return dyn_update_setup_; }
+    /// set the flag for the dynamic parameter update information
+    void set_dyn_update_setup(bool dyn_update_setup)
+    {   dyn_update_setup_ = dyn_update_setup; }
+    /// get non-const version of the fast evaluation instructions
+    pod_vector<unsigned char>& fast_vec(void)
+    {   return fast_vec_; }
+    /// get const version of the fast evaluation instructions
+    const pod_vector<unsigned char>& fast_vec(void) const
+    {   return fast_vec_; }
+    /// type used for the indices in the fast evaluation instructions
+    play::addr_enum fast_addr(void) const
+    {   return fast_addr_; }
+    /// set type used for the indices in the fast evaluation instructions
+    void set_fast_addr(play::addr_enum fast_addr)
+    {   fast_addr_ = fast_addr; }
+    /// get non-const version of the slot evaluation instructions
+    pod_vector<unsigned char>& slot_vec(void)
+    {   return slot_vec_; }
+    /// get const version of the slot evaluation instructions
+    const pod_vector<unsigned char>& slot_vec(void) const
+    {   return slot_vec_; }
+    /// get non-const version of the slot evaluation argument vector
+    pod_vector<addr_t>& slot_arg(void)
+    {   return slot_arg_; }
+    /// get const version of the slot evaluation argument vector
+    const pod_vector<addr_t>& slot_arg(void) const
+    {   return slot_arg_; }
+    /// get non-const version of the dependent variable slot indices
+    pod_vector<addr_t>& slot_dep(void)
+    {   return slot_dep_; }
+    /// get const version of the dependent variable slot indices
+    const pod_vector<addr_t>& slot_dep(void) const
+    {   return slot_dep_; }
+    /// number of slots used by the slot evaluation instructions
+    size_t num_slot(void) const
+    {   return num_slot_; }
+    /// set number of slots used by the slot evaluation instructions
+    void set_num_slot(size_t num_slot)
+    {   num_slot_ = num_slot; }
+    /// get non-const version of the start of the users for each variable
+    pod_vector<addr_t>& update_start(void)
+    {   return update_start_; }
+    /// get const version of the start of the users for each variable
+    const pod_vector<addr_t>& update_start(void) const
+    {   return update_start_; }
+    /// get non-const version of the users for each variable
+    pod_vector<addr_t>& update_user(void)
+    {   return update_user_; }
+    /// get const version of the users for each variable
+    const pod_vector<addr_t>& update_user(void) const
+    {   return update_user_; }
+    /// get the instruction marks used by the update evaluation
+    pod_vector<size_t>& update_mark(void)
+    {   return update_mark_; }
+    /// does the recording contain a conditional skip operator
+    bool update_cskip(void) const
+    {   return update_cskip_; }
+    /// set the flag for conditional skip operators in the recording
+    void set_update_cskip(bool update_cskip)
+    {   update_cskip_ = update_cskip; }
+    /// get non-const version of the start of the instructions for each level
+    pod_vector<addr_t>& level_start(void)
+    {   return level_start_; }
+    /// get const version of the start of the instructions for each level
+    const pod_vector<addr_t>& level_start(void) const
+    {   return level_start_; }
+    /// get non-const version of the start of the split CSumOp instructions
+    pod_vector<addr_t>& level_split(void)
+    {   return level_split_; }
+    /// get const version of the start of the split CSumOp instructions
+    const pod_vector<addr_t>& level_split(void) const
+    {   return level_split_; }
+    /// get non-const version of the instructions in level order
+    pod_vector<addr_t>& level_inst(void)
+    {   return level_inst_; }
+    /// get const version of the instructions in level order
+    const pod_vector<addr_t>& level_inst(void) const
+    {   return level_inst_; }
+    /// get non-const version of the first dynamic parameter for each operator
+    pod_vector<addr_t>& dyn_op2dyn(void)
+    {   return dyn_op2dyn_; }
+    /// get const version of the first dynamic parameter for each operator
+    const pod_vector<addr_t>& dyn_op2dyn(void) const
+    {   return dyn_op2dyn_; }
+    /// get non-const version of the first argument for each operator
+    pod_vector<addr_t>& dyn_op2arg(void)
+    {   return dyn_op2arg_; }
+    /// get const version of the first argument for each operator
+    const pod_vector<addr_t>& dyn_op2arg(void) const
+    {   return dyn_op2arg_; }
+    /// get non-const version of the start of the users for each parameter
+    pod_vector<addr_t>& dyn_user_start(void)
+    {   return dyn_user_start_; }
+    /// get const version of the start of the users for each parameter
+    const pod_vector<addr_t>& dyn_user_start(void) const
+    {   return dyn_user_start_; }
+    /// get non-const version of the users for each dynamic parameter
+    pod_vector<addr_t>& dyn_user(void)
+    {   return dyn_user_; }
+    /// get const version of the users for each dynamic parameter
+    const pod_vector<addr_t>& dyn_user(void) const
+    {   return dyn_user_; }
+    /// get the operator marks used by the dynamic parameter updates
+    pod_vector<size_t>& dyn_mark(void)
+    {   return dyn_mark_; }
     /// get non-const version of all_par_vec
     pod_vector_maybe<Base>& all_par_vec(void)
     {   return all_par_vec_; }
@@ -704,6 +1530,17 @@ public:
     const Base* GetPar(void) const
     {   return all_par_vec_.data(); }
 
+    /*!
+    \brief
+    Fetch entire argument vector from the recording.
+
+    \return
+    the entire argument vector.
+
+    */
+    const addr_t* GetArg(void) const
+    {   return arg_vec_.data(); }
+
     /*!
     \brief
     Fetch a '\\0' terminated string from the recording.
@@ -759,6 +1596,18 @@ public:
     size_t num_par_rec(void) const
     {   return all_par_vec_.size(); }
 
+    /// Fetch number of constant parameters put in the recording
+    size_t num_con_par_put(void) const
+    {   return num_con_par_put_; }
+
+    /// Fetch number of slots examined in the constant parameter hash table
+    size_t num_con_par_probe(void) const
+    {   return num_con_par_probe_; }
+
+    /// Fetch number of slots in the constant parameter hash table
+    size_t num_con_par_slot(void) const
+    {   return num_con_par_slot_; }
+
     /// Fetch number of characters (representing strings) in the recording.
     size_t num_text_rec(void) const
     {   return text_vec_.size(); }
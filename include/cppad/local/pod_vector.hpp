@@ -218,6 +218,23 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Make sure the capacity of this vector is at least n elements
+    (existing elements are always preserved).
+
+    \param n
+    is the minimum capacity for this vector. If n <= capacity(),
+    no memory is allocated or freed.
+    The size of the vector is not changed by this operation.
+    */
+    void reserve(size_t n)
+    {   if( n <= capacity() )
+            return;
+        size_t old_length = byte_length_;
+        extend( n - size() );
+        byte_length_ = old_length;
+    }
+    // ----------------------------------------------------------------------
+    /*!
     resize the vector (existing elements preserved when n <= capacity() ).
 
     \param n
@@ -477,6 +494,23 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Make sure the capacity of this vector is at least n elements
+    (existing elements are always preserved).
+
+    \param n
+    is the minimum capacity for this vector. If n <= capacity(),
+    no memory is allocated or freed.
+    The size of the vector is not changed by this operation.
+    */
+    void reserve(size_t n)
+    {   if( n <= capacity_ )
+            return;
+        size_t old_length = length_;
+        extend( n - length_ );
+        length_ = old_length;
+    }
+    // ----------------------------------------------------------------------
+    /*!
     resize the vector (existing elements preserved when n <= capacity_).
 
     \param n
@@ -134,6 +134,13 @@ ell = 0, ..., r-1,
 is the q-th order Taylor coefficient
 corresponding to z and the ell-th direction.
 
+\par First Order
+The q-th order coefficients for all the directions are contiguous.
+When q == 1 there is no sum over lower order terms and
+the unary routines use the loops in dir_first_op.hpp.
+The multiplications and divisions by q are not done in this case
+because they do not change the result.
+
 \par Checked Assertions
 \li NumArg(op) == 1
 \li NumRes(op) == 2
@@ -0,0 +1,231 @@
+# ifndef CPPAD_LOCAL_RECORD_CON_PAR_HASH_HPP
+# define CPPAD_LOCAL_RECORD_CON_PAR_HASH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <complex>
+# include <cppad/core/hash_code.hpp>
+# include <cppad/local/pod_vector.hpp>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file con_par_hash.hpp
+Hash table used by the recorder to find constant parameters.
+*/
+
+/*!
+Hash code, that uses all the bits in a size_t, for plain old data.
+
+\tparam Value
+is the type of the value. All of the bytes in value must be initialized.
+
+\param value
+is the value that we are computing a hash code for.
+*/
+template <class Value>
+size_t con_par_bit_hash(const Value& value)
+{   const unsigned char* v = reinterpret_cast<const unsigned char*>(&value);
+    size_t code = 2166136261u;
+    for(size_t i = 0; i < sizeof(Value); ++i)
+        code = (code ^ size_t( v[i] )) * 16777619u;
+    return code;
+}
+/*!
+Hash code for a constant parameter.
+
+The general case uses the user's hash_code function,
+which has values between zero and CPPAD_HASH_TABLE_SIZE - 1.
+The standard floating point types use all the bits in the value.
+
+\param par
+is the value that we are computing a hash code for.
+*/
+template <class Base>
+size_t con_par_hash_code(const Base& par)
+{   return size_t( hash_code(par) ); }
+//
+inline size_t con_par_hash_code(const float& par)
+{   return con_par_bit_hash(par); }
+inline size_t con_par_hash_code(const double& par)
+{   return con_par_bit_hash(par); }
+inline size_t con_par_hash_code(const std::complex<float>& par)
+{   return con_par_bit_hash(par); }
+inline size_t con_par_hash_code(const std::complex<double>& par)
+{   return con_par_bit_hash(par); }
+
+/*!
+Open addressing hash table for the constant parameters in a recording.
+
+Each constant parameter is found, or placed, using its value.
+Thus identically equal constant parameters correspond to one element
+of the parameter vector no matter how many distinct constants
+are in the recording.
+The table doubles in size when it becomes half full.
+
+\tparam Base
+is the base type for the recording; i.e., it records AD<Base> operations.
+*/
+template <class Base>
+class con_par_hash {
+private:
+    /// indices in the parameter vector (zero for an empty slot),
+    /// size is zero or a power of two.
+    pod_vector<addr_t> table_;
+
+    /// number of non-empty slots in table_
+    size_t n_entry_;
+
+    /// number of calls to find
+    size_t n_find_;
+
+    /// number of slots examined by find
+    size_t n_probe_;
+
+    /// slot that the probe sequence for par starts at
+    size_t start(const Base& par) const
+    {   size_t code = con_par_hash_code(par);
+        code       ^= code >> 16;
+        code       *= 0x45d9f3bu;
+        code       ^= code >> 16;
+        return code & (table_.size() - 1);
+    }
+
+    /// change the number of slots in the table
+    void rehash(size_t n_slot, const pod_vector_maybe<Base>& par_vec);
+public:
+    /// minimum number of slots in a non-empty table
+    static const size_t min_slot = 64;
+
+    /// constructor
+    con_par_hash(void)
+    : n_entry_(0), n_find_(0), n_probe_(0)
+    { }
+
+    /// number of calls to find
+    size_t n_find(void) const
+    {   return n_find_; }
+
+    /// number of table slots examined by find
+    size_t n_probe(void) const
+    {   return n_probe_; }
+
+    /// number of slots in the table
+    size_t n_slot(void) const
+    {   return table_.size(); }
+
+    /// make room for n_entry entries without changing the table size
+    void reserve(size_t n_entry, const pod_vector_maybe<Base>& par_vec)
+    {   size_t n_slot = min_slot;
+        while( n_slot < 2 * n_entry )
+            n_slot *= 2;
+        if( table_.size() < n_slot )
+            rehash(n_slot, par_vec);
+    }
+
+    /*!
+    Find a constant parameter.
+
+    \param par
+    is the value of the constant parameter.
+
+    \param par_vec
+    is the vector of parameters that the indices in the table refer to.
+
+    \param slot [out]
+    If the return value is zero, slot is where the index for par
+    should be inserted.
+
+    \return
+    is the index in par_vec of a constant that is identically equal to par,
+    or zero if there is no such constant.
+    */
+    size_t find(
+        const Base&                   par      ,
+        const pod_vector_maybe<Base>& par_vec  ,
+        size_t&                       slot     )
+    {   ++n_find_;
+        if( table_.size() == 0 )
+            rehash(min_slot, par_vec);
+        size_t mask = table_.size() - 1;
+        slot        = start(par);
+        while(true)
+        {   ++n_probe_;
+            size_t index = size_t( table_[slot] );
+            if( index == 0 )
+                return 0;
+            if( IdenticalEqualCon(par_vec[index], par) )
+                return index;
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    /*!
+    Insert a constant parameter.
+
+    \param slot
+    is the value of slot returned by the previous call to find
+    (which must have returned zero).
+
+    \param index
+    is the index of the constant parameter in par_vec; i.e.,
+    par_vec[index] is the value of par in the call to find.
+    If it is zero, this is the phantom parameter and it is not inserted.
+
+    \param par_vec
+    is the vector of parameters that the indices in the table refer to.
+    */
+    void insert(
+        size_t                        slot     ,
+        size_t                        index    ,
+        const pod_vector_maybe<Base>& par_vec  )
+    {   if( index == 0 )
+            return;
+        CPPAD_ASSERT_UNKNOWN( table_[slot] == 0 );
+        table_[slot] = addr_t( index );
+        ++n_entry_;
+        if( table_.size() < 2 * n_entry_ )
+            rehash(2 * table_.size(), par_vec);
+    }
+};
+/*!
+Change the number of slots in the table.
+
+\param n_slot
+is the new number of slots. It must be a power of two and greater than
+twice the number of entries in the table.
+
+\param par_vec
+is the vector of parameters that the indices in the table refer to.
+*/
+template <class Base>
+void con_par_hash<Base>::rehash(
+    size_t n_slot, const pod_vector_maybe<Base>& par_vec
+)
+{   CPPAD_ASSERT_UNKNOWN( (n_slot & (n_slot - 1)) == 0 );
+    CPPAD_ASSERT_UNKNOWN( 2 * n_entry_ <= n_slot );
+    pod_vector<addr_t> old_table(n_slot);
+    old_table.swap(table_);
+    for(size_t slot = 0; slot < n_slot; ++slot)
+        table_[slot] = 0;
+    size_t mask = n_slot - 1;
+    for(size_t i = 0; i < old_table.size(); ++i)
+    {   addr_t index = old_table[i];
+        if( index != 0 )
+        {   size_t slot = start( par_vec[index] );
+            while( table_[slot] != 0 )
+                slot = (slot + 1) & mask;
+            table_[slot] = index;
+        }
+    }
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+# endif
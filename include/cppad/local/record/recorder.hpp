@@ -13,6 +13,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 ---------------------------------------------------------------------------- */
 # include <cppad/core/hash_code.hpp>
 # include <cppad/local/pod_vector.hpp>
+# include <cppad/local/record/con_par_hash.hpp>
 # include <cppad/core/ad_type.hpp>
 
 // ----------------------------------------------------------------------------
@@ -64,8 +65,8 @@ private:
     /// Character strings ('\\0' terminated) in the recording.
     pod_vector<char> text_vec_;
 
-    /// Hash table to reduced number of duplicate parameters in all_par_vec_
-    pod_vector<addr_t> par_hash_table_;
+    /// Hash table used to avoid duplicate constant parameters in all_par_vec_
+    con_par_hash<Base> con_par_hash_;
 
     /// Vector containing all the parameters in the recording.
     /// Use pod_vector_maybe because Base may not be plain old data.
@@ -87,16 +88,9 @@ public:
     recorder(void) :
     num_var_rec_(0)                          ,
     num_dynamic_ind_(0)                      ,
-    num_var_load_rec_(0)                      ,
-    par_hash_table_( CPPAD_HASH_TABLE_SIZE )
+    num_var_load_rec_(0)
     {   record_compare_ = true;
         abort_op_index_ = 0;
-        // It does not matter if unitialized hash codes match but this
-        // initilaization is here to avoid valgrind warnings.
-        void*  ptr   = static_cast<void*>( par_hash_table_.data() );
-        int    value = 0;
-        size_t num   = CPPAD_HASH_TABLE_SIZE * sizeof(addr_t);
-        std::memset(ptr, value, num);
     }
 
     /// Set record_compare option
@@ -127,6 +121,17 @@ public:
     ~recorder(void)
     { }
 
+    /// Reserve memory for a recording of known size
+    void reserve(
+        size_t num_op       ,
+        size_t num_op_arg   ,
+        size_t num_par      ,
+        size_t num_dyn_par  ,
+        size_t num_dyn_arg  ,
+        size_t num_text     ,
+        size_t num_vecad_ind
+    );
+
     /// Put a dynamic parameter in all_par_vec_.
     addr_t put_dyn_par(
         const Base &par, op_code_dyn op
@@ -268,11 +273,64 @@ public:
              + all_var_vecad_ind_.capacity() * sizeof(addr_t)
              + arg_vec_.capacity()       * sizeof(addr_t)
              + all_par_vec_.capacity()   * sizeof(Base)
-             + text_vec_.capacity()      * sizeof(char);
+             + text_vec_.capacity()      * sizeof(char)
+             + con_par_hash_.n_slot()    * sizeof(addr_t);
     }
 
 };
 
+/*!
+Reserve memory for a recording of known size.
+
+The sizes are usually those of a previous recording of the same function.
+If the recording turns out to be larger, the vectors grow as usual.
+This does not change the recording.
+
+\param num_op
+number of operators; see op_vec_.
+
+\param num_op_arg
+number of operator arguments; see arg_vec_.
+
+\param num_par
+number of parameters; see all_par_vec_ and dyn_par_is_.
+The constant parameters, num_par - num_dyn_par, are also used to
+reserve the slots in con_par_hash_.
+
+\param num_dyn_par
+number of dynamic parameters; see dyn_par_op_.
+
+\param num_dyn_arg
+number of dynamic parameter operator arguments; see dyn_par_arg_.
+
+\param num_text
+number of characters in the text for this recording; see text_vec_.
+
+\param num_vecad_ind
+number of VecAD indices; see all_var_vecad_ind_.
+*/
+template <class Base>
+void recorder<Base>::reserve(
+    size_t num_op       ,
+    size_t num_op_arg   ,
+    size_t num_par      ,
+    size_t num_dyn_par  ,
+    size_t num_dyn_arg  ,
+    size_t num_text     ,
+    size_t num_vecad_ind
+)
+{   op_vec_.reserve(num_op);
+    arg_vec_.reserve(num_op_arg);
+    all_par_vec_.reserve(num_par);
+    dyn_par_is_.reserve(num_par);
+    dyn_par_op_.reserve(num_dyn_par);
+    dyn_par_arg_.reserve(num_dyn_arg);
+    text_vec_.reserve(num_text);
+    all_var_vecad_ind_.reserve(num_vecad_ind);
+    if( num_dyn_par < num_par )
+        con_par_hash_.reserve(num_par - num_dyn_par, all_par_vec_);
+}
+
 /*!
 Put next operator in the operation sequence.
 
@@ -549,29 +607,21 @@ addr_t recorder<Base>::put_con_par(const Base &par)
         CPPAD_ASSERT_UNKNOWN( isnan(par) );
 # endif
     // ---------------------------------------------------------------------
-    // check for a match with a previous parameter
-    //
-    // get hash code for this value
-    size_t code  = static_cast<size_t>( hash_code(par) );
-
-    // current index in all_par_vec_ corresponding to this hash code
-    size_t index = static_cast<size_t>( par_hash_table_[code] );
-
-    // check if the old parameter matches the new one
-    if( (0 < index) & (index < all_par_vec_.size()) )
-    {   if( ! dyn_par_is_[index] )
-            if( IdenticalEqualCon(all_par_vec_[index], par) )
-                return static_cast<addr_t>( index );
+    // check for a match with a previous constant parameter
+    // (only constant parameters are in the hash table)
+    size_t slot;
+    size_t index = con_par_hash_.find(par, all_par_vec_, slot);
+    if( index != 0 )
+    {   CPPAD_ASSERT_UNKNOWN( ! dyn_par_is_[index] );
+        return static_cast<addr_t>( index );
     }
     // ---------------------------------------------------------------------
-    // put paramerter in all_par_vec_ and replace hash entry for this codee
+    // put paramerter in all_par_vec_ and in the hash table
     //
     index = all_par_vec_.size();
     all_par_vec_.push_back( par );
     dyn_par_is_.push_back(false);
-    //
-    // change the hash table for this code to point to new value
-    par_hash_table_[code] = static_cast<addr_t>( index );
+    con_par_hash_.insert(slot, index, all_par_vec_);
     //
     // return the parameter index
     CPPAD_ASSERT_KNOWN(
@@ -119,6 +119,11 @@ void forward_sin_op_dir(
     // forward_sin_op, forward_cos_op, forward_sinh_op, forward_cosh_op
     // (except that there is a sign difference for the hyperbolic case).
     size_t m = (q-1) * r + 1;
+    if( q == 1 )
+    {   forward_dir_first_mul(r, x + 1, c[0], s + 1);
+        forward_dir_first_mul(r, x + 1, - s[0], c + 1);
+        return;
+    }
     for(size_t ell = 0; ell < r; ell++)
     {   s[m+ell] =   Base(double(q)) * x[m + ell] * c[0];
         c[m+ell] = - Base(double(q)) * x[m + ell] * s[0];
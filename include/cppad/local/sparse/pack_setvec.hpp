@@ -362,32 +362,22 @@ $end
         // initialize count of non-zero bits in this set
         size_t count = 0;
         //
-        // mask corresonding to first bit in Pack
-        Pack mask = one_;
-        //
         // number of bits in last Packing unit
         size_t n_last = (end_ - 1) % n_bit_ + 1;
         //
-        // count bits in last unit
-        Pack unit = data_[(i + 1) * n_pack_ - 1];
-        for(size_t bit = 0; bit < n_last; ++bit)
-        {   CPPAD_ASSERT_UNKNOWN( mask >= one_ );
-            if( mask & unit )
-                ++count;
-            mask = mask << 1;
-        }
-        if( n_pack_ == 1 )
-            return count;
-        //
-        // count bits in other units
-        for(size_t bit = 0; bit < n_bit_; ++bit)
-        {   CPPAD_ASSERT_UNKNOWN( mask >= one_ );
-            size_t k = n_pack_;
-            while(--k)
-            {   if( data_[i * n_pack_ + k] & mask )
+        // count bits in each unit
+        for(size_t k = 0; k < n_pack_; ++k)
+        {   Pack   unit   = data_[i * n_pack_ + k];
+            size_t n_unit = (k + 1 == n_pack_) ? n_last : n_bit_;
+            //
+            // mask corresonding to first bit in Pack
+            Pack mask = one_;
+            for(size_t bit = 0; bit < n_unit; ++bit)
+            {   CPPAD_ASSERT_UNKNOWN( mask >= one_ );
+                if( mask & unit )
                     ++count;
+                mask = mask << 1;
             }
-            mask = mask << 1;
         }
         return count;
     }
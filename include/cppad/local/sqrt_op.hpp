@@ -96,6 +96,10 @@ void forward_sqrt_op_dir(
     Base* x = taylor + i_x * num_taylor_per_var;
 
     size_t m = (q-1) * r + 1;
+    if( q == 1 )
+    {   forward_dir_first_div(r, x + 1, Base(2.0) * z[0], z + 1);
+        return;
+    }
     for(size_t ell = 0; ell < r; ell++)
     {   z[m+ell] = Base(0.0);
         for(size_t k = 1; k < q; k++)
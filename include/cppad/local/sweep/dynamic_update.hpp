@@ -0,0 +1,281 @@
+# ifndef CPPAD_LOCAL_SWEEP_DYNAMIC_UPDATE_HPP
+# define CPPAD_LOCAL_SWEEP_DYNAMIC_UPDATE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/sweep/dynamic.hpp>
+# include <cppad/local/sweep/update_eval.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/dynamic_update.hpp
+Compute the dynamic parameters that depend on the independent dynamic
+parameters that changed.
+
+The dynamic parameter operators, and the operators that use each dynamic
+parameter as an argument, are computed once by dynamic_setup.
+This is the same as the update of the variables in sweep/update_eval.hpp;
+i.e., the operators that need to be evaluated are marked using one bit
+per operator and then evaluated in one pass over the bits.
+*/
+
+/*!
+Determine the parameter arguments for a dynamic parameter operator.
+
+\param op
+is the operator.
+
+\param arg
+is the first argument for this operator in the dynamic parameter
+argument vector.
+
+\param par_arg
+Upon return, it contains the parameter index for each of the arguments
+to this operator that is a parameter
+(the parameter may be a constant or a dynamic parameter).
+*/
+inline void dynamic_par_arg(
+    op_code_dyn         op      ,
+    const addr_t*       arg     ,
+    pod_vector<size_t>& par_arg )
+{   par_arg.resize(0);
+    switch( op )
+    {
+        // atom_dyn(atom_index, n, m, n_dyn, x, y, n_arg)
+        case atom_dyn:
+        for(size_t j = 0; j < size_t( arg[1] ); ++j)
+            par_arg.push_back( size_t( arg[4 + j] ) );
+        break;
+
+        // cond_exp(cop, left, right, if_true, if_false)
+        case cond_exp_dyn:
+        for(size_t k = 1; k < 5; ++k)
+            par_arg.push_back( size_t( arg[k] ) );
+        break;
+
+        // discrete(index, argument)
+        case dis_dyn:
+        par_arg.push_back( size_t( arg[1] ) );
+        break;
+
+        case ind_dyn:
+        case result_dyn:
+        break;
+
+        // unary and binary operators
+        default:
+        for(size_t k = 0; k < num_arg_dyn(op); ++k)
+            par_arg.push_back( size_t( arg[k] ) );
+        break;
+    }
+}
+/*!
+Create the information used by dynamic_update.
+
+\param play
+On input, play->dyn_update_setup() is false and play->dyn_op2dyn() is empty.
+Upon return, play->dyn_op2dyn(), play->dyn_op2arg(), play->dyn_user_start(),
+play->dyn_user(), and play->dyn_mark() have been set
+and play->dyn_update_setup() is true.
+*/
+template <class Base>
+void dynamic_setup(player<Base>* play)
+{   const pod_vector<bool>&     dyn_par_is(      play->dyn_par_is() );
+    const pod_vector<addr_t>&   dyn_ind2par_ind( play->dyn_ind2par_ind() );
+    const pod_vector<opcode_t>& dyn_par_op(      play->dyn_par_op() );
+    const pod_vector<addr_t>&   dyn_par_arg(     play->dyn_par_arg() );
+    //
+    pod_vector<addr_t>& op2dyn     = play->dyn_op2dyn();
+    pod_vector<addr_t>& op2arg     = play->dyn_op2arg();
+    pod_vector<addr_t>& user_start = play->dyn_user_start();
+    pod_vector<addr_t>& user       = play->dyn_user();
+    pod_vector<size_t>& mark       = play->dyn_mark();
+    CPPAD_ASSERT_UNKNOWN( ! play->dyn_update_setup() );
+    CPPAD_ASSERT_UNKNOWN( op2dyn.size() == 0 );
+    //
+    size_t num_dyn = dyn_ind2par_ind.size();
+    size_t num_par = dyn_par_is.size();
+    //
+    // par2dyn[i_par]: dynamic parameter index for a parameter index
+    // (only defined when dyn_par_is[i_par] is true)
+    pod_vector<size_t> par2dyn(num_par);
+    for(size_t i_dyn = 0; i_dyn < num_dyn; ++i_dyn)
+        par2dyn[ dyn_ind2par_ind[i_dyn] ] = i_dyn;
+    //
+    // op2dyn, op2arg
+    size_t i_dyn = 0;
+    size_t i_arg = 0;
+    while( i_dyn < num_dyn )
+    {   op_code_dyn op = op_code_dyn( dyn_par_op[i_dyn] );
+        size_t n_dyn   = 1;
+        size_t n_arg   = num_arg_dyn(op);
+        if( op == atom_dyn )
+        {   size_t n = size_t( dyn_par_arg[i_arg + 1] );
+            size_t m = size_t( dyn_par_arg[i_arg + 2] );
+            n_dyn    = size_t( dyn_par_arg[i_arg + 3] );
+            n_arg    = 5 + n + m;
+# ifndef NDEBUG
+            // the dynamic results for an atomic function call are the
+            // dynamic parameters i_dyn, ... , i_dyn + n_dyn - 1
+            for(size_t i = 0; i < m; ++i)
+            {   size_t i_par = size_t( dyn_par_arg[i_arg + 4 + n + i] );
+                if( dyn_par_is[i_par] )
+                {   CPPAD_ASSERT_UNKNOWN( i_dyn <= par2dyn[i_par] );
+                    CPPAD_ASSERT_UNKNOWN( par2dyn[i_par] < i_dyn + n_dyn );
+                }
+            }
+# endif
+        }
+        op2dyn.push_back( addr_t(i_dyn) );
+        op2arg.push_back( addr_t(i_arg) );
+        i_dyn += n_dyn;
+        i_arg += n_arg;
+    }
+    CPPAD_ASSERT_UNKNOWN( i_arg == dyn_par_arg.size() );
+    size_t n_op = op2arg.size();
+    op2dyn.push_back( addr_t(num_dyn) );
+    //
+    // The first pass counts the users of each dynamic parameter and the
+    // second pass stores them.
+    pod_vector<size_t> par_arg;
+    pod_vector<size_t> count(num_dyn);
+    for(size_t j = 0; j < num_dyn; ++j)
+        count[j] = 0;
+    for(size_t pass = 0; pass < 2; ++pass)
+    {   if( pass == 1 )
+        {   user_start.resize(num_dyn + 1);
+            size_t start = 0;
+            for(size_t j = 0; j < num_dyn; ++j)
+            {   user_start[j] = addr_t( start );
+                start        += count[j];
+                count[j]      = size_t( user_start[j] );
+            }
+            user_start[num_dyn] = addr_t( start );
+            user.resize(start);
+        }
+        for(size_t k = 0; k < n_op; ++k)
+        {   op_code_dyn op = op_code_dyn( dyn_par_op[ op2dyn[k] ] );
+            dynamic_par_arg(op, dyn_par_arg.data() + op2arg[k], par_arg);
+            for(size_t ell = 0; ell < par_arg.size(); ++ell)
+            {   if( dyn_par_is[ par_arg[ell] ] )
+                {   size_t j = par2dyn[ par_arg[ell] ];
+                    if( pass == 0 )
+                        ++count[j];
+                    else
+                        user[ count[j]++ ] = addr_t(k);
+                }
+            }
+        }
+    }
+    //
+    // marks
+    size_t n_bit  = size_t( std::numeric_limits<size_t>::digits );
+    size_t n_word = (n_op + n_bit - 1) / n_bit;
+    mark.resize(n_word);
+    for(size_t k = 0; k < n_word; ++k)
+        mark[k] = 0;
+    //
+    play->set_dyn_update_setup(true);
+}
+/*!
+Compute the dynamic parameters that depend on a subset of the
+dynamic parameters.
+
+\param play
+is the player for this recording and dynamic_setup(play) has been called.
+The dynamic parameters in play->all_par_vec() that depend on the
+parameters in changed_dyn are updated.
+
+\param n_changed
+is the number of dynamic parameters that changed.
+
+\param changed_dyn
+is the dynamic parameter index for each of the parameters that changed.
+The corresponding values in play->all_par_vec() have their new values.
+
+\param not_used_rec_base
+Specifies RecBase for this call.
+
+\return
+is the number of dynamic parameter operators that were evaluated.
+*/
+template <class Base, class RecBase>
+size_t dynamic_update(
+    player<Base>*   play              ,
+    size_t          n_changed         ,
+    const size_t*   changed_dyn       ,
+    const RecBase&  not_used_rec_base )
+{   CPPAD_ASSERT_UNKNOWN( play->dyn_update_setup() );
+    //
+    pod_vector_maybe<Base>&     all_par_vec(     play->all_par_vec() );
+    const pod_vector<bool>&     dyn_par_is(      play->dyn_par_is() );
+    const pod_vector<addr_t>&   dyn_ind2par_ind( play->dyn_ind2par_ind() );
+    const pod_vector<opcode_t>& dyn_par_op(      play->dyn_par_op() );
+    const pod_vector<addr_t>&   dyn_par_arg(     play->dyn_par_arg() );
+    //
+    const addr_t* op2dyn     = play->dyn_op2dyn().data();
+    const addr_t* op2arg     = play->dyn_op2arg().data();
+    const addr_t* user_start = play->dyn_user_start().data();
+    const addr_t* user       = play->dyn_user().data();
+    size_t*       mark       = play->dyn_mark().data();
+    size_t        n_word     = play->dyn_mark().size();
+    size_t        n_bit      = size_t( std::numeric_limits<size_t>::digits );
+    //
+    // vectors used in call to atomic fuctions
+    vector<ad_type_enum> type_x;
+    vector<Base>         taylor_x, taylor_y;
+    //
+    // mark the users of the parameters that changed
+    for(size_t k = 0; k < n_changed; ++k)
+        update_mark_user(changed_dyn[k], user_start, user, mark);
+    //
+    // evaluate the marked operators and mark their users
+    size_t n_eval = 0;
+    for(size_t k = 0; k < n_word; ++k)
+    {   for(size_t b = 0; b < n_bit && (mark[k] >> b) != 0; ++b)
+        {   if( (mark[k] >> b) & size_t(1) )
+            {   size_t i_op = k * n_bit + b;
+                size_t n_dyn, n_arg;
+                dynamic_op(
+                    size_t( op2dyn[i_op] ),
+                    size_t( op2arg[i_op] ),
+                    n_dyn,
+                    n_arg,
+                    all_par_vec,
+                    dyn_par_is,
+                    dyn_ind2par_ind,
+                    dyn_par_op,
+                    dyn_par_arg,
+                    type_x,
+                    taylor_x,
+                    taylor_y,
+                    not_used_rec_base
+                );
+                CPPAD_ASSERT_UNKNOWN(
+                    n_dyn == size_t( op2dyn[i_op + 1] - op2dyn[i_op] )
+                );
+                for(size_t j = 0; j < n_dyn; ++j)
+                {   size_t i_dyn = size_t( op2dyn[i_op] ) + j;
+                    update_mark_user(i_dyn, user_start, user, mark);
+                }
+                ++n_eval;
+            }
+        }
+        mark[k] = 0;
+    }
+    return n_eval;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
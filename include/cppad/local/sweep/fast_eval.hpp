@@ -0,0 +1,870 @@
+# ifndef CPPAD_LOCAL_SWEEP_FAST_EVAL_HPP
+# define CPPAD_LOCAL_SWEEP_FAST_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cstring>
+# include <cppad/local/play/fast_inst.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/fast_eval.hpp
+Zero order forward and reverse mode sweeps using pre-decoded instructions.
+
+The instructions are created once by fast_setup and stored in the player.
+Each instruction contains a pointer to the function that evaluates the
+operator, so the sweeps do not use a switch statement or an iterator
+to decode the operators.
+The indices in the instructions use the narrowest unsigned integer type
+that can represent them, and operators with at most three arguments
+store their arguments in the instruction. Thus the sweeps read one compact
+stream of instructions instead of the instructions and the argument vector.
+*/
+
+/*!
+Copy the arguments stored in an instruction to a vector of addr_t values.
+
+\param inst
+is an instruction for an operator that has at most three arguments.
+
+\param arg
+is a vector of length three. On output, arg[k] is the k-th argument
+for this operator (k < NumArg(op)).
+*/
+template <class Base, class Addr>
+inline void fast_arg(const play::fast_inst<Base, Addr>& inst, addr_t* arg)
+{   arg[0] = addr_t( inst.arg[0] );
+    arg[1] = addr_t( inst.arg[1] );
+    arg[2] = addr_t( inst.arg[2] );
+}
+
+// ---------------------------------------------------------------------------
+/*
+Macros that define the functions that evaluate one instruction.
+These macros are local to this file.
+*/
+
+// unary operator with one argument that is a variable index
+# define CPPAD_FAST_UNARY(name)                                            \
+template <class Base, class Addr>                                          \
+void fast_forward0_##name(                                                 \
+    const play::fast_inst<Base, Addr>& inst,                               \
+    play::fast_forward0_info<Base>&    info )                              \
+{   size_t i_x = size_t( inst.arg[0] );                                    \
+    forward_##name##_op_0(                                                 \
+        size_t(inst.i_var), i_x, info.cap_order, info.taylor               \
+    );                                                                     \
+}                                                                          \
+template <class Base, class Addr>                                          \
+void fast_reverse_##name(                                                  \
+    const play::fast_inst<Base, Addr>& inst,                               \
+    play::fast_reverse_info<Base>&     info )                              \
+{   size_t i_x = size_t( inst.arg[0] );                                    \
+    reverse_##name##_op(info.d, size_t(inst.i_var), i_x,                   \
+        info.cap_order, info.taylor, info.nc_partial, info.partial         \
+    );                                                                     \
+}
+
+// binary operator with arguments that are variable or parameter indices
+# define CPPAD_FAST_BINARY(name)                                           \
+template <class Base, class Addr>                                          \
+void fast_forward0_##name(                                                 \
+    const play::fast_inst<Base, Addr>& inst,                               \
+    play::fast_forward0_info<Base>&    info )                              \
+{   addr_t arg[3];                                                         \
+    fast_arg(inst, arg);                                                   \
+    forward_##name##_op_0(                                                 \
+        size_t(inst.i_var), arg, info.parameter, info.cap_order, info.taylor \
+    );                                                                     \
+}                                                                          \
+template <class Base, class Addr>                                          \
+void fast_reverse_##name(                                                  \
+    const play::fast_inst<Base, Addr>& inst,                               \
+    play::fast_reverse_info<Base>&     info )                              \
+{   addr_t arg[3];                                                         \
+    fast_arg(inst, arg);                                                   \
+    reverse_##name##_op(info.d, size_t(inst.i_var), arg, info.parameter,   \
+        info.cap_order, info.taylor, info.nc_partial, info.partial         \
+    );                                                                     \
+}
+
+// comparison operator with two parameter arguments
+# define CPPAD_FAST_COMPARE_PP(name)                                       \
+template <class Base, class Addr>                                          \
+void fast_forward0_##name(                                                 \
+    const play::fast_inst<Base, Addr>& inst,                               \
+    play::fast_forward0_info<Base>&    info )                              \
+{   if( info.compare_change_count )                                        \
+    {   addr_t arg[3];                                                     \
+        fast_arg(inst, arg);                                               \
+        forward_##name##_op_0(                                             \
+            info.compare_change_number, arg, info.parameter                \
+        );                                                                 \
+        if( info.compare_change_count == info.compare_change_number )      \
+            info.compare_change_op_index = size_t( inst.i_op );            \
+    }                                                                      \
+}
+
+// comparison operator with at least one variable argument
+# define CPPAD_FAST_COMPARE(name)                                          \
+template <class Base, class Addr>                                          \
+void fast_forward0_##name(                                                 \
+    const play::fast_inst<Base, Addr>& inst,                               \
+    play::fast_forward0_info<Base>&    info )                              \
+{   if( info.compare_change_count )                                        \
+    {   addr_t arg[3];                                                     \
+        fast_arg(inst, arg);                                               \
+        forward_##name##_op_0(info.compare_change_number,                  \
+            arg, info.parameter, info.cap_order, info.taylor               \
+        );                                                                 \
+        if( info.compare_change_count == info.compare_change_number )      \
+            info.compare_change_op_index = size_t( inst.i_op );            \
+    }                                                                      \
+}
+
+CPPAD_FAST_UNARY(abs)
+CPPAD_FAST_UNARY(acos)
+CPPAD_FAST_UNARY(asin)
+CPPAD_FAST_UNARY(atan)
+CPPAD_FAST_UNARY(cos)
+CPPAD_FAST_UNARY(cosh)
+CPPAD_FAST_UNARY(exp)
+CPPAD_FAST_UNARY(log)
+CPPAD_FAST_UNARY(sign)
+CPPAD_FAST_UNARY(sin)
+CPPAD_FAST_UNARY(sinh)
+CPPAD_FAST_UNARY(sqrt)
+CPPAD_FAST_UNARY(tan)
+CPPAD_FAST_UNARY(tanh)
+# if CPPAD_USE_CPLUSPLUS_2011
+CPPAD_FAST_UNARY(acosh)
+CPPAD_FAST_UNARY(asinh)
+CPPAD_FAST_UNARY(atanh)
+CPPAD_FAST_UNARY(expm1)
+CPPAD_FAST_UNARY(log1p)
+# endif
+//
+CPPAD_FAST_BINARY(addpv)
+CPPAD_FAST_BINARY(addvv)
+CPPAD_FAST_BINARY(divpv)
+CPPAD_FAST_BINARY(divvp)
+CPPAD_FAST_BINARY(divvv)
+CPPAD_FAST_BINARY(mulpv)
+CPPAD_FAST_BINARY(mulvv)
+CPPAD_FAST_BINARY(powpv)
+CPPAD_FAST_BINARY(powvp)
+CPPAD_FAST_BINARY(powvv)
+CPPAD_FAST_BINARY(subpv)
+CPPAD_FAST_BINARY(subvp)
+CPPAD_FAST_BINARY(subvv)
+CPPAD_FAST_BINARY(zmulpv)
+CPPAD_FAST_BINARY(zmulvp)
+CPPAD_FAST_BINARY(zmulvv)
+//
+CPPAD_FAST_COMPARE_PP(eqpp)
+CPPAD_FAST_COMPARE_PP(lepp)
+CPPAD_FAST_COMPARE_PP(ltpp)
+CPPAD_FAST_COMPARE_PP(nepp)
+CPPAD_FAST_COMPARE(eqpv)
+CPPAD_FAST_COMPARE(eqvv)
+CPPAD_FAST_COMPARE(lepv)
+CPPAD_FAST_COMPARE(levp)
+CPPAD_FAST_COMPARE(levv)
+CPPAD_FAST_COMPARE(ltpv)
+CPPAD_FAST_COMPARE(ltvp)
+CPPAD_FAST_COMPARE(ltvv)
+CPPAD_FAST_COMPARE(nepv)
+CPPAD_FAST_COMPARE(nevv)
+
+# undef CPPAD_FAST_UNARY
+# undef CPPAD_FAST_BINARY
+# undef CPPAD_FAST_COMPARE_PP
+# undef CPPAD_FAST_COMPARE
+
+// ---------------------------------------------------------------------------
+// operators that do not fit one of the patterns above
+
+/// reverse mode for an operator that does not affect derivatives
+template <class Base, class Addr>
+void fast_reverse_none(
+    const play::fast_inst<Base, Addr>& /* inst */ ,
+    play::fast_reverse_info<Base>&     /* info */ )
+{ }
+
+/// zero order forward mode for CExpOp
+template <class Base, class Addr>
+void fast_forward0_cond(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_forward0_info<Base>&    info )
+{   const addr_t* arg = info.arg_vec + size_t( inst.arg[0] );
+    forward_cond_op_0(
+        size_t(inst.i_var), arg, info.num_par, info.parameter,
+        info.cap_order, info.taylor
+    );
+}
+/// reverse mode for CExpOp
+template <class Base, class Addr>
+void fast_reverse_cond(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_reverse_info<Base>&     info )
+{   const addr_t* arg = info.arg_vec + size_t( inst.arg[0] );
+    reverse_cond_op(
+        info.d, size_t(inst.i_var), arg, info.num_par, info.parameter,
+        info.cap_order, info.taylor, info.nc_partial, info.partial
+    );
+}
+/// zero order forward mode for CSumOp
+template <class Base, class Addr>
+void fast_forward0_csum(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_forward0_info<Base>&    info )
+{   const addr_t* arg = info.arg_vec + size_t( inst.arg[0] );
+    forward_csum_op(
+        0, 0, size_t(inst.i_var), arg, info.num_par, info.parameter,
+        info.cap_order, info.taylor
+    );
+}
+/// reverse mode for CSumOp
+template <class Base, class Addr>
+void fast_reverse_csum(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_reverse_info<Base>&     info )
+{   const addr_t* arg = info.arg_vec + size_t( inst.arg[0] );
+    reverse_csum_op(
+        info.d, size_t(inst.i_var), arg, info.nc_partial, info.partial
+    );
+}
+/// zero order forward mode for DisOp
+template <class Base, class Addr>
+void fast_forward0_dis(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_forward0_info<Base>&    info )
+{   addr_t arg[3];
+    fast_arg(inst, arg);
+    forward_dis_op(
+        0, 0, 1, size_t(inst.i_var), arg, info.cap_order, info.taylor
+    );
+}
+/// zero order forward mode for ErfOp and ErfcOp
+template <class Base, class Addr>
+void fast_forward0_erf(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_forward0_info<Base>&    info )
+{
+# if CPPAD_USE_CPLUSPLUS_2011
+    addr_t arg[3];
+    fast_arg(inst, arg);
+    forward_erf_op_0(OpCode(inst.op), size_t(inst.i_var), arg,
+        info.parameter, info.cap_order, info.taylor
+    );
+# else
+    CPPAD_ASSERT_UNKNOWN(false);
+# endif
+}
+/// reverse mode for ErfOp and ErfcOp
+template <class Base, class Addr>
+void fast_reverse_erf(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_reverse_info<Base>&     info )
+{
+# if CPPAD_USE_CPLUSPLUS_2011
+    addr_t arg[3];
+    fast_arg(inst, arg);
+    reverse_erf_op(OpCode(inst.op), info.d, size_t(inst.i_var), arg,
+        info.parameter, info.cap_order, info.taylor,
+        info.nc_partial, info.partial
+    );
+# else
+    CPPAD_ASSERT_UNKNOWN(false);
+# endif
+}
+/// zero order forward mode for ParOp
+template <class Base, class Addr>
+void fast_forward0_par(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_forward0_info<Base>&    info )
+{   addr_t arg[3];
+    fast_arg(inst, arg);
+    forward_par_op_0(
+        size_t(inst.i_var), arg, info.num_par, info.parameter,
+        info.cap_order, info.taylor
+    );
+}
+// ---------------------------------------------------------------------------
+/*!
+Create the pre-decoded instructions for a player using a specific
+type for the indices in the instructions.
+
+\tparam Addr
+is the type used for the indices in the instructions.
+
+\param play
+On input, play->fast_vec() is empty.
+Upon return, if the recording can be evaluated using fast instructions,
+play->fast_vec() contains one play::fast_inst<Base, Addr> instruction
+for each operator that needs to be evaluated.
+Otherwise, play->fast_vec() is empty.
+
+\return
+is true (false) if the recording can (cannot) be evaluated using
+the fast instructions.
+*/
+template <class Base, class Addr>
+bool fast_setup_addr(player<Base>* play)
+{   pod_vector<unsigned char>& fast_vec( play->fast_vec() );
+    CPPAD_ASSERT_UNKNOWN( fast_vec.size() == 0 );
+    //
+    const addr_t* arg_vec = play->GetArg();
+    //
+    play::fast_inst<Base, Addr> inst;
+    play::const_sequential_iterator itr = play->begin();
+    OpCode        op;
+    const addr_t* arg;
+    size_t        i_var;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    bool ok             = true;
+    bool more_operators = true;
+    while( ok && more_operators )
+    {   (++itr).op_info(op, arg, i_var);
+        //
+        inst.forward0 = CPPAD_NULL;
+        inst.reverse  = fast_reverse_none<Base, Addr>;
+        switch( op )
+        {   // -------------------------------------------------------------
+            // operators that are not evaluated
+            case EndOp:
+            more_operators = false;
+            break;
+
+            case InvOp:
+            break;
+
+            case CSkipOp:
+            itr.correct_before_increment();
+            break;
+
+            // -------------------------------------------------------------
+            // operators that are not supported
+            case AFunOp:
+            case FunapOp:
+            case FunavOp:
+            case FunrpOp:
+            case FunrvOp:
+            case LdpOp:
+            case LdvOp:
+            case PriOp:
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            ok = false;
+            break;
+
+            // -------------------------------------------------------------
+            case AbsOp:
+            inst.forward0 = fast_forward0_abs<Base, Addr>;
+            inst.reverse  = fast_reverse_abs<Base, Addr>;
+            break;
+
+            case AcosOp:
+            inst.forward0 = fast_forward0_acos<Base, Addr>;
+            inst.reverse  = fast_reverse_acos<Base, Addr>;
+            break;
+
+            case AsinOp:
+            inst.forward0 = fast_forward0_asin<Base, Addr>;
+            inst.reverse  = fast_reverse_asin<Base, Addr>;
+            break;
+
+            case AtanOp:
+            inst.forward0 = fast_forward0_atan<Base, Addr>;
+            inst.reverse  = fast_reverse_atan<Base, Addr>;
+            break;
+
+            case CosOp:
+            inst.forward0 = fast_forward0_cos<Base, Addr>;
+            inst.reverse  = fast_reverse_cos<Base, Addr>;
+            break;
+
+            case CoshOp:
+            inst.forward0 = fast_forward0_cosh<Base, Addr>;
+            inst.reverse  = fast_reverse_cosh<Base, Addr>;
+            break;
+
+            case ExpOp:
+            inst.forward0 = fast_forward0_exp<Base, Addr>;
+            inst.reverse  = fast_reverse_exp<Base, Addr>;
+            break;
+
+            case LogOp:
+            inst.forward0 = fast_forward0_log<Base, Addr>;
+            inst.reverse  = fast_reverse_log<Base, Addr>;
+            break;
+
+            case SignOp:
+            inst.forward0 = fast_forward0_sign<Base, Addr>;
+            inst.reverse  = fast_reverse_sign<Base, Addr>;
+            break;
+
+            case SinOp:
+            inst.forward0 = fast_forward0_sin<Base, Addr>;
+            inst.reverse  = fast_reverse_sin<Base, Addr>;
+            break;
+
+            case SinhOp:
+            inst.forward0 = fast_forward0_sinh<Base, Addr>;
+            inst.reverse  = fast_reverse_sinh<Base, Addr>;
+            break;
+
+            case SqrtOp:
+            inst.forward0 = fast_forward0_sqrt<Base, Addr>;
+            inst.reverse  = fast_reverse_sqrt<Base, Addr>;
+            break;
+
+            case TanOp:
+            inst.forward0 = fast_forward0_tan<Base, Addr>;
+            inst.reverse  = fast_reverse_tan<Base, Addr>;
+            break;
+
+            case TanhOp:
+            inst.forward0 = fast_forward0_tanh<Base, Addr>;
+            inst.reverse  = fast_reverse_tanh<Base, Addr>;
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            inst.forward0 = fast_forward0_acosh<Base, Addr>;
+            inst.reverse  = fast_reverse_acosh<Base, Addr>;
+            break;
+
+            case AsinhOp:
+            inst.forward0 = fast_forward0_asinh<Base, Addr>;
+            inst.reverse  = fast_reverse_asinh<Base, Addr>;
+            break;
+
+            case AtanhOp:
+            inst.forward0 = fast_forward0_atanh<Base, Addr>;
+            inst.reverse  = fast_reverse_atanh<Base, Addr>;
+            break;
+
+            case Expm1Op:
+            inst.forward0 = fast_forward0_expm1<Base, Addr>;
+            inst.reverse  = fast_reverse_expm1<Base, Addr>;
+            break;
+
+            case Log1pOp:
+            inst.forward0 = fast_forward0_log1p<Base, Addr>;
+            inst.reverse  = fast_reverse_log1p<Base, Addr>;
+            break;
+
+            case ErfOp:
+            case ErfcOp:
+            inst.forward0 = fast_forward0_erf<Base, Addr>;
+            inst.reverse  = fast_reverse_erf<Base, Addr>;
+            break;
+# endif
+            // -------------------------------------------------------------
+            case AddpvOp:
+            inst.forward0 = fast_forward0_addpv<Base, Addr>;
+            inst.reverse  = fast_reverse_addpv<Base, Addr>;
+            break;
+
+            case AddvvOp:
+            inst.forward0 = fast_forward0_addvv<Base, Addr>;
+            inst.reverse  = fast_reverse_addvv<Base, Addr>;
+            break;
+
+            case DivpvOp:
+            inst.forward0 = fast_forward0_divpv<Base, Addr>;
+            inst.reverse  = fast_reverse_divpv<Base, Addr>;
+            break;
+
+            case DivvpOp:
+            inst.forward0 = fast_forward0_divvp<Base, Addr>;
+            inst.reverse  = fast_reverse_divvp<Base, Addr>;
+            break;
+
+            case DivvvOp:
+            inst.forward0 = fast_forward0_divvv<Base, Addr>;
+            inst.reverse  = fast_reverse_divvv<Base, Addr>;
+            break;
+
+            case MulpvOp:
+            inst.forward0 = fast_forward0_mulpv<Base, Addr>;
+            inst.reverse  = fast_reverse_mulpv<Base, Addr>;
+            break;
+
+            case MulvvOp:
+            inst.forward0 = fast_forward0_mulvv<Base, Addr>;
+            inst.reverse  = fast_reverse_mulvv<Base, Addr>;
+            break;
+
+            case PowpvOp:
+            inst.forward0 = fast_forward0_powpv<Base, Addr>;
+            inst.reverse  = fast_reverse_powpv<Base, Addr>;
+            break;
+
+            case PowvpOp:
+            inst.forward0 = fast_forward0_powvp<Base, Addr>;
+            inst.reverse  = fast_reverse_powvp<Base, Addr>;
+            break;
+
+            case PowvvOp:
+            inst.forward0 = fast_forward0_powvv<Base, Addr>;
+            inst.reverse  = fast_reverse_powvv<Base, Addr>;
+            break;
+
+            case SubpvOp:
+            inst.forward0 = fast_forward0_subpv<Base, Addr>;
+            inst.reverse  = fast_reverse_subpv<Base, Addr>;
+            break;
+
+            case SubvpOp:
+            inst.forward0 = fast_forward0_subvp<Base, Addr>;
+            inst.reverse  = fast_reverse_subvp<Base, Addr>;
+            break;
+
+            case SubvvOp:
+            inst.forward0 = fast_forward0_subvv<Base, Addr>;
+            inst.reverse  = fast_reverse_subvv<Base, Addr>;
+            break;
+
+            case ZmulpvOp:
+            inst.forward0 = fast_forward0_zmulpv<Base, Addr>;
+            inst.reverse  = fast_reverse_zmulpv<Base, Addr>;
+            break;
+
+            case ZmulvpOp:
+            inst.forward0 = fast_forward0_zmulvp<Base, Addr>;
+            inst.reverse  = fast_reverse_zmulvp<Base, Addr>;
+            break;
+
+            case ZmulvvOp:
+            inst.forward0 = fast_forward0_zmulvv<Base, Addr>;
+            inst.reverse  = fast_reverse_zmulvv<Base, Addr>;
+            break;
+
+            // -------------------------------------------------------------
+            case EqppOp:
+            inst.forward0 = fast_forward0_eqpp<Base, Addr>;
+            break;
+
+            case EqpvOp:
+            inst.forward0 = fast_forward0_eqpv<Base, Addr>;
+            break;
+
+            case EqvvOp:
+            inst.forward0 = fast_forward0_eqvv<Base, Addr>;
+            break;
+
+            case LeppOp:
+            inst.forward0 = fast_forward0_lepp<Base, Addr>;
+            break;
+
+            case LepvOp:
+            inst.forward0 = fast_forward0_lepv<Base, Addr>;
+            break;
+
+            case LevpOp:
+            inst.forward0 = fast_forward0_levp<Base, Addr>;
+            break;
+
+            case LevvOp:
+            inst.forward0 = fast_forward0_levv<Base, Addr>;
+            break;
+
+            case LtppOp:
+            inst.forward0 = fast_forward0_ltpp<Base, Addr>;
+            break;
+
+            case LtpvOp:
+            inst.forward0 = fast_forward0_ltpv<Base, Addr>;
+            break;
+
+            case LtvpOp:
+            inst.forward0 = fast_forward0_ltvp<Base, Addr>;
+            break;
+
+            case LtvvOp:
+            inst.forward0 = fast_forward0_ltvv<Base, Addr>;
+            break;
+
+            case NeppOp:
+            inst.forward0 = fast_forward0_nepp<Base, Addr>;
+            break;
+
+            case NepvOp:
+            inst.forward0 = fast_forward0_nepv<Base, Addr>;
+            break;
+
+            case NevvOp:
+            inst.forward0 = fast_forward0_nevv<Base, Addr>;
+            break;
+
+            // -------------------------------------------------------------
+            case CExpOp:
+            inst.forward0 = fast_forward0_cond<Base, Addr>;
+            inst.reverse  = fast_reverse_cond<Base, Addr>;
+            break;
+
+            case CSumOp:
+            inst.forward0 = fast_forward0_csum<Base, Addr>;
+            inst.reverse  = fast_reverse_csum<Base, Addr>;
+            itr.correct_before_increment();
+            break;
+
+            case DisOp:
+            inst.forward0 = fast_forward0_dis<Base, Addr>;
+            break;
+
+            case ParOp:
+            inst.forward0 = fast_forward0_par<Base, Addr>;
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+            ok = false;
+        }
+        if( inst.forward0 != CPPAD_NULL )
+        {   inst.op    = opcode_t( op );
+            inst.i_op  = Addr( itr.op_index() );
+            inst.i_var = Addr( i_var );
+            if( op == CExpOp || op == CSumOp )
+            {   inst.arg[0] = Addr( arg - arg_vec );
+                inst.arg[1] = 0;
+                inst.arg[2] = 0;
+            }
+            else
+            {   size_t n_arg = NumArg(op);
+                CPPAD_ASSERT_UNKNOWN( n_arg <= 3 );
+                for(size_t k = 0; k < 3; ++k)
+                    inst.arg[k] = k < n_arg ? Addr( arg[k] ) : Addr(0);
+            }
+            size_t i_byte = fast_vec.extend( sizeof(inst) );
+            std::memcpy(fast_vec.data() + i_byte, &inst, sizeof(inst));
+        }
+    }
+    if( ! ok )
+        fast_vec.clear();
+    return ok;
+}
+/*!
+Create the pre-decoded instructions for a player.
+
+The type used for the indices in the instructions is the narrowest
+that can represent the operator, variable, argument, and parameter
+indices in the recording; see play::fast_address_type.
+
+\param play
+On input, play->fast_vec() is empty or contains the result of a previous
+call to fast_setup.
+Upon return, if the recording can be evaluated using fast instructions,
+play->fast_vec() contains one instruction for each operator
+that needs to be evaluated
+and play->fast_addr() is the type used for the indices.
+Otherwise, play->fast_vec() is empty.
+
+\return
+is true (false) if the recording can (cannot) be evaluated using
+the fast instructions. The operators that prevent this are
+VecAD load and store operators, atomic function operators,
+and PrintFor operators.
+The CSkipOp operators are ignored; i.e., the fast sweeps evaluate
+all of the operators.
+*/
+template <class Base>
+bool fast_setup(player<Base>* play)
+{   if( play->fast_vec().size() > 0 )
+        return true;
+    //
+    play::addr_enum fast_addr = play::fast_address_type(
+        play->num_var_rec(),
+        play->num_op_rec(),
+        play->num_op_arg_rec(),
+        play->num_par_rec()
+    );
+    play->set_fast_addr(fast_addr);
+    bool ok = false;
+    switch( fast_addr )
+    {   case play::unsigned_short_enum:
+        ok = fast_setup_addr<Base, unsigned short>(play);
+        break;
+
+        case play::unsigned_int_enum:
+        ok = fast_setup_addr<Base, unsigned int>(play);
+        break;
+
+        case play::size_t_enum:
+        ok = fast_setup_addr<Base, size_t>(play);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return ok;
+}
+// ---------------------------------------------------------------------------
+/*!
+Evaluate the pre-decoded zero order forward instructions in order.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+*/
+template <class Base, class Addr>
+void fast_forward0_addr(
+    const player<Base>*              play ,
+    play::fast_forward0_info<Base>&  info )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* inst = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    size_t n_inst = play->fast_vec().size() / sizeof(inst_t);
+    for(size_t i = 0; i < n_inst; ++i)
+        inst[i].forward0(inst[i], info);
+}
+/*!
+Evaluate the pre-decoded reverse mode instructions in reverse order.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+*/
+template <class Base, class Addr>
+void fast_reverse_addr(
+    const player<Base>*             play ,
+    play::fast_reverse_info<Base>&  info )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* inst = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    size_t i = play->fast_vec().size() / sizeof(inst_t);
+    while(i--)
+        inst[i].reverse(inst[i], info);
+}
+/*!
+Zero order forward mode using the pre-decoded instructions.
+
+\param play
+is the player for this recording and fast_setup(play)
+has returned true.
+
+\param J
+is the number of columns in the taylor matrix.
+
+\param taylor
+\b Input: For i = 1, ... , n, taylor[ i * J + 0 ] is the value of the
+i-th variable (an independent variable).
+\n
+\b Output: For i = n+1, ... , numvar-1, taylor[ i * J + 0 ] is the value
+of the i-th variable.
+
+\param compare_change_count
+\param compare_change_number
+\param compare_change_op_index
+see the corresponding arguments to sweep::forward0.
+*/
+template <class Base>
+void fast_forward0(
+    const player<Base>*  play                    ,
+    size_t               J                       ,
+    Base*                taylor                  ,
+    size_t               compare_change_count    ,
+    size_t&              compare_change_number   ,
+    size_t&              compare_change_op_index )
+{   CPPAD_ASSERT_UNKNOWN( play->fast_vec().size() > 0 );
+    //
+    play::fast_forward0_info<Base> info;
+    info.arg_vec                 = play->GetArg();
+    info.num_par                 = play->num_par_rec();
+    info.parameter               = play->GetPar();
+    info.cap_order               = J;
+    info.taylor                  = taylor;
+    info.compare_change_count    = compare_change_count;
+    info.compare_change_number   = 0;
+    info.compare_change_op_index = 0;
+    //
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        fast_forward0_addr<Base, unsigned short>(play, info);
+        break;
+
+        case play::unsigned_int_enum:
+        fast_forward0_addr<Base, unsigned int>(play, info);
+        break;
+
+        case play::size_t_enum:
+        fast_forward0_addr<Base, size_t>(play, info);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    //
+    compare_change_number   = info.compare_change_number;
+    compare_change_op_index = info.compare_change_op_index;
+}
+/*!
+Reverse mode using the pre-decoded instructions.
+
+\param play
+is the player for this recording and fast_setup(play)
+has returned true.
+
+\param d
+\param J
+\param Taylor
+\param K
+\param Partial
+see the corresponding arguments to sweep::reverse.
+*/
+template <class Base>
+void fast_reverse(
+    const player<Base>*  play     ,
+    size_t               d        ,
+    size_t               J        ,
+    const Base*          Taylor   ,
+    size_t               K        ,
+    Base*                Partial  )
+{   CPPAD_ASSERT_UNKNOWN( play->fast_vec().size() > 0 );
+    //
+    play::fast_reverse_info<Base> info;
+    info.arg_vec    = play->GetArg();
+    info.num_par    = play->num_par_rec();
+    info.parameter  = play->GetPar();
+    info.d          = d;
+    info.cap_order  = J;
+    info.taylor     = Taylor;
+    info.nc_partial = K;
+    info.partial    = Partial;
+    //
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        fast_reverse_addr<Base, unsigned short>(play, info);
+        break;
+
+        case play::unsigned_int_enum:
+        fast_reverse_addr<Base, unsigned int>(play, info);
+        break;
+
+        case play::size_t_enum:
+        fast_reverse_addr<Base, size_t>(play, info);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
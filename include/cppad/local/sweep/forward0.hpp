@@ -38,7 +38,7 @@ $$
 $section Compute Zero Order Forward Mode Taylor Coefficients$$
 
 $head Syntax$$
-$codei% forward0(
+$codei%%cskip_any% = forward0(
     %play%,
     %s_out%,
     %print%,
@@ -149,11 +149,16 @@ but rather the $icode compare_change_count$$ comparison.
 $head not_used_rec_base$$
 Specifies $icode RecBase$$ for this call.
 
+$head cskip_any$$
+This return value is true if $icode%cskip_op%[%i%]%$$ is true
+for some operator index $icode i$$.
+Otherwise, all the elements of $icode cskip_op$$ are false.
+
 $end
 */
 
 template <class Addr, class Base, class RecBase>
-void forward0(
+bool forward0(
     const local::player<Base>* play,
     std::ostream&              s_out,
     bool                       print,
@@ -203,6 +208,7 @@ void forward0(
         for(i = 0; i < num; i++)
             cskip_op[i] = false;
     }
+    bool cskip_any = false;
 
     // information used by atomic function operators
     const pod_vector<bool>& dyn_par_is( play->dyn_par_is() );
@@ -387,7 +393,7 @@ void forward0(
             // -------------------------------------------------
 
             case CSkipOp:
-            forward_cskip_op_0(
+            cskip_any |= forward_cskip_op_0(
                 i_var, arg, num_par, parameter, J, taylor, cskip_op
             );
             itr.correct_before_increment();
@@ -996,7 +1002,7 @@ void forward0(
 # endif
     CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
 
-    return;
+    return cskip_any;
 }
 
 } } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
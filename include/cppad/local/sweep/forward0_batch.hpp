@@ -0,0 +1,671 @@
+# ifndef CPPAD_LOCAL_SWEEP_FORWARD0_BATCH_HPP
+# define CPPAD_LOCAL_SWEEP_FORWARD0_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/local/sweep/call_atomic.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/forward0_batch.hpp
+Compute zero order forward mode Taylor coefficients at multiple points.
+*/
+
+/*!
+Compute zero order forward mode Taylor coefficients at N points
+using one pass through the operation sequence.
+
+Each operator is decoded once and then applied to all N points.
+The values for one variable at all the points are stored contiguously
+so the loop over the points uses unit stride memory access.
+This is done by calling the zero order operator routines,
+for example forward_mulvv_op_0, with cap_order equal to N
+and the taylor pointer shifted by the point index.
+
+\tparam Base
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type AD<Base>.
+
+\param play
+The information stored in play
+is a recording of the operations corresponding to the function
+\f[
+    F : {\bf R}^n \rightarrow {\bf R}^m
+\f]
+where \f$ n \f$ is the number of independent variables and
+\f$ m \f$ is the number of dependent variables.
+
+\param n
+is the number of independent variables on the tape.
+
+\param numvar
+is the total number of variables on the tape; i.e.,
+play->num_var_rec().
+
+\param N
+is the number of points at which the function is evaluated.
+This must be greater than or equal one.
+
+\param taylor
+has size numvar * N.
+\n
+\n
+\b Input:
+For <code>i = 1 , ... , n</code>,
+<code>k = 0 , ... , N-1</code>,
+<code>taylor[ i * N + k ]</code>
+is the value of the i-th variable (an independent variable) at the k-th point.
+\n
+\n
+\b Output:
+For <code>i = n+1 , ... , numvar-1</code>,
+<code>k = 0 , ... , N-1</code>,
+<code>taylor[ i * N + k ]</code>
+is the value of the i-th variable at the k-th point.
+
+\param not_used_rec_base
+Specifies RecBase for this call.
+
+\par Comparison Operators
+Comparison operators are not checked; i.e.,
+the compare change information is not computed during this sweep.
+
+\par Conditional Skipping
+The result of a CSkipOp operator depends on the point,
+so no operators are skipped during this sweep.
+
+\par Print Operators
+The PriOp operators do not generate any output during this sweep.
+*/
+template <class Addr, class Base, class RecBase>
+void forward0_batch(
+    const local::player<Base>* play,
+    size_t                     n,
+    size_t                     numvar,
+    size_t                     N,
+    Base*                      taylor,
+    const RecBase&             not_used_rec_base
+)
+{   CPPAD_ASSERT_UNKNOWN( N >= 1 );
+    CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+
+    // temporary index
+    size_t k;
+
+    // VecAD information (a separate copy for each point)
+    size_t num_vecad_ind = play->num_var_vecad_ind_rec();
+    pod_vector<bool>   vec_ad2isvar;
+    pod_vector<size_t> vec_ad2index;
+    if( num_vecad_ind > 0 )
+    {   vec_ad2isvar.extend(num_vecad_ind * N);
+        vec_ad2index.extend(num_vecad_ind * N);
+        for(size_t i = 0; i < num_vecad_ind; i++)
+        {   size_t index = play->GetVecInd(i);
+            for(k = 0; k < N; k++)
+            {   vec_ad2index[k * num_vecad_ind + i] = index;
+                vec_ad2isvar[k * num_vecad_ind + i] = false;
+            }
+        }
+    }
+    // load operator information (a separate copy for each point)
+    size_t num_load = play->num_var_load_rec();
+    pod_vector<Addr> load_op2var;
+    if( num_load > 0 )
+        load_op2var.extend(num_load * N);
+
+    // information used by atomic function operators
+    const pod_vector<bool>& dyn_par_is( play->dyn_par_is() );
+    const size_t need_y    = size_t( variable_enum );
+    const size_t order_low = 0;
+    const size_t order_up  = 0;
+
+    // vectors used by atomic function operators
+    vector<Base>         atom_par_x;  // argument parameter values
+    vector<ad_type_enum> atom_type_x; // argument type
+    vector<Base>         atom_tx_one; // argument values for one point
+    vector<Base>         atom_tx_all; // argument values for all points
+    vector<Base>         atom_ty_one; // result values for one point
+    vector<Base>         atom_ty_all; // result values for all points
+    //
+    // information defined by atomic function operators
+    size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
+    enum_atom_state atom_state = start_atom; // proper initialization
+
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+
+    // skip the BeginOp at the beginning of the recording
+    play::const_sequential_iterator itr = play->begin();
+    // op_info
+    OpCode op;
+    size_t i_var;
+    const Addr*   arg;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    //
+    bool flag; // a temporary flag to use in switch cases
+    bool more_operators = true;
+    while(more_operators)
+    {
+        // next op
+        (++itr).op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( itr.op_index() < play->num_op_rec() );
+
+        // action to take depends on the case
+        switch( op )
+        {
+            case AbsOp:
+            for(k = 0; k < N; k++)
+                forward_abs_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case AddvvOp:
+            for(k = 0; k < N; k++)
+                forward_addvv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case AddpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_addpv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case AcosOp:
+            for(k = 0; k < N; k++)
+                forward_acos_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            for(k = 0; k < N; k++)
+                forward_acosh_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case AsinOp:
+            for(k = 0; k < N; k++)
+                forward_asin_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AsinhOp:
+            for(k = 0; k < N; k++)
+                forward_asinh_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case AtanOp:
+            for(k = 0; k < N; k++)
+                forward_atan_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AtanhOp:
+            for(k = 0; k < N; k++)
+                forward_atanh_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case CExpOp:
+            for(k = 0; k < N; k++) forward_cond_op_0(
+                i_var, arg, num_par, parameter, N, taylor + k
+            );
+            break;
+            // ---------------------------------------------------
+
+            case CosOp:
+            for(k = 0; k < N; k++)
+                forward_cos_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // ---------------------------------------------------
+
+            case CoshOp:
+            for(k = 0; k < N; k++)
+                forward_cosh_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case CSkipOp:
+            // the skip depends on the point, so do not skip any operators
+            itr.correct_before_increment();
+            break;
+            // -------------------------------------------------
+
+            case CSumOp:
+            for(k = 0; k < N; k++) forward_csum_op(
+                0, 0, i_var, arg, num_par, parameter, N, taylor + k
+            );
+            itr.correct_before_increment();
+            break;
+            // -------------------------------------------------
+
+            case DisOp:
+            for(k = 0; k < N; k++)
+                forward_dis_op(0, 0, 1, i_var, arg, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case DivvvOp:
+            for(k = 0; k < N; k++)
+                forward_divvv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case DivpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_divpv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case DivvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_divvp_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case EndOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 0);
+            more_operators = false;
+            break;
+            // -------------------------------------------------
+
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            // comparison operators are not checked during this sweep
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case ErfOp:
+            case ErfcOp:
+            for(k = 0; k < N; k++)
+                forward_erf_op_0(op, i_var, arg, parameter, N, taylor + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case ExpOp:
+            for(k = 0; k < N; k++)
+                forward_exp_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Expm1Op:
+            for(k = 0; k < N; k++)
+                forward_expm1_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case InvOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            break;
+            // ---------------------------------------------------
+
+            case LdpOp:
+            for(k = 0; k < N; k++) forward_load_p_op_0(
+                play,
+                i_var,
+                arg,
+                parameter,
+                N,
+                taylor + k,
+                vec_ad2isvar.data() + k * num_vecad_ind,
+                vec_ad2index.data() + k * num_vecad_ind,
+                load_op2var.data()  + k * num_load
+            );
+            break;
+            // -------------------------------------------------
+
+            case LdvOp:
+            for(k = 0; k < N; k++) forward_load_v_op_0(
+                play,
+                i_var,
+                arg,
+                parameter,
+                N,
+                taylor + k,
+                vec_ad2isvar.data() + k * num_vecad_ind,
+                vec_ad2index.data() + k * num_vecad_ind,
+                load_op2var.data()  + k * num_load
+            );
+            break;
+            // -------------------------------------------------
+
+            case LogOp:
+            for(k = 0; k < N; k++)
+                forward_log_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Log1pOp:
+            for(k = 0; k < N; k++)
+                forward_log1p_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case MulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_mulpv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case MulvvOp:
+            for(k = 0; k < N; k++)
+                forward_mulvv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case ParOp:
+            for(k = 0; k < N; k++) forward_par_op_0(
+                i_var, arg, num_par, parameter, N, taylor + k
+            );
+            break;
+            // -------------------------------------------------
+
+            case PowvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_powvp_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case PowpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_powpv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case PowvvOp:
+            for(k = 0; k < N; k++)
+                forward_powvv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case PriOp:
+            // no output is generated during this sweep
+            break;
+            // -------------------------------------------------
+
+            case SignOp:
+            for(k = 0; k < N; k++)
+                forward_sign_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case SinOp:
+            for(k = 0; k < N; k++)
+                forward_sin_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case SinhOp:
+            for(k = 0; k < N; k++)
+                forward_sinh_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case SqrtOp:
+            for(k = 0; k < N; k++)
+                forward_sqrt_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case StppOp:
+            for(k = 0; k < N; k++) forward_store_pp_op_0(
+                i_var,
+                arg,
+                num_par,
+                parameter,
+                N,
+                taylor + k,
+                vec_ad2isvar.data() + k * num_vecad_ind,
+                vec_ad2index.data() + k * num_vecad_ind
+            );
+            break;
+            // -------------------------------------------------
+
+            case StpvOp:
+            for(k = 0; k < N; k++) forward_store_pv_op_0(
+                i_var,
+                arg,
+                num_par,
+                parameter,
+                N,
+                taylor + k,
+                vec_ad2isvar.data() + k * num_vecad_ind,
+                vec_ad2index.data() + k * num_vecad_ind
+            );
+            break;
+            // -------------------------------------------------
+
+            case StvpOp:
+            for(k = 0; k < N; k++) forward_store_vp_op_0(
+                i_var,
+                arg,
+                num_par,
+                N,
+                taylor + k,
+                vec_ad2isvar.data() + k * num_vecad_ind,
+                vec_ad2index.data() + k * num_vecad_ind
+            );
+            break;
+            // -------------------------------------------------
+
+            case StvvOp:
+            for(k = 0; k < N; k++) forward_store_vv_op_0(
+                i_var,
+                arg,
+                num_par,
+                N,
+                taylor + k,
+                vec_ad2isvar.data() + k * num_vecad_ind,
+                vec_ad2index.data() + k * num_vecad_ind
+            );
+            break;
+            // -------------------------------------------------
+
+            case SubvvOp:
+            for(k = 0; k < N; k++)
+                forward_subvv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case SubpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_subpv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case SubvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_subvp_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case TanOp:
+            for(k = 0; k < N; k++)
+                forward_tan_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case TanhOp:
+            for(k = 0; k < N; k++)
+                forward_tanh_op_0(i_var, size_t(arg[0]), N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case AFunOp:
+            // start or end an atomic function call
+            flag = atom_state == start_atom;
+            play::atom_op_info<RecBase>(
+                op, arg, atom_index, atom_old, atom_m, atom_n
+            );
+            if( flag )
+            {   atom_state = arg_atom;
+                atom_i     = 0;
+                atom_j     = 0;
+                //
+                atom_par_x.resize(atom_n);
+                atom_type_x.resize(atom_n);
+                atom_tx_one.resize(atom_n);
+                atom_tx_all.resize(atom_n * N);
+                atom_ty_one.resize(atom_m);
+                atom_ty_all.resize(atom_m * N);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( atom_i == atom_m );
+                CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+                atom_state = start_atom;
+            }
+            break;
+
+            case FunapOp:
+            // parameter argument for an atomic function
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j < atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            if( dyn_par_is[ arg[0] ] )
+                atom_type_x[atom_j] = dynamic_enum;
+            else
+                atom_type_x[atom_j] = constant_enum;
+            atom_par_x[atom_j] = parameter[ arg[0] ];
+            for(k = 0; k < N; k++)
+                atom_tx_all[atom_j * N + k] = parameter[ arg[0] ];
+            ++atom_j;
+            break;
+
+            case FunavOp:
+            // variable argument for a atomic function
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j < atom_n );
+            //
+            atom_type_x[atom_j] = variable_enum;
+            atom_par_x[atom_j]  = CppAD::numeric_limits<Base>::quiet_NaN();
+            for(k = 0; k < N; k++)
+                atom_tx_all[atom_j * N + k] = taylor[ size_t(arg[0]) * N + k ];
+            ++atom_j;
+            break;
+
+            case FunrpOp:
+            // parameter result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 1, 0);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i < atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            atom_i++;
+            if( atom_i == atom_m )
+                atom_state = end_atom;
+            break;
+
+            case FunrvOp:
+            // variable result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i < atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            for(k = 0; k < N; k++)
+                taylor[ i_var * N + k ] = atom_ty_all[atom_i * N + k];
+            atom_i++;
+            if( atom_i == atom_m )
+                atom_state = end_atom;
+            break;
+            // -------------------------------------------------
+
+            case ZmulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_zmulpv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case ZmulvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < N; k++)
+                forward_zmulvp_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            case ZmulvvOp:
+            for(k = 0; k < N; k++)
+                forward_zmulvv_op_0(i_var, arg, parameter, N, taylor + k);
+            break;
+            // -------------------------------------------------
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+        }
+        if( atom_state == arg_atom && atom_j == atom_n )
+        {   // call atomic function once for each point
+            for(k = 0; k < N; k++)
+            {   for(size_t j = 0; j < atom_n; j++)
+                    atom_tx_one[j] = atom_tx_all[j * N + k];
+                call_atomic_forward<Base, RecBase>(
+                    atom_par_x, atom_type_x, need_y, order_low, order_up,
+                    atom_index, atom_old, atom_tx_one, atom_ty_one
+                );
+                for(size_t i = 0; i < atom_m; i++)
+                    atom_ty_all[i * N + k] = atom_ty_one[i];
+            }
+            atom_state = ret_atom;
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
+
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
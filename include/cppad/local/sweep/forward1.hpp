@@ -162,10 +162,16 @@ play was recorded.
 
 \param not_used_rec_base
 Specifies RecBase for this call.
+
+\return
+If p is zero, the return value is true if cskip_op[i] is true for some
+operator index i; otherwise all the elements of cskip_op are false.
+If p is greater than zero, the return value is false
+(cskip_op is not modified).
 */
 
 template <class Addr, class Base, class RecBase>
-void forward1(
+bool forward1(
     const local::player<Base>* play,
     std::ostream&              s_out,
     const bool                 print,
@@ -221,6 +227,7 @@ void forward1(
         for(i = 0; i < num; i++)
             cskip_op[i] = false;
     }
+    bool cskip_any = false;
 
     // information used by atomic function operators
     const pod_vector<bool>& dyn_par_is( play->dyn_par_is() );
@@ -410,7 +417,7 @@ void forward1(
 
             case CSkipOp:
             if( p == 0 )
-            {   forward_cskip_op_0(
+            {   cskip_any |= forward_cskip_op_0(
                     i_var, arg, num_par, parameter, J, taylor, cskip_op
                 );
             }
@@ -1089,7 +1096,7 @@ void forward1(
 
     if( (p == 0) & (compare_change_count == 0) )
         compare_change_number = 0;
-    return;
+    return cskip_any;
 }
 
 // preprocessor symbols that are local to this file
@@ -0,0 +1,777 @@
+# ifndef CPPAD_LOCAL_SWEEP_LEVEL_EVAL_HPP
+# define CPPAD_LOCAL_SWEEP_LEVEL_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <algorithm>
+# include <limits>
+# include <cppad/local/sweep/slot_eval.hpp>
+# include <cppad/local/color_thread.hpp>
+
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <atomic>
+# include <exception>
+# include <thread>
+# endif
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/level_eval.hpp
+Zero order forward and first order reverse mode using a team of threads.
+
+The level of a pre-decoded instruction is zero if none of its arguments
+is a variable computed by another instruction. Otherwise, it is one plus
+the maximum level of the instructions that compute its variable arguments.
+The instructions in one level do not depend on each other,
+so they can be evaluated by different threads.
+The threads wait for each other at the end of each level.
+
+Within a level, the instructions are divided into tasks and each thread
+takes the next task from a counter that is shared by the team;
+i.e., a thread that finishes its task early does more of the remaining work.
+A CSumOp operator with many variable arguments
+(e.g., the sum of the terms in a likelihood) is split into slices of
+its arguments that are evaluated by different threads.
+*/
+
+/// number of variable arguments in one slice of a split CSumOp
+static const size_t level_csum_slice = 1024;
+
+/// minimum number of instructions in one task
+static const size_t level_min_task = 64;
+
+/*!
+Create the levels using a specific type for the indices
+in the fast evaluation instructions.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+
+\param play
+On input, play->fast_vec() contains the fast evaluation instructions
+and play->level_start() is empty.
+Upon return, play->level_start(), play->level_split(), and
+play->level_inst() have been set.
+The comparison operators are not included in the levels because they
+have no results and are not evaluated by the level sweeps.
+*/
+template <class Base, class Addr>
+void level_setup_addr(player<Base>* play)
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* fast = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    size_t n_fast  = play->fast_vec().size() / sizeof(inst_t);
+    size_t num_var = play->num_var_rec();
+    //
+    const addr_t*       arg_vec     = play->GetArg();
+    pod_vector<addr_t>& level_start = play->level_start();
+    pod_vector<addr_t>& level_split = play->level_split();
+    pod_vector<addr_t>& level_inst  = play->level_inst();
+    CPPAD_ASSERT_UNKNOWN( level_start.size() == 0 );
+    //
+    // var_level[i_var]: one plus the level of the instruction that
+    // computes the variable (zero if it is not computed by an instruction)
+    pod_vector<size_t> var_level(num_var);
+    for(size_t i_var = 0; i_var < num_var; ++i_var)
+        var_level[i_var] = 0;
+    //
+    // inst_level[i]: level for the i-th instruction
+    // (not_evaluated if the instruction is not evaluated)
+    size_t not_evaluated = std::numeric_limits<size_t>::max();
+    pod_vector<size_t> inst_level(n_fast);
+    //
+    // inst_split[i]: is the i-th instruction a CSumOp that is split
+    pod_vector<bool> inst_split(n_fast);
+    //
+    // arguments for the current instruction
+    addr_t             tmp[3];
+    const addr_t*      op_arg;
+    pod_vector<size_t> var_arg;
+    //
+    size_t n_level = 0;
+    for(size_t i = 0; i < n_fast; ++i)
+    {   OpCode op     = OpCode( fast[i].op );
+        inst_split[i] = false;
+        inst_level[i] = not_evaluated;
+        if( NumRes(op) > 0 )
+        {   if( op == CExpOp || op == CSumOp )
+                op_arg = arg_vec + size_t( fast[i].arg[0] );
+            else
+            {   fast_arg(fast[i], tmp);
+                op_arg = tmp;
+            }
+            slot_var_arg(op, op_arg, var_arg);
+            size_t level = 0;
+            for(size_t k = 0; k < var_arg.size(); ++k)
+            {   size_t j_var = size_t( op_arg[ var_arg[k] ] );
+                level        = std::max(level, var_level[j_var]);
+            }
+            inst_level[i] = level;
+            var_level[ size_t( fast[i].i_var ) ] = level + 1;
+            n_level = std::max(n_level, level + 1);
+            //
+            if( op == CSumOp )
+            {   size_t n_var  = size_t( op_arg[2] ) - 5;
+                inst_split[i] = n_var >= 2 * level_csum_slice;
+            }
+        }
+    }
+    //
+    // count[2 * level + s] is the number of instructions in the level
+    // that are not split (s = 0) and that are split (s = 1)
+    pod_vector<size_t> count(2 * n_level);
+    for(size_t k = 0; k < 2 * n_level; ++k)
+        count[k] = 0;
+    for(size_t i = 0; i < n_fast; ++i)
+    {   if( inst_level[i] != not_evaluated )
+            ++count[ 2 * inst_level[i] + size_t( inst_split[i] ) ];
+    }
+    //
+    // level_start, level_split
+    level_start.resize(n_level + 1);
+    level_split.resize(n_level);
+    size_t start = 0;
+    for(size_t level = 0; level < n_level; ++level)
+    {   size_t split       = start + count[2 * level];
+        size_t next        = split + count[2 * level + 1];
+        level_start[level] = addr_t( start );
+        level_split[level] = addr_t( split );
+        count[2 * level]     = start;
+        count[2 * level + 1] = split;
+        start              = next;
+    }
+    level_start[n_level] = addr_t( start );
+    //
+    // level_inst (the order within each part of a level is the same as
+    // the order of the instructions)
+    level_inst.resize(start);
+    for(size_t i = 0; i < n_fast; ++i)
+    {   if( inst_level[i] != not_evaluated )
+        {   size_t k = 2 * inst_level[i] + size_t( inst_split[i] );
+            level_inst[ count[k]++ ] = addr_t(i);
+        }
+    }
+}
+/*!
+Create the information used by level_forward0 and level_reverse.
+
+\param play
+On input, play->level_start() is empty or contains the result of a previous
+call to level_setup.
+Upon return, if the recording can be evaluated using fast instructions,
+play->level_start(), play->level_split(), and play->level_inst()
+have been set.
+
+\return
+is true (false) if the recording can (cannot) be evaluated using
+the fast instructions; see fast_setup.
+*/
+template <class Base>
+bool level_setup(player<Base>* play)
+{   if( play->level_start().size() > 0 )
+        return true;
+    if( ! fast_setup(play) )
+        return false;
+    //
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        level_setup_addr<Base, unsigned short>(play);
+        break;
+
+        case play::unsigned_int_enum:
+        level_setup_addr<Base, unsigned int>(play);
+        break;
+
+        case play::size_t_enum:
+        level_setup_addr<Base, size_t>(play);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return true;
+}
+// ---------------------------------------------------------------------------
+# if CPPAD_USE_CPLUSPLUS_2011
+/*!
+Information shared by the threads that evaluate the levels;
+see level_worker.
+*/
+template <class Base, class Addr>
+struct level_thread_info {
+    /// is this zero order forward (true) or first order reverse (false)
+    bool                               forward;
+    /// number of threads in the team
+    size_t                             n_thread;
+    /// number of variables in the recording
+    size_t                             num_var;
+    /// number of levels
+    size_t                             n_level;
+    /// the fast evaluation instructions
+    const play::fast_inst<Base, Addr>* inst;
+    /// see player::level_start(), level_split(), and level_inst()
+    const addr_t*                      level_start;
+    const addr_t*                      level_split;
+    const addr_t*                      level_inst;
+    /// split_begin[level] is the index of the first split CSumOp in the level
+    /// (the split CSumOp operators are numbered in level order)
+    const size_t*                      split_begin;
+    /// slice_begin[k] is the index of the first slice for the k-th
+    /// split CSumOp and slice_begin[k+1] - slice_begin[k] is its
+    /// number of slices
+    const size_t*                      slice_begin;
+    /// sum for each slice (forward mode only)
+    Base*                              slice_sum;
+    /// information for evaluating the instructions (forward mode)
+    play::fast_forward0_info<Base>     forward_info;
+    /// information for evaluating the instructions (reverse mode);
+    /// reverse_info.partial[ thread * num_var + i_var ] is the partial
+    /// computed by thread for the variable with index i_var.
+    play::fast_reverse_info<Base>      reverse_info;
+    /// next task in the current level
+    std::atomic<size_t>                next_task;
+    /// number of threads waiting at the barrier
+    std::atomic<size_t>                n_wait;
+    /// number of times all the threads have passed the barrier
+    std::atomic<size_t>                n_pass;
+};
+/*!
+Wait for all the threads in the team to reach this point.
+
+The last thread to arrive sets next_task to zero for the next level.
+*/
+template <class Base, class Addr>
+void level_barrier(level_thread_info<Base, Addr>& info)
+{   size_t n_pass = info.n_pass.load();
+    if( info.n_wait.fetch_add(1) + 1 == info.n_thread )
+    {   info.n_wait.store(0);
+        info.next_task.store(0);
+        info.n_pass.fetch_add(1);
+    }
+    else
+    {   while( info.n_pass.load() == n_pass )
+            std::this_thread::yield();
+    }
+}
+/*!
+Number of tasks for a level.
+
+\param info
+is the information shared by the team.
+
+\param level
+is the level.
+
+\param n_chunk [out]
+is the number of tasks that evaluate instructions that are not split.
+The other tasks are slices of split CSumOp operators.
+
+\param chunk [out]
+is the number of instructions in each of the first n_chunk tasks
+(except for the last of these tasks which may have fewer).
+
+\return
+is the total number of tasks for this level.
+*/
+template <class Base, class Addr>
+size_t level_n_task(
+    const level_thread_info<Base, Addr>& info    ,
+    size_t                               level   ,
+    size_t&                              n_chunk ,
+    size_t&                              chunk   )
+{   size_t n_inst = size_t( info.level_split[level] )
+                  - size_t( info.level_start[level] );
+    size_t n_part = 4 * info.n_thread;
+    chunk         = std::max(level_min_task, (n_inst + n_part - 1) / n_part);
+    n_chunk       = (n_inst + chunk - 1) / chunk;
+    size_t n_slice = info.slice_begin[ info.split_begin[level + 1] ]
+                   - info.slice_begin[ info.split_begin[level] ];
+    return n_chunk + n_slice;
+}
+/*!
+Sum of the partials computed by all the threads for one variable.
+*/
+template <class Base, class Addr>
+Base level_partial(const level_thread_info<Base, Addr>& info, size_t i_var)
+{   const Base* partial = info.reverse_info.partial;
+    Base sum = partial[i_var];
+    for(size_t thread = 1; thread < info.n_thread; ++thread)
+        sum += partial[ thread * info.num_var + i_var ];
+    return sum;
+}
+/*!
+Evaluate one task for a level.
+
+\param info
+is the information shared by the team.
+
+\param level
+is the level.
+
+\param task
+is the index of the task within this level.
+
+\param forward_info
+is the forward mode information for this thread.
+
+\param reverse_info
+is the reverse mode information for this thread.
+*/
+template <class Base, class Addr>
+void level_task(
+    level_thread_info<Base, Addr>&  info         ,
+    size_t                          level        ,
+    size_t                          task         ,
+    play::fast_forward0_info<Base>& forward_info ,
+    play::fast_reverse_info<Base>&  reverse_info )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* inst = info.inst;
+    size_t n_chunk, chunk;
+    level_n_task(info, level, n_chunk, chunk);
+    //
+    if( task < n_chunk )
+    {   // instructions that are not split
+        size_t begin = size_t( info.level_start[level] ) + task * chunk;
+        size_t end   = std::min(
+            begin + chunk, size_t( info.level_split[level] )
+        );
+        if( info.forward )
+        {   for(size_t k = begin; k < end; ++k)
+            {   const inst_t& inst_k = inst[ info.level_inst[k] ];
+                inst_k.forward0(inst_k, forward_info);
+            }
+        }
+        else
+        {   // reverse mode uses the instructions in the opposite order
+            size_t k = end;
+            while( k-- > begin )
+            {   const inst_t& inst_k = inst[ info.level_inst[k] ];
+                size_t i_var = size_t( inst_k.i_var );
+                reverse_info.partial[i_var] = level_partial(info, i_var);
+                inst_k.reverse(inst_k, reverse_info);
+            }
+        }
+        return;
+    }
+    // slice of a split CSumOp
+    size_t slice = info.slice_begin[ info.split_begin[level] ]
+                 + task - n_chunk;
+    const size_t* begin = info.slice_begin + info.split_begin[level];
+    const size_t* end   = info.slice_begin + info.split_begin[level + 1];
+    size_t k_split = size_t( std::upper_bound(begin, end, slice) - begin ) - 1;
+    size_t k_slice = slice - begin[k_split];
+    //
+    const inst_t& inst_k = inst[
+        info.level_inst[ size_t( info.level_split[level] ) + k_split ]
+    ];
+    const addr_t* arg    = forward_info.arg_vec + size_t( inst_k.arg[0] );
+    size_t        i_var  = size_t( inst_k.i_var );
+    size_t        i_sub  = size_t( arg[1] );
+    size_t        i_beg  = 5 + k_slice * level_csum_slice;
+    size_t        i_end  = std::min(
+        i_beg + level_csum_slice, size_t( arg[2] )
+    );
+    if( info.forward )
+    {   const Base* taylor = forward_info.taylor;
+        size_t      J      = forward_info.cap_order;
+        Base sum = Base(0.0);
+        for(size_t i = i_beg; i < i_end; ++i)
+        {   if( i < i_sub )
+                sum += taylor[ size_t( arg[i] ) * J ];
+            else
+                sum -= taylor[ size_t( arg[i] ) * J ];
+        }
+        info.slice_sum[slice] = sum;
+    }
+    else
+    {   Base  pz      = level_partial(info, i_var);
+        Base* partial = reverse_info.partial;
+        for(size_t i = i_beg; i < i_end; ++i)
+        {   if( i < i_sub )
+                partial[ size_t( arg[i] ) ] += pz;
+            else
+                partial[ size_t( arg[i] ) ] -= pz;
+        }
+    }
+}
+/*!
+Complete zero order forward mode for the split CSumOp operators in a level.
+
+\param info
+is the information shared by the team.
+The slice sums for this level have been computed.
+
+\param level
+is the level.
+*/
+template <class Base, class Addr>
+void level_csum_forward0(level_thread_info<Base, Addr>& info, size_t level)
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const Base* parameter = info.forward_info.parameter;
+    Base*       taylor    = info.forward_info.taylor;
+    size_t      J         = info.forward_info.cap_order;
+    //
+    size_t k_begin = info.split_begin[level];
+    size_t k_end   = info.split_begin[level + 1];
+    for(size_t k_split = k_begin; k_split < k_end; ++k_split)
+    {   size_t k = size_t( info.level_split[level] ) + k_split - k_begin;
+        const inst_t& inst_k = info.inst[ info.level_inst[k] ];
+        const addr_t* arg    = info.forward_info.arg_vec
+                             + size_t( inst_k.arg[0] );
+        Base z = parameter[ arg[0] ];
+        for(size_t i = size_t(arg[2]); i < size_t(arg[3]); ++i)
+            z += parameter[ arg[i] ];
+        for(size_t i = size_t(arg[3]); i < size_t(arg[4]); ++i)
+            z -= parameter[ arg[i] ];
+        size_t s_begin = info.slice_begin[k_split];
+        size_t s_end   = info.slice_begin[k_split + 1];
+        for(size_t s = s_begin; s < s_end; ++s)
+            z += info.slice_sum[s];
+        taylor[ size_t( inst_k.i_var ) * J ] = z;
+    }
+}
+/*!
+Evaluate the levels for one thread in the team.
+
+\param thread
+is the index of this thread in the team.
+
+\param void_info
+is a pointer to the corresponding level_thread_info<Base, Addr> object.
+
+\par Exceptions
+The threads wait for each other at the end of each level.
+If evaluating an instruction throws an exception, this thread stops
+evaluating instructions but continues to wait with the other threads.
+The exception is thrown again when this thread is done.
+*/
+template <class Base, class Addr>
+void level_worker(size_t thread, void* void_info)
+{   level_thread_info<Base, Addr>& info =
+        *static_cast< level_thread_info<Base, Addr>* >(void_info);
+    size_t n_level = info.n_level;
+    //
+    // information for the instructions evaluated by this thread
+    play::fast_forward0_info<Base> forward_info = info.forward_info;
+    play::fast_reverse_info<Base>  reverse_info = info.reverse_info;
+    if( ! info.forward )
+    {   // the partials for thread zero are initialized by the caller
+        reverse_info.partial += thread * info.num_var;
+        if( thread > 0 )
+        {   for(size_t i_var = 0; i_var < info.num_var; ++i_var)
+                reverse_info.partial[i_var] = Base(0.0);
+        }
+        level_barrier(info);
+    }
+    //
+    // exception thrown while evaluating instructions (if any)
+    std::exception_ptr error;
+    //
+    // forward mode uses the levels in increasing order
+    // and reverse mode uses them in decreasing order
+    size_t n_chunk, chunk;
+    size_t k = 0;
+    while( k < n_level )
+    {   size_t level  = info.forward ? k : n_level - k - 1;
+        size_t n_task = level_n_task(info, level, n_chunk, chunk);
+        if( n_task == 1 )
+        {   // consecutive levels that have one task are evaluated
+            // by thread zero and the other threads wait
+            size_t k_end = k + 1;
+            while( k_end < n_level )
+            {   size_t level_end = info.forward ? k_end : n_level - k_end - 1;
+                if( level_n_task(info, level_end, n_chunk, chunk) != 1 )
+                    break;
+                ++k_end;
+            }
+            if( thread == 0 && ! error )
+            {   try
+                {   for(size_t j = k; j < k_end; ++j)
+                    {   size_t level_j = info.forward ? j : n_level - j - 1;
+                        level_task(
+                            info, level_j, 0, forward_info, reverse_info
+                        );
+                    }
+                }
+                catch(...)
+                {   error = std::current_exception(); }
+            }
+            k = k_end;
+        }
+        else
+        {   size_t task = info.next_task.fetch_add(1);
+            while( task < n_task )
+            {   if( ! error )
+                {   try
+                    {   level_task(
+                            info, level, task, forward_info, reverse_info
+                        );
+                    }
+                    catch(...)
+                    {   error = std::current_exception(); }
+                }
+                task = info.next_task.fetch_add(1);
+            }
+            bool split = info.split_begin[level] < info.split_begin[level+1];
+            if( info.forward && split )
+            {   level_barrier(info);
+                if( thread == 0 && ! error )
+                {   try
+                    {   level_csum_forward0(info, level); }
+                    catch(...)
+                    {   error = std::current_exception(); }
+                }
+            }
+            ++k;
+        }
+        level_barrier(info);
+    }
+    if( error )
+        std::rethrow_exception(error);
+}
+/*!
+Evaluate the levels using a team of threads and a specific type for
+the indices in the fast evaluation instructions.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+
+\param info
+On input, info.forward, info.n_thread, info.forward_info, and
+info.reverse_info have been set.
+The other fields are set by this routine.
+*/
+template <class Base, class Addr>
+void level_run_addr(
+    const player<Base>*             play ,
+    level_thread_info<Base, Addr>&  info )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* inst = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    const addr_t* arg_vec     = play->GetArg();
+    const addr_t* level_start = play->level_start().data();
+    const addr_t* level_split = play->level_split().data();
+    const addr_t* level_inst  = play->level_inst().data();
+    size_t        n_level     = play->level_start().size() - 1;
+    //
+    // split_begin
+    pod_vector<size_t> split_begin(n_level + 1);
+    size_t n_split = 0;
+    for(size_t level = 0; level < n_level; ++level)
+    {   split_begin[level] = n_split;
+        n_split += size_t( level_start[level + 1] )
+                 - size_t( level_split[level] );
+    }
+    split_begin[n_level] = n_split;
+    //
+    // slice_begin
+    pod_vector<size_t> slice_begin(n_split + 1);
+    size_t n_slice = 0;
+    size_t k_split = 0;
+    for(size_t level = 0; level < n_level; ++level)
+    {   size_t k_begin = size_t( level_split[level] );
+        size_t k_end   = size_t( level_start[level + 1] );
+        for(size_t k = k_begin; k < k_end; ++k)
+        {   const addr_t* arg = arg_vec
+                              + size_t( inst[ level_inst[k] ].arg[0] );
+            size_t n_var = size_t( arg[2] ) - 5;
+            slice_begin[k_split++] = n_slice;
+            n_slice += (n_var + level_csum_slice - 1) / level_csum_slice;
+        }
+    }
+    slice_begin[n_split] = n_slice;
+    //
+    // slice_sum
+    pod_vector_maybe<Base> slice_sum;
+    if( info.forward )
+        slice_sum.resize(n_slice);
+    //
+    info.num_var     = play->num_var_rec();
+    info.n_level     = n_level;
+    info.inst        = inst;
+    info.level_start = level_start;
+    info.level_split = level_split;
+    info.level_inst  = level_inst;
+    info.split_begin = split_begin.data();
+    info.slice_begin = slice_begin.data();
+    info.slice_sum   = slice_sum.data();
+    info.next_task.store(0);
+    info.n_wait.store(0);
+    info.n_pass.store(0);
+    //
+    color_thread_run<Base>(info.n_thread, level_worker<Base, Addr>, &info);
+}
+/*!
+Run level_run_addr with the type used by the fast evaluation instructions.
+*/
+template <class Base>
+void level_run(
+    const player<Base>*             play         ,
+    bool                            forward      ,
+    size_t                          n_thread     ,
+    play::fast_forward0_info<Base>& forward_info ,
+    play::fast_reverse_info<Base>&  reverse_info )
+{   switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        {   level_thread_info<Base, unsigned short> info;
+            info.forward      = forward;
+            info.n_thread     = n_thread;
+            info.forward_info = forward_info;
+            info.reverse_info = reverse_info;
+            level_run_addr(play, info);
+        }
+        break;
+
+        case play::unsigned_int_enum:
+        {   level_thread_info<Base, unsigned int> info;
+            info.forward      = forward;
+            info.n_thread     = n_thread;
+            info.forward_info = forward_info;
+            info.reverse_info = reverse_info;
+            level_run_addr(play, info);
+        }
+        break;
+
+        case play::size_t_enum:
+        {   level_thread_info<Base, size_t> info;
+            info.forward      = forward;
+            info.n_thread     = n_thread;
+            info.forward_info = forward_info;
+            info.reverse_info = reverse_info;
+            level_run_addr(play, info);
+        }
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+}
+/*!
+Zero order forward mode using a team of threads.
+
+\param play
+is the player for this recording and level_setup(play) has returned true.
+
+\param n_thread
+is the number of threads in the team; see color_thread_run.
+
+\param J
+is the number of columns in the taylor matrix.
+
+\param taylor
+\b Input: For i = 1, ... , n, taylor[ i * J + 0 ] is the value of the
+i-th variable (an independent variable).
+\n
+\b Output: For the variables computed by the instructions,
+taylor[ i * J + 0 ] is the value of the i-th variable.
+The comparison operators are not evaluated.
+*/
+template <class Base>
+void level_forward0(
+    const player<Base>* play     ,
+    size_t              n_thread ,
+    size_t              J        ,
+    Base*               taylor   )
+{   CPPAD_ASSERT_UNKNOWN( play->level_start().size() > 0 );
+    //
+    play::fast_forward0_info<Base> forward_info;
+    forward_info.arg_vec                 = play->GetArg();
+    forward_info.num_par                 = play->num_par_rec();
+    forward_info.parameter               = play->GetPar();
+    forward_info.cap_order               = J;
+    forward_info.taylor                  = taylor;
+    forward_info.compare_change_count    = 0;
+    forward_info.compare_change_number   = 0;
+    forward_info.compare_change_op_index = 0;
+    //
+    play::fast_reverse_info<Base> reverse_info;
+    reverse_info.arg_vec    = CPPAD_NULL;
+    reverse_info.num_par    = 0;
+    reverse_info.parameter  = CPPAD_NULL;
+    reverse_info.d          = 0;
+    reverse_info.cap_order  = 0;
+    reverse_info.taylor     = CPPAD_NULL;
+    reverse_info.nc_partial = 0;
+    reverse_info.partial    = CPPAD_NULL;
+    //
+    bool forward = true;
+    level_run(play, forward, n_thread, forward_info, reverse_info);
+}
+/*!
+First order reverse mode using a team of threads.
+
+\param play
+is the player for this recording and level_setup(play) has returned true.
+
+\param n_thread
+is the number of threads in the team; see color_thread_run.
+
+\param J
+is the number of columns in the taylor matrix.
+
+\param taylor
+For all i, taylor[ i * J + 0 ] is the value of the i-th variable
+computed by a zero order forward sweep that did not skip any operators.
+
+\param partial
+is a vector of length n_thread * num_var where num_var is the number
+of variables in the recording.
+\n
+\b Input: For i_var < num_var, partial[i_var] is the partial derivative
+of the range weighting function w.r.t. the i_var-th variable
+(it is zero for variables that are not dependent variables).
+The other elements of partial do not matter.
+\n
+\b Output: For each independent variable index i_var, the sum of
+partial[ thread * num_var + i_var ] for thread = 0 , ... , n_thread-1
+is the partial of the weighting function w.r.t. the independent variable.
+*/
+template <class Base>
+void level_reverse(
+    const player<Base>* play     ,
+    size_t              n_thread ,
+    size_t              J        ,
+    const Base*         taylor   ,
+    Base*               partial  )
+{   CPPAD_ASSERT_UNKNOWN( play->level_start().size() > 0 );
+    //
+    play::fast_forward0_info<Base> forward_info;
+    forward_info.arg_vec                 = play->GetArg();
+    forward_info.num_par                 = play->num_par_rec();
+    forward_info.parameter               = play->GetPar();
+    forward_info.cap_order               = J;
+    forward_info.taylor                  = CPPAD_NULL;
+    forward_info.compare_change_count    = 0;
+    forward_info.compare_change_number   = 0;
+    forward_info.compare_change_op_index = 0;
+    //
+    play::fast_reverse_info<Base> reverse_info;
+    reverse_info.arg_vec    = play->GetArg();
+    reverse_info.num_par    = play->num_par_rec();
+    reverse_info.parameter  = play->GetPar();
+    reverse_info.d          = 0;
+    reverse_info.cap_order  = J;
+    reverse_info.taylor     = taylor;
+    reverse_info.nc_partial = 1;
+    reverse_info.partial    = partial;
+    //
+    bool forward = false;
+    level_run(play, forward, n_thread, forward_info, reverse_info);
+}
+# endif // CPPAD_USE_CPLUSPLUS_2011
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
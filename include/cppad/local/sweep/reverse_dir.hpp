@@ -0,0 +1,790 @@
+# ifndef CPPAD_LOCAL_SWEEP_REVERSE_DIR_HPP
+# define CPPAD_LOCAL_SWEEP_REVERSE_DIR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/local/sweep/call_atomic.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/reverse_dir.hpp
+Compute derivatives of Taylor coefficients for multiple weight directions.
+*/
+
+/*!
+Compute derivative of arbitrary order forward mode Taylor coefficients
+for r different weightings using one reverse sweep.
+
+This is the same as sweep::reverse except that there are r
+partial derivative matrices.
+Each operator is decoded once and then the corresponding reverse mode
+operator routine, for example reverse_mulvv_op, is called for each direction
+with nc_partial equal to r * K and the Partial pointer shifted by ell * K.
+
+\tparam Base
+this operation sequence was recorded using AD<Base>
+and computations by this routine are done using type Base.
+
+\param d
+is the highest order Taylor coefficients that
+we are computing the derivative of.
+
+\param n
+is the number of independent variables on the tape.
+
+\param numvar
+is the total number of variables on the tape; i.e.,
+play->num_var_rec().
+
+\param play
+is a recording of the operations corresponding to the function
+\f$ F : {\bf R}^n \rightarrow {\bf R}^m \f$.
+
+\param J
+Is the number of columns in the coefficient matrix Taylor.
+This must be greater than or equal d + 1.
+
+\param Taylor
+For i = 1 , ... , numvar, and for k = 0 , ... , d,
+ Taylor [ i * J + k ]
+is the k-th order Taylor coefficient corresponding to
+variable with index i on the tape.
+
+\param r
+is the number of weight directions.
+This must be greater than or equal one.
+
+\param K
+Is the number of partials for each variable and direction.
+It must be greater than or equal d + 1.
+
+\param Partial
+has size numvar * r * K.
+For i = 0 , ... , numvar-1, ell = 0 , ... , r-1, k = 0 , ... , d,
+<code>Partial [ (i * r + ell) * K + k ]</code>
+has the same meaning as <code>Partial [ i * K + k ]</code>
+in sweep::reverse for the direction with index ell.
+\n
+\n
+\b Input:
+The rows corresponding to the dependent variables are inputs
+and specify the weights for each direction.
+\n
+\n
+\b Output:
+For j = 1 , ... , n, ell = 0 , ... , r-1, and k = 0 , ... , d,
+<code>Partial [ (j * r + ell) * K + k ]</code>
+is the partial derivative of \f$ W( u ) \f$,
+for the direction with index ell,
+with respect to \f$ u_j^{(k)} \f$.
+
+\param cskip_op
+Is a vector with size play->num_op_rec().
+If cskip_op[i] is true, the operator index i in the recording
+does not affect any of the dependent variable (given the value
+of the independent variables).
+
+\param load_op2var
+is a vector with size play->num_var_load_rec().
+It contains the variable index corresponding to each load instruction.
+
+\tparam Iterator
+This is either player::const_iteratoror player::const_subgraph_iterator.
+
+\param play_itr
+On input this is either play->end(), for the entire graph,
+or play->end(subgraph), for a subgraph; see sweep::reverse.
+
+\param not_used_rec_base
+Specifies RecBase for this call.
+*/
+template <class Addr, class Base, class Iterator, class RecBase>
+void reverse_dir(
+    size_t                      d,
+    size_t                      n,
+    size_t                      numvar,
+    const local::player<Base>*  play,
+    size_t                      J,
+    const Base*                 Taylor,
+    size_t                      r,
+    size_t                      K,
+    Base*                       Partial,
+    const bool*                 cskip_op,
+    const pod_vector<Addr>&     load_op2var,
+    Iterator&                   play_itr,
+    const RecBase&              not_used_rec_base
+)
+{
+    // check numvar argument
+    CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+    CPPAD_ASSERT_UNKNOWN( numvar > 0 );
+    CPPAD_ASSERT_UNKNOWN( r > 0 );
+
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+
+    // number of partials for each variable (all directions)
+    const size_t rK = r * K;
+
+    // work space used by AFunOp.
+    const size_t         atom_k  = d;   // highest order we are differentiating
+    const size_t         atom_k1 = d+1; // number orders for this calculation
+    vector<Base>         atom_par_x;    // argument parameter values
+    vector<ad_type_enum> atom_type_x;   // argument type
+    vector<size_t>       atom_ix;       // variable indices for argument vector
+    vector<Base>         atom_tx;       // argument vector Taylor coefficients
+    vector<Base>         atom_ty;       // result vector Taylor coefficients
+    vector<Base>         atom_px;       // partials w.r.t argument vector
+    vector<Base>         atom_py;       // partials w.r.t. result vector
+    vector<Base>         atom_py_all;   // atom_py for all the directions
+    //
+    // information defined by atomic forward
+    size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
+    enum_atom_state atom_state = end_atom; // proper initialization
+
+    // temporary indices
+    size_t i, j, k;
+
+    // Initialize
+    OpCode        op;
+    const Addr*   arg;
+    size_t        i_var;
+    play_itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == EndOp );
+    while(op != BeginOp )
+    {   bool flag; // temporary for use in switch cases
+        //
+        // next op
+        (--play_itr).op_info(op, arg, i_var);
+
+        // check if we are skipping this operation
+        size_t i_op = play_itr.op_index();
+        while( cskip_op[i_op] )
+        {   switch(op)
+            {
+                case AFunOp:
+                {   // get information for this atomic function call
+                    CPPAD_ASSERT_UNKNOWN( atom_state == end_atom );
+                    play::atom_op_info<Base>(
+                        op, arg, atom_index, atom_old, atom_m, atom_n
+                    );
+                    //
+                    // skip to the first AFunOp
+                    for(i = 0; i < atom_m + atom_n + 1; ++i)
+                        --play_itr;
+                    play_itr.op_info(op, arg, i_var);
+                    CPPAD_ASSERT_UNKNOWN( op == AFunOp );
+                }
+                break;
+
+                default:
+                break;
+            }
+            (--play_itr).op_info(op, arg, i_var);
+            i_op = play_itr.op_index();
+        }
+        switch( op )
+        {
+            case AbsOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_abs_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case AcosOp:
+            // sqrt(1 - x * x), acos(x)
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_acos_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            // sqrt(x * x - 1), acosh(x)
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_acosh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+# endif
+            // --------------------------------------------------
+
+            case AddvvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_addvv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case AddpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_addpv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case AsinOp:
+            // sqrt(1 - x * x), asin(x)
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_asin_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AsinhOp:
+            // sqrt(1 + x * x), asinh(x)
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_asinh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+# endif
+            // --------------------------------------------------
+
+            case AtanOp:
+            // 1 + x * x, atan(x)
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_atan_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AtanhOp:
+            // 1 - x * x, atanh(x)
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_atanh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+# endif
+            // -------------------------------------------------
+
+            case BeginOp:
+            CPPAD_ASSERT_NARG_NRES(op, 1, 1);
+            CPPAD_ASSERT_UNKNOWN( i_op == 0 );
+            break;
+            // --------------------------------------------------
+
+            case CSkipOp:
+            // CSkipOp has a zero order forward action.
+            play_itr.correct_after_decrement(arg);
+            break;
+            // -------------------------------------------------
+
+            case CSumOp:
+            play_itr.correct_after_decrement(arg);
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_csum_op(
+                    d, i_var, arg, rK, Partial + ell * K
+                );
+            // end of a cumulative summation
+            break;
+            // -------------------------------------------------
+
+            case CExpOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_cond_op(
+                    d,
+                    i_var,
+                    arg,
+                    num_par,
+                    parameter,
+                    J,
+                    Taylor,
+                    rK,
+                    Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case CosOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_cos_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case CoshOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_cosh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case DisOp:
+            // Derivative of discrete operation is zero so no
+            // contribution passes through this operation.
+            break;
+            // --------------------------------------------------
+
+            case DivvvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_divvv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case DivpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_divpv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case DivvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_divvp_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+            case EndOp:
+            CPPAD_ASSERT_UNKNOWN(
+                i_op == play->num_op_rec() - 1
+            );
+            break;
+
+            // --------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case ErfOp:
+            case ErfcOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_erf_op(
+                    op, d, i_var, arg, parameter,
+                    J, Taylor, rK, Partial + ell * K
+                );
+            break;
+# endif
+            // --------------------------------------------------
+
+            case ExpOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_exp_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Expm1Op:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_expm1_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+# endif
+            // --------------------------------------------------
+
+            case InvOp:
+            break;
+            // --------------------------------------------------
+
+            case LdpOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_load_op(
+                    op, d, i_var, arg,
+                    J, Taylor, rK, Partial + ell * K, load_op2var.data()
+                );
+            break;
+            // -------------------------------------------------
+
+            case LdvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_load_op(
+                    op, d, i_var, arg,
+                    J, Taylor, rK, Partial + ell * K, load_op2var.data()
+                );
+            break;
+            // --------------------------------------------------
+
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            break;
+            // -------------------------------------------------
+
+            case LogOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_log_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Log1pOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_log1p_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+# endif
+            // --------------------------------------------------
+
+            case MulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_mulpv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case MulvvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_mulvv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case ParOp:
+            break;
+            // --------------------------------------------------
+
+            case PowvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_powvp_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+            case PowpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_powpv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+            case PowvvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_powvv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case PriOp:
+            // no result so nothing to do
+            break;
+            // --------------------------------------------------
+
+            case SignOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_sign_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+            case SinOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_sin_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+            case SinhOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_sinh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case SqrtOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_sqrt_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case StppOp:
+            break;
+            // --------------------------------------------------
+
+            case StpvOp:
+            break;
+            // -------------------------------------------------
+
+            case StvpOp:
+            break;
+            // -------------------------------------------------
+
+            case StvvOp:
+            break;
+            // --------------------------------------------------
+
+            case SubvvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_subvv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case SubpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_subpv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case SubvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_subvp_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+            case TanOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_tan_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // -------------------------------------------------
+
+            case TanhOp:
+            CPPAD_ASSERT_UNKNOWN( i_var < numvar );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_tanh_op(
+                    d, i_var, size_t(arg[0]), J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case AFunOp:
+            // start or end an atomic function call
+            flag = atom_state == end_atom;
+            play::atom_op_info<RecBase>(
+                op, arg, atom_index, atom_old, atom_m, atom_n
+            );
+            if( flag )
+            {   atom_state = ret_atom;
+                atom_i     = atom_m;
+                atom_j     = atom_n;
+                //
+                atom_ix.resize(atom_n);
+                atom_par_x.resize(atom_n);
+                atom_type_x.resize(atom_n);
+                atom_tx.resize(atom_n * atom_k1);
+                atom_px.resize(atom_n * atom_k1);
+                atom_ty.resize(atom_m * atom_k1);
+                atom_py.resize(atom_m * atom_k1);
+                atom_py_all.resize(r * atom_m * atom_k1);
+            }
+            else
+            {   CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+                CPPAD_ASSERT_UNKNOWN( atom_j == 0  );
+                atom_state = end_atom;
+                //
+                // call atomic function once for each direction
+                for(size_t ell = 0; ell < r; ell++)
+                {   for(i = 0; i < atom_m * atom_k1; i++)
+                        atom_py[i] = atom_py_all[ell * atom_m * atom_k1 + i];
+                    call_atomic_reverse<Base, RecBase>(
+                        atom_par_x,
+                        atom_type_x,
+                        atom_k,
+                        atom_index,
+                        atom_old,
+                        atom_tx,
+                        atom_ty,
+                        atom_px,
+                        atom_py
+                    );
+                    for(j = 0; j < atom_n; j++) if( atom_ix[j] > 0 )
+                    {   Base* px = Partial + (atom_ix[j] * r + ell) * K;
+                        for(k = 0; k < atom_k1; k++)
+                            px[k] += atom_px[j * atom_k1 + k];
+                    }
+                }
+            }
+            break;
+
+            case FunapOp:
+            // parameter argument in an atomic operation sequence
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            --atom_j;
+            atom_ix[atom_j]               = 0;
+            if( play->dyn_par_is()[ arg[0] ] )
+                atom_type_x[atom_j]       = dynamic_enum;
+            else
+                atom_type_x[atom_j]       = constant_enum;
+            atom_par_x[atom_j]            = parameter[ arg[0] ];
+            atom_tx[atom_j * atom_k1 + 0] = parameter[ arg[0] ];
+            for(k = 1; k < atom_k1; k++)
+                atom_tx[atom_j * atom_k1 + k] = Base(0.);
+            //
+            if( atom_j == 0 )
+                atom_state = start_atom;
+            break;
+
+            case FunavOp:
+            // variable argument in an atomic operation sequence
+            CPPAD_ASSERT_UNKNOWN( NumArg(op) == 1 );
+            CPPAD_ASSERT_UNKNOWN( atom_state == arg_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
+            CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
+            //
+            --atom_j;
+            atom_ix[atom_j]     = size_t( arg[0] );
+            atom_type_x[atom_j] = variable_enum;
+            atom_par_x[atom_j] = CppAD::numeric_limits<Base>::quiet_NaN();
+            for(k = 0; k < atom_k1; k++)
+                atom_tx[atom_j*atom_k1 + k] =
+                    Taylor[ size_t(arg[0]) * J + k];
+            //
+            if( atom_j == 0 )
+                atom_state = start_atom;
+            break;
+
+            case FunrpOp:
+            // parameter result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 1, 0);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i <= atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
+            //
+            --atom_i;
+            for(k = 0; k < atom_k1; k++)
+            {   for(size_t ell = 0; ell < r; ell++)
+                    atom_py_all[(ell * atom_m + atom_i) * atom_k1 + k] =
+                        Base(0.);
+                atom_ty[atom_i * atom_k1 + k] = Base(0.);
+            }
+            atom_ty[atom_i * atom_k1 + 0] = parameter[ arg[0] ];
+            //
+            if( atom_i == 0 )
+                atom_state = arg_atom;
+            break;
+
+            case FunrvOp:
+            // variable result for a atomic function
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            CPPAD_ASSERT_UNKNOWN( atom_state == ret_atom );
+            CPPAD_ASSERT_UNKNOWN( atom_i <= atom_m );
+            CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
+            //
+            --atom_i;
+            for(k = 0; k < atom_k1; k++)
+            {   for(size_t ell = 0; ell < r; ell++)
+                    atom_py_all[(ell * atom_m + atom_i) * atom_k1 + k] =
+                        Partial[(i_var * r + ell) * K + k];
+                atom_ty[atom_i * atom_k1 + k] =
+                        Taylor[i_var * J + k];
+            }
+            if( atom_i == 0 )
+                atom_state = arg_atom;
+            break;
+            // ------------------------------------------------------------
+
+            case ZmulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_zmulpv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case ZmulvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_zmulvp_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            case ZmulvvOp:
+            for(size_t ell = 0; ell < r; ell++)
+                reverse_zmulvv_op(
+                    d, i_var, arg, parameter, J, Taylor, rK, Partial + ell * K
+                );
+            break;
+            // --------------------------------------------------
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+        }
+    }
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
+
@@ -0,0 +1,397 @@
+# ifndef CPPAD_LOCAL_SWEEP_SLOT_EVAL_HPP
+# define CPPAD_LOCAL_SWEEP_SLOT_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/sweep/fast_eval.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/slot_eval.hpp
+Zero order forward mode that only stores the values of the variables
+that may still be used.
+
+The pre-decoded instructions created by fast_setup are copied and the
+variable indices in the copy are replaced by slot indices.
+A slot is re-used as soon as the last operator that uses the
+corresponding variable has been evaluated,
+so the number of slots is usually much smaller than the number of variables.
+The independent and dependent variables are never re-used.
+*/
+
+/// maximum number of results for an operator; i.e., NumRes(ErfOp)
+static const size_t slot_max_res = 5;
+
+/*!
+Determine which arguments of a pre-decoded instruction are variables.
+
+\param op
+is the operator for this instruction
+(it is not a comparison operator).
+
+\param arg
+is the arguments for this instruction; i.e.,
+inst.arg for operators with at most three arguments and
+arg_vec + inst.arg[0] for CExpOp and CSumOp.
+
+\param var_arg
+Upon return, var_arg[k] is the index in arg of the k-th argument that is
+a variable.
+*/
+template <class Addr>
+void slot_var_arg(
+    OpCode              op      ,
+    const Addr*         arg     ,
+    pod_vector<size_t>& var_arg )
+{   var_arg.resize(0);
+    switch( op )
+    {
+        case CExpOp:
+        for(size_t k = 0; k < 4; ++k)
+        {   if( size_t(arg[1]) & (size_t(1) << k) )
+                var_arg.push_back(2 + k);
+        }
+        break;
+
+        case CSumOp:
+        for(size_t k = 5; k < size_t(arg[2]); ++k)
+            var_arg.push_back(k);
+        break;
+
+        default:
+        {   pod_vector<bool> is_variable;
+            arg_is_variable(op, arg, is_variable);
+            for(size_t k = 0; k < is_variable.size(); ++k)
+            {   if( is_variable[k] )
+                    var_arg.push_back(k);
+            }
+        }
+    }
+}
+
+/*!
+Zero order forward mode for CSumOp using slot indices.
+
+This is the same as forward_csum_op with p = q = 0, except that the
+argument slots may be greater than the result slot.
+*/
+template <class Base, class Addr>
+void slot_forward0_csum(
+    const play::fast_inst<Base, Addr>& inst ,
+    play::fast_forward0_info<Base>&    info )
+{   const addr_t* arg       = info.arg_vec + size_t( inst.arg[0] );
+    const Base*   parameter = info.parameter;
+    const Base*   taylor    = info.taylor;
+    size_t        J         = info.cap_order;
+    //
+    Base z = parameter[ arg[0] ];
+    for(size_t i = size_t(arg[2]); i < size_t(arg[3]); ++i)
+        z += parameter[ arg[i] ];
+    for(size_t i = size_t(arg[3]); i < size_t(arg[4]); ++i)
+        z -= parameter[ arg[i] ];
+    for(size_t i = 5; i < size_t(arg[1]); ++i)
+        z += taylor[ size_t(arg[i]) * J ];
+    for(size_t i = size_t(arg[1]); i < size_t(arg[2]); ++i)
+        z -= taylor[ size_t(arg[i]) * J ];
+    info.taylor[ size_t(inst.i_var) * J ] = z;
+}
+// ---------------------------------------------------------------------------
+/*!
+Create the slot evaluation instructions using a specific
+type for the indices in the instructions.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+
+\param play
+On input, play->fast_vec() contains the fast evaluation instructions
+and play->slot_vec() is empty.
+Upon return, play->slot_vec(), play->slot_arg(), play->slot_dep(),
+and play->num_slot() have been set.
+
+\param n_ind
+is the number of independent variables.
+The slot for the phantom variable is zero and
+the slot for the independent variable with index j is j; j = 1, ..., n_ind.
+
+\param dep_taddr
+is the variable index for each of the dependent variables.
+*/
+template <class Base, class Addr>
+void slot_setup_addr(
+    player<Base>*             play      ,
+    size_t                    n_ind     ,
+    const pod_vector<size_t>& dep_taddr )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* fast = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    size_t n_fast  = play->fast_vec().size() / sizeof(inst_t);
+    size_t num_var = play->num_var_rec();
+    //
+    const addr_t*              arg_vec  = play->GetArg();
+    pod_vector<unsigned char>& slot_vec = play->slot_vec();
+    pod_vector<addr_t>&        slot_arg = play->slot_arg();
+    pod_vector<addr_t>&        slot_dep = play->slot_dep();
+    CPPAD_ASSERT_UNKNOWN( slot_vec.size() == 0 );
+    CPPAD_ASSERT_UNKNOWN( slot_arg.size() == 0 );
+    CPPAD_ASSERT_UNKNOWN( slot_dep.size() == 0 );
+    //
+    // arguments for the current instruction, with variable indices
+    addr_t             tmp[3];
+    const addr_t*      op_arg;
+    pod_vector<size_t> var_arg;
+    //
+    // last_use[i_var]: index of the last instruction that uses the variable
+    // with index i_var, or n_fast if its slot is never re-used.
+    pod_vector<size_t> last_use(num_var);
+    for(size_t i_var = 0; i_var < num_var; ++i_var)
+        last_use[i_var] = n_fast;
+    //
+    // first pass: compute last_use
+    for(size_t i = 0; i < n_fast; ++i)
+    {   OpCode op = OpCode( fast[i].op );
+        if( NumRes(op) > 0 )
+        {   last_use[ fast[i].i_var ] = i;
+            if( op == CExpOp || op == CSumOp )
+                op_arg = arg_vec + size_t( fast[i].arg[0] );
+            else
+            {   fast_arg(fast[i], tmp);
+                op_arg = tmp;
+            }
+            slot_var_arg(op, op_arg, var_arg);
+            for(size_t k = 0; k < var_arg.size(); ++k)
+                last_use[ op_arg[ var_arg[k] ] ] = i;
+        }
+    }
+    for(size_t i_var = 0; i_var <= n_ind; ++i_var)
+        last_use[i_var] = n_fast;
+    for(size_t i = 0; i < dep_taddr.size(); ++i)
+        last_use[ dep_taddr[i] ] = n_fast;
+    //
+    // var2slot[i_var]: slot for the variable with index i_var
+    pod_vector<Addr> var2slot(num_var);
+    for(size_t i_var = 0; i_var <= n_ind; ++i_var)
+        var2slot[i_var] = Addr(i_var);
+    size_t num_slot = n_ind + 1;
+    //
+    // free_slot[r]: last slot for each block of r slots that is not in use
+    pod_vector<Addr> free_slot[slot_max_res + 1];
+    //
+    // slot_res[s]: number of slots in the block that ends with slot s
+    pod_vector<unsigned char> slot_res(num_slot);
+    for(size_t s = 0; s < num_slot; ++s)
+        slot_res[s] = 1;
+    //
+    // second pass: assign slots
+    for(size_t i = 0; i < n_fast; ++i)
+    {   OpCode op    = OpCode( fast[i].op );
+        size_t n_res = NumRes(op);
+        if( n_res > 0 )
+        {   CPPAD_ASSERT_UNKNOWN( n_res <= slot_max_res );
+            inst_t inst = fast[i];
+            if( op == CExpOp || op == CSumOp )
+                op_arg = arg_vec + size_t( fast[i].arg[0] );
+            else
+            {   fast_arg(fast[i], tmp);
+                op_arg = tmp;
+            }
+            slot_var_arg(op, op_arg, var_arg);
+            //
+            // slot for the result (allocated before the argument slots
+            // are freed so that it is not the same as an argument slot)
+            size_t s;
+            size_t n_free = free_slot[n_res].size();
+            if( n_free > 0 )
+            {   s = size_t( free_slot[n_res][n_free - 1] );
+                free_slot[n_res].resize(n_free - 1);
+            }
+            else
+            {   num_slot   += n_res;
+                s           = num_slot - 1;
+                slot_res.extend(n_res);
+                slot_res[s] = static_cast<unsigned char>(n_res);
+            }
+            size_t i_var    = size_t( fast[i].i_var );
+            var2slot[i_var] = Addr(s);
+            inst.i_var      = Addr(s);
+            //
+            // arguments with variable indices replaced by slot indices
+            if( op == CExpOp || op == CSumOp )
+            {   size_t n_arg = NumArg(CExpOp);
+                if( op == CSumOp )
+                {   n_arg         = size_t( op_arg[4] ) + 1;
+                    inst.forward0 = slot_forward0_csum<Base, Addr>;
+                }
+                size_t i_arg = slot_arg.extend(n_arg);
+                for(size_t k = 0; k < n_arg; ++k)
+                    slot_arg[i_arg + k] = op_arg[k];
+                for(size_t k = 0; k < var_arg.size(); ++k)
+                {   size_t j_var = size_t( op_arg[ var_arg[k] ] );
+                    slot_arg[i_arg + var_arg[k]] = addr_t( var2slot[j_var] );
+                }
+                inst.arg[0] = Addr(i_arg);
+            }
+            else
+            {   for(size_t k = 0; k < var_arg.size(); ++k)
+                {   size_t j_var = size_t( op_arg[ var_arg[k] ] );
+                    inst.arg[ var_arg[k] ] = var2slot[j_var];
+                }
+            }
+            //
+            // free the slots for arguments that are not used after this
+            for(size_t k = 0; k < var_arg.size(); ++k)
+            {   size_t j_var = size_t( op_arg[ var_arg[k] ] );
+                if( last_use[j_var] == i )
+                {   size_t j_slot = size_t( var2slot[j_var] );
+                    free_slot[ slot_res[j_slot] ].push_back( Addr(j_slot) );
+                    last_use[j_var] = n_fast;
+                }
+            }
+            // a result that is never used
+            if( last_use[i_var] == i )
+            {   free_slot[n_res].push_back( Addr(s) );
+                last_use[i_var] = n_fast;
+            }
+            //
+            size_t i_byte = slot_vec.extend( sizeof(inst) );
+            std::memcpy(slot_vec.data() + i_byte, &inst, sizeof(inst));
+        }
+    }
+    //
+    slot_dep.resize( dep_taddr.size() );
+    for(size_t i = 0; i < dep_taddr.size(); ++i)
+        slot_dep[i] = addr_t( var2slot[ dep_taddr[i] ] );
+    play->set_num_slot(num_slot);
+}
+/*!
+Create the slot evaluation instructions for a player.
+
+\param play
+On input, play->num_slot() is zero or the slot evaluation instructions
+are the result of a previous call to slot_setup.
+Upon return, if the recording can be evaluated using fast instructions,
+the slot evaluation instructions have been created and
+play->num_slot() is the number of slots they use.
+Otherwise, play->num_slot() is zero.
+
+\param n_ind
+is the number of independent variables.
+
+\param dep_taddr
+is the variable index for each of the dependent variables.
+
+\return
+is true (false) if the recording can (cannot) be evaluated using
+the slot evaluation instructions; see fast_setup.
+*/
+template <class Base>
+bool slot_setup(
+    player<Base>*             play      ,
+    size_t                    n_ind     ,
+    const pod_vector<size_t>& dep_taddr )
+{   if( play->num_slot() > 0 )
+        return true;
+    if( ! fast_setup(play) )
+        return false;
+    //
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        slot_setup_addr<Base, unsigned short>(play, n_ind, dep_taddr);
+        break;
+
+        case play::unsigned_int_enum:
+        slot_setup_addr<Base, unsigned int>(play, n_ind, dep_taddr);
+        break;
+
+        case play::size_t_enum:
+        slot_setup_addr<Base, size_t>(play, n_ind, dep_taddr);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return true;
+}
+// ---------------------------------------------------------------------------
+/*!
+Evaluate the slot evaluation instructions in order.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+*/
+template <class Base, class Addr>
+void slot_forward0_addr(
+    const player<Base>*              play ,
+    play::fast_forward0_info<Base>&  info )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* inst = reinterpret_cast<const inst_t*>(
+        play->slot_vec().data()
+    );
+    size_t n_inst = play->slot_vec().size() / sizeof(inst_t);
+    for(size_t i = 0; i < n_inst; ++i)
+        inst[i].forward0(inst[i], info);
+}
+/*!
+Zero order forward mode using the slot evaluation instructions.
+
+\param play
+is the player for this recording and slot_setup(play, n_ind, dep_taddr)
+has returned true.
+
+\param slot
+is a vector of length play->num_slot().
+\n
+\b Input: For j = 1, ..., n_ind, slot[j] is the value of the
+independent variable with index j.
+\n
+\b Output: For i = 0, ..., m-1, slot[ play->slot_dep()[i] ]
+is the value of the i-th dependent variable.
+The other elements of slot, except the input values above,
+are used for temporary values.
+*/
+template <class Base>
+void slot_forward0(const player<Base>* play, Base* slot)
+{   CPPAD_ASSERT_UNKNOWN( play->num_slot() > 0 );
+    //
+    play::fast_forward0_info<Base> info;
+    info.arg_vec                 = play->slot_arg().data();
+    info.num_par                 = play->num_par_rec();
+    info.parameter               = play->GetPar();
+    info.cap_order               = 1;
+    info.taylor                  = slot;
+    info.compare_change_count    = 0;
+    info.compare_change_number   = 0;
+    info.compare_change_op_index = 0;
+    //
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        slot_forward0_addr<Base, unsigned short>(play, info);
+        break;
+
+        case play::unsigned_int_enum:
+        slot_forward0_addr<Base, unsigned int>(play, info);
+        break;
+
+        case play::size_t_enum:
+        slot_forward0_addr<Base, size_t>(play, info);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
@@ -0,0 +1,321 @@
+# ifndef CPPAD_LOCAL_SWEEP_UPDATE_EVAL_HPP
+# define CPPAD_LOCAL_SWEEP_UPDATE_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <limits>
+# include <cppad/local/sweep/slot_eval.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/update_eval.hpp
+Zero order forward mode that only evaluates the operators that depend on
+the independent variables that changed.
+
+The users of each variable, i.e., the pre-decoded instructions that have
+the variable as an argument, are computed once by update_setup.
+During an update, the instructions that need to be evaluated are marked
+using one bit per instruction. The users of a variable always come after
+the operator that computes the variable, so the marked instructions can
+be evaluated in one pass over the bits in increasing order.
+Words in the marks that are zero are skipped without looking at the
+corresponding instructions.
+*/
+
+/*!
+Create the users of each variable using a specific type for the indices
+in the fast evaluation instructions.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+
+\param play
+On input, play->fast_vec() contains the fast evaluation instructions
+and play->update_start() is empty.
+Upon return, play->update_start(), play->update_user(), play->update_mark(),
+and play->update_cskip() have been set.
+*/
+template <class Base, class Addr>
+void update_setup_addr(player<Base>* play)
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* fast = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    size_t n_fast  = play->fast_vec().size() / sizeof(inst_t);
+    size_t num_var = play->num_var_rec();
+    //
+    const addr_t*       arg_vec      = play->GetArg();
+    pod_vector<addr_t>& update_start = play->update_start();
+    pod_vector<addr_t>& update_user  = play->update_user();
+    pod_vector<size_t>& update_mark  = play->update_mark();
+    CPPAD_ASSERT_UNKNOWN( update_start.size() == 0 );
+    CPPAD_ASSERT_UNKNOWN( update_user.size() == 0 );
+    //
+    // arguments for the current instruction
+    addr_t             tmp[3];
+    const addr_t*      op_arg;
+    pod_vector<size_t> var_arg;
+    //
+    // The first pass counts the users of each variable and the second
+    // pass stores them. Comparison operators are not included because
+    // they have no results and are not evaluated.
+    pod_vector<size_t> count(num_var);
+    for(size_t i_var = 0; i_var < num_var; ++i_var)
+        count[i_var] = 0;
+    for(size_t pass = 0; pass < 2; ++pass)
+    {   if( pass == 1 )
+        {   // start for each variable
+            update_start.resize(num_var + 1);
+            size_t start = 0;
+            for(size_t i_var = 0; i_var < num_var; ++i_var)
+            {   update_start[i_var] = addr_t( start );
+                start              += count[i_var];
+                count[i_var]        = size_t( update_start[i_var] );
+            }
+            update_start[num_var] = addr_t( start );
+            update_user.resize(start);
+        }
+        for(size_t i = 0; i < n_fast; ++i)
+        {   OpCode op = OpCode( fast[i].op );
+            if( NumRes(op) > 0 )
+            {   if( op == CExpOp || op == CSumOp )
+                    op_arg = arg_vec + size_t( fast[i].arg[0] );
+                else
+                {   fast_arg(fast[i], tmp);
+                    op_arg = tmp;
+                }
+                slot_var_arg(op, op_arg, var_arg);
+                for(size_t k = 0; k < var_arg.size(); ++k)
+                {   size_t j_var = size_t( op_arg[ var_arg[k] ] );
+                    if( pass == 0 )
+                        ++count[j_var];
+                    else
+                        update_user[ count[j_var]++ ] = addr_t(i);
+                }
+            }
+        }
+    }
+    //
+    // marks
+    size_t n_bit  = size_t( std::numeric_limits<size_t>::digits );
+    size_t n_word = (n_fast + n_bit - 1) / n_bit;
+    update_mark.resize(n_word);
+    for(size_t k = 0; k < n_word; ++k)
+        update_mark[k] = 0;
+    //
+    // check for conditional skip operators
+    bool cskip = false;
+    for(size_t i_op = 0; i_op < play->num_op_rec(); ++i_op)
+        cskip |= play->GetOp(i_op) == CSkipOp;
+    play->set_update_cskip(cskip);
+}
+/*!
+Create the information used by update_forward0.
+
+\param play
+On input, play->update_start() is empty or contains the result of a previous
+call to update_setup.
+Upon return, if the recording can be evaluated using fast instructions,
+play->update_start(), play->update_user(), play->update_mark(),
+and play->update_cskip() have been set.
+
+\return
+is true (false) if the recording can (cannot) be evaluated using
+the fast instructions; see fast_setup.
+*/
+template <class Base>
+bool update_setup(player<Base>* play)
+{   if( play->update_start().size() > 0 )
+        return true;
+    if( ! fast_setup(play) )
+        return false;
+    //
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        update_setup_addr<Base, unsigned short>(play);
+        break;
+
+        case play::unsigned_int_enum:
+        update_setup_addr<Base, unsigned int>(play);
+        break;
+
+        case play::size_t_enum:
+        update_setup_addr<Base, size_t>(play);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return true;
+}
+// ---------------------------------------------------------------------------
+/*!
+Mark the users of a variable.
+
+\param i_var
+is the index of the variable.
+
+\param update_start
+\param update_user
+are the users for each variable; see play->update_start().
+
+\param mark
+is the bits that mark the instructions that need to be evaluated.
+Upon return, the bits for the users of i_var are one.
+*/
+inline void update_mark_user(
+    size_t        i_var        ,
+    const addr_t* update_start ,
+    const addr_t* update_user  ,
+    size_t*       mark         )
+{   size_t n_bit = size_t( std::numeric_limits<size_t>::digits );
+    size_t start = size_t( update_start[i_var] );
+    size_t end   = size_t( update_start[i_var + 1] );
+    for(size_t k = start; k < end; ++k)
+    {   size_t i = size_t( update_user[k] );
+        mark[i / n_bit] |= size_t(1) << (i % n_bit);
+    }
+}
+/*!
+Evaluate the marked zero order forward instructions in order.
+
+\tparam Addr
+is the type used for the indices in the instructions; see play->fast_addr().
+
+\param n_changed
+is the number of variables that changed.
+
+\param changed_var
+is the index of each of the variables that changed.
+
+\return
+is the number of instructions that were evaluated.
+*/
+template <class Base, class Addr>
+size_t update_forward0_addr(
+    player<Base>*                    play        ,
+    size_t                           n_changed   ,
+    const size_t*                    changed_var ,
+    play::fast_forward0_info<Base>&  info        )
+{   typedef play::fast_inst<Base, Addr> inst_t;
+    const inst_t* inst = reinterpret_cast<const inst_t*>(
+        play->fast_vec().data()
+    );
+    const addr_t* update_start = play->update_start().data();
+    const addr_t* update_user  = play->update_user().data();
+    size_t*       mark         = play->update_mark().data();
+    size_t        n_word       = play->update_mark().size();
+    size_t        n_bit        = size_t( std::numeric_limits<size_t>::digits );
+    //
+    // mark the users of the variables that changed
+    for(size_t k = 0; k < n_changed; ++k)
+        update_mark_user(changed_var[k], update_start, update_user, mark);
+    //
+    // evaluate the marked instructions and mark their users
+    size_t n_eval = 0;
+    for(size_t k = 0; k < n_word; ++k)
+    {   // the users of an instruction in this word come after it,
+        // so they are found when the rest of this word is checked
+        for(size_t b = 0; b < n_bit && (mark[k] >> b) != 0; ++b)
+        {   if( (mark[k] >> b) & size_t(1) )
+            {   size_t i = k * n_bit + b;
+                inst[i].forward0(inst[i], info);
+                update_mark_user(
+                    size_t( inst[i].i_var ), update_start, update_user, mark
+                );
+                ++n_eval;
+            }
+        }
+        mark[k] = 0;
+    }
+    return n_eval;
+}
+/*!
+Zero order forward mode for the operators that depend on
+a subset of the variables.
+
+\param play
+is the player for this recording and update_setup(play)
+has returned true.
+
+\param n_changed
+is the number of variables that changed.
+
+\param changed_var
+is the index of each of the variables that changed
+(it can be an independent variable or any other variable).
+
+\param J
+is the number of columns in the taylor matrix.
+
+\param taylor
+\b Input: For all i, taylor[ i * J + 0 ] is the value of the
+i-th variable before the change, except for the variables in changed_var
+which have their new values.
+\n
+\b Output: For the variables that depend on the variables in changed_var,
+taylor[ i * J + 0 ] is the new value of the i-th variable.
+The other values are not modified.
+
+\return
+is the number of instructions that were evaluated.
+*/
+template <class Base>
+size_t update_forward0(
+    player<Base>*  play        ,
+    size_t         n_changed   ,
+    const size_t*  changed_var ,
+    size_t         J           ,
+    Base*          taylor      )
+{   CPPAD_ASSERT_UNKNOWN( play->update_start().size() > 0 );
+    //
+    // comparison operators are not evaluated (compare_change_count is zero)
+    play::fast_forward0_info<Base> info;
+    info.arg_vec                 = play->GetArg();
+    info.num_par                 = play->num_par_rec();
+    info.parameter               = play->GetPar();
+    info.cap_order               = J;
+    info.taylor                  = taylor;
+    info.compare_change_count    = 0;
+    info.compare_change_number   = 0;
+    info.compare_change_op_index = 0;
+    //
+    size_t n_eval = 0;
+    switch( play->fast_addr() )
+    {   case play::unsigned_short_enum:
+        n_eval = update_forward0_addr<Base, unsigned short>(
+            play, n_changed, changed_var, info
+        );
+        break;
+
+        case play::unsigned_int_enum:
+        n_eval = update_forward0_addr<Base, unsigned int>(
+            play, n_changed, changed_var, info
+        );
+        break;
+
+        case play::size_t_enum:
+        n_eval = update_forward0_addr<Base, size_t>(
+            play, n_changed, changed_var, info
+        );
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return n_eval;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
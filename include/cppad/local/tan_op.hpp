@@ -114,6 +114,11 @@ void forward_tan_op_dir(
 
     size_t k;
     size_t m = (q-1) * r + 1;
+    if( q == 1 )
+    {   forward_dir_first_dot(r, x + 1, Base(1.0), x + 1, y[0], z + 1);
+        forward_dir_first_mul(r, z + 1, Base(2.0) * z[0], y + 1);
+        return;
+    }
     for(size_t ell = 0; ell < r; ell++)
     {   z[m+ell] = Base(double(q)) * ( x[m+ell] + x[m+ell] * y[0]);
         for(k = 1; k < q; k++)
@@ -191,8 +191,8 @@ namespace CppAD {
             size_t M = 10;
 
             // initial and final time
-            Float ti = 0.0;
-            Float tf = 1.0;
+            Float ti(0.0);
+            Float tf(1.0);
 
             // initial value for y(x, t); i.e. y(x, 0)
             // (is a reference to x)
@@ -226,7 +226,7 @@ namespace CppAD {
             for(i = k; i < n; i++)
             {   // partial w.r.t x[i-k] of x[i-k] * t^k / k!
                 j = i - k;
-                fp[ i * n + j ] += 1.0 / Float(factorial);
+                fp[ i * n + j ] += 1.0 / Float( double(factorial) );
             }
         }
     }
@@ -0,0 +1,188 @@
+# ifndef CPPAD_UTILITY_CREATE_DLL_LIB_HPP
+# define CPPAD_UTILITY_CREATE_DLL_LIB_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin create_dll_lib$$
+$spell
+    csrc
+    dll
+    lib
+    std
+    cmd
+    fPIC
+    const
+    gcc
+    msg
+$$
+
+$section Create a Dynamic Link Library$$
+
+$head Syntax$$
+$codei%# include <cppad/utility/create_dll_lib.hpp>
+%$$
+$icode%err_msg% = create_dll_lib(%dll_file%, %csrc_files%, %options%)
+%$$
+
+$head Prototype$$
+$srcthisfile%0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1%$$
+
+$head Purpose$$
+Compiles a set of C source files and links them into a
+dynamic link library (shared object) that can be loaded at run time
+using $cref link_dll_lib$$.
+The compile and link commands are run using $code std::system$$.
+This header is not included by $code cppad/cppad.hpp$$
+(or $code cppad/utility.hpp$$).
+The file names are enclosed in double quotes in these commands,
+so they can contain spaces (but not double quotes).
+
+$head dll_file$$
+This is the file name for the dynamic link library
+(on Unix systems it usually ends with $code .so$$).
+
+$head csrc_files$$
+The vector $icode csrc_files$$ contains the names of the C source files.
+Each name must end with $code .c$$.
+The corresponding object file has the same name with $code .c$$ replaced
+by $code .o$$. The object files are removed after the library is created.
+
+$head StringVector$$
+is a $cref SimpleVector$$ with elements of type $code std::string$$.
+
+$head options$$
+The following options can be used to change the commands;
+the default for each option is used if it is not in the map:
+$table
+$icode key$$ $cnext $icode default$$ $rnext
+$code compile$$ $cnext
+    $icode%cmd% %compile_flags%%$$
+$rnext
+$code object$$ $cnext
+    $icode object_option$$
+$rnext
+$code link$$ $cnext
+    $icode%cmd% %link_flags%%$$
+$rnext
+$code library$$ $cnext
+    $icode library_option$$
+$tend
+where $icode cmd$$ is
+$cref/CPPAD_C_COMPILER_CMD/configure.hpp/CPPAD_C_COMPILER_CMD/$$,
+$icode compile_flags$$ is
+$cref/CPPAD_C_COMPILE_FLAGS/configure.hpp/CPPAD_C_COMPILE_FLAGS/$$,
+$icode object_option$$ is
+$cref/CPPAD_C_OBJECT_OPTION/configure.hpp/CPPAD_C_OBJECT_OPTION/$$,
+$icode link_flags$$ is
+$cref/CPPAD_C_LINK_FLAGS/configure.hpp/CPPAD_C_LINK_FLAGS/$$, and
+$icode library_option$$ is
+$cref/CPPAD_C_LIBRARY_OPTION/configure.hpp/CPPAD_C_LIBRARY_OPTION/$$.
+For example, with $code gcc$$ the defaults are
+$code -c -fPIC -O2$$, $code -o$$, $code -shared$$, and $code -o$$.
+The command for compiling the source file $icode%file%.c%$$ is
+$codei%
+    %compile% "%file%.c" %object%"%file%.o"
+%$$
+and the command for creating the library is
+$codei%
+    %link% "%file_1%.o" %...% "%file_n%.o" %library%"%dll_file%"
+%$$
+
+$head err_msg$$
+If the return value $icode err_msg$$ is empty,
+no error was detected.
+Otherwise, it is a message describing the command that failed.
+
+$head Example$$
+The file $cref to_csrc.cpp$$ is an example and test that uses
+this routine and $cref link_dll_lib$$.
+
+$end
+*/
+# include <cstdio>
+# include <cstdlib>
+# include <map>
+# include <string>
+# include <cppad/configure.hpp>
+# include <cppad/utility/check_simple_vector.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// BEGIN_PROTOTYPE
+template <class StringVector>
+std::string create_dll_lib(
+    const std::string&                        dll_file   ,
+    const StringVector&                       csrc_files ,
+    const std::map<std::string, std::string>& options    )
+// END_PROTOTYPE
+{   using std::string;
+    CheckSimpleVector<string, StringVector>( string("x"), string("y") );
+    //
+    // compile and link commands
+    string cmd     = CPPAD_C_COMPILER_CMD;
+    string compile = cmd + " " + CPPAD_C_COMPILE_FLAGS;
+    string object  = CPPAD_C_OBJECT_OPTION;
+    string link    = cmd + " " + CPPAD_C_LINK_FLAGS;
+    string library = CPPAD_C_LIBRARY_OPTION;
+    std::map<string, string>::const_iterator itr;
+    itr = options.find("compile");
+    if( itr != options.end() )
+        compile = itr->second;
+    itr = options.find("object");
+    if( itr != options.end() )
+        object = itr->second;
+    itr = options.find("link");
+    if( itr != options.end() )
+        link = itr->second;
+    itr = options.find("library");
+    if( itr != options.end() )
+        library = itr->second;
+    //
+    // compile each of the source files
+    size_t n_file = csrc_files.size();
+    StringVector object_files(n_file);
+    string err_msg;
+    for(size_t i = 0; i < n_file && err_msg == ""; ++i)
+    {   const string& csrc_file = csrc_files[i];
+        size_t n_char = csrc_file.size();
+        if( n_char < 3 || csrc_file.substr(n_char - 2) != ".c" )
+            err_msg = "create_dll_lib: " + csrc_file + " does not end with .c";
+        else
+        {   object_files[i] = csrc_file.substr(0, n_char - 2) + ".o";
+            string command  = compile + " \"" + csrc_file + "\"";
+            command        += " " + object + "\"" + object_files[i] + "\"";
+            if( std::system( command.c_str() ) != 0 )
+                err_msg = "create_dll_lib: command failed: " + command;
+        }
+    }
+    //
+    // link the object files
+    if( err_msg == "" )
+    {   string command = link;
+        for(size_t i = 0; i < n_file; ++i)
+            command += " \"" + object_files[i] + "\"";
+        command += " " + library + "\"" + dll_file + "\"";
+        if( std::system( command.c_str() ) != 0 )
+            err_msg = "create_dll_lib: command failed: " + command;
+    }
+    //
+    // remove the object files
+    for(size_t i = 0; i < n_file; ++i)
+    {   if( object_files[i] != "" )
+            std::remove( object_files[i].c_str() );
+    }
+    return err_msg;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
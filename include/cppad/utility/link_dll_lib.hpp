@@ -0,0 +1,108 @@
+# ifndef CPPAD_UTILITY_LINK_DLL_LIB_HPP
+# define CPPAD_UTILITY_LINK_DLL_LIB_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin link_dll_lib$$
+$spell
+    dll
+    lib
+    std
+    const
+    msg
+    ptr
+    dlopen
+    cppad
+$$
+
+$section Link a Dynamic Link Library$$
+
+$head Syntax$$
+$codei%# include <cppad/utility/link_dll_lib.hpp>
+%$$
+$codei%link_dll_lib %dll_linker%(%dll_file%, %err_msg%)
+%$$
+$icode%fun_ptr% = %dll_linker%(%function_name%, %err_msg%)%$$
+
+$head Prototype$$
+$srcthisfile%0%// BEGIN_CTOR_PROTOTYPE%// END_CTOR_PROTOTYPE%1%$$
+$srcthisfile%0%// BEGIN_FUN_PROTOTYPE%// END_FUN_PROTOTYPE%1%$$
+
+$head Purpose$$
+Loads a dynamic link library, for example one created by
+$cref create_dll_lib$$, and gets pointers to the functions in it.
+This uses $code dlopen$$ on Unix systems
+and $code LoadLibrary$$ on Windows systems.
+The implementation is in the $code cppad_lib$$ library, so a program
+that uses this class must link with that library.
+This header is not included by $code cppad/cppad.hpp$$
+(or $code cppad/utility.hpp$$).
+
+$head dll_linker$$
+Is the object that loads the library.
+The library is unloaded when this object is destroyed,
+so the function pointers cannot be used after that.
+This object cannot be copied.
+
+$head dll_file$$
+is the file name for the library.
+If it does not contain a $code /$$ character,
+the system search path for libraries is used; e.g.,
+use $code ./$$ at the beginning of the file name
+for a library in the current working directory.
+
+$head err_msg$$
+If the return value $icode err_msg$$ is empty, no error was detected.
+Otherwise, it is a message describing the error.
+
+$head function_name$$
+is the name of a function in the library.
+
+$head fun_ptr$$
+If $icode err_msg$$ is empty,
+$icode fun_ptr$$ is a pointer to the function; i.e., it must be
+converted to the type of the function before it is called.
+Otherwise it is null.
+
+$head Example$$
+The file $cref to_csrc.cpp$$ is an example and test that uses
+this class.
+
+$end
+*/
+# include <string>
+# include <cppad/configure.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+class link_dll_lib {
+private:
+    // handle for the library (null if it was not loaded)
+    void* handle_;
+    // not implemented
+    link_dll_lib(const link_dll_lib&);
+    link_dll_lib& operator=(const link_dll_lib&);
+public:
+    // BEGIN_CTOR_PROTOTYPE
+    link_dll_lib(const std::string& dll_file, std::string& err_msg);
+    // END_CTOR_PROTOTYPE
+    ~link_dll_lib(void);
+    // BEGIN_FUN_PROTOTYPE
+    void* operator()(
+        const std::string& function_name, std::string& err_msg
+    ) const;
+    // END_FUN_PROTOTYPE
+};
+
+} // END_CPPAD_NAMESPACE
+
+# endif
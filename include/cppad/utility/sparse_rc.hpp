@@ -24,6 +24,10 @@ $spell
     nr
     nc
     resize
+    csr
+    csc
+    ind
+    ptr
 $$
 $section Row and Column Index Sparsity Patterns$$
 
@@ -54,6 +58,10 @@ $icode%row_major% = %pattern%.row_major()
 %$$
 $icode%col_major% = %pattern%.col_major()
 %$$
+$icode%pattern%.get_csr(%row_ptr%, %col_ind%, %row_major%)
+%$$
+$icode%pattern%.get_csc(%col_ptr%, %row_ind%, %col_major%)
+%$$
 
 $head SizeVector$$
 We use $icode SizeVector$$ to denote $cref SimpleVector$$ class
@@ -188,6 +196,59 @@ $codei%
 This routine generates an assert if there are two entries with the same
 row and column values (if $code NDEBUG$$ is not defined).
 
+$head get_csr$$
+This function converts the sparsity pattern to compressed sparse row
+format.
+
+$subhead row_major$$
+This argument has prototype
+$codei%
+    %SizeVector%& %row_major%
+%$$
+If its input size is zero, it is set to
+$icode%pattern%.row_major()%$$.
+Otherwise, it must be the value of $icode row_major$$ returned by a previous
+call for the same $icode pattern$$ and is not recomputed; i.e.,
+the sorting is only done once when the same vector is used for
+repeated calls.
+
+$subhead row_ptr$$
+This argument has prototype
+$codei%
+    %SizeVector%& %row_ptr%
+%$$
+Upon return its size is $icode%nr%+1%$$,
+$icode%row_ptr%[0]%$$ is zero, and $icode%row_ptr%[%nr%]%$$ is $icode nnz$$.
+The possibly non-zero elements in row $icode i$$ have indices
+$icode ell$$ in the compressed format where
+$codei%
+    %row_ptr%[%i%] <= %ell% < %row_ptr%[%i%+1]
+%$$
+
+$subhead col_ind$$
+This argument has prototype
+$codei%
+    %SizeVector%& %col_ind%
+%$$
+Upon return its size is $icode nnz$$ and
+$codei%
+    %col_ind%[%ell%] = %col%[ %row_major%[%ell%] ]
+%$$
+is the column index corresponding to $icode ell$$.
+
+$head get_csc$$
+This function converts the sparsity pattern to compressed sparse column
+format.
+It is the same as $code get_csr$$ with the roles of rows and columns
+exchanged; i.e.,
+$icode col_major$$ is set to $icode%pattern%.col_major()%$$
+if its input size is zero,
+$icode col_ptr$$ has size $icode%nc%+1%$$,
+$icode row_ind$$ has size $icode nnz$$, and
+$codei%
+    %row_ind%[%ell%] = %row%[ %col_major%[%ell%] ]
+%$$
+
 $children%
     example/utility/sparse_rc.cpp
 %$$
@@ -341,6 +402,53 @@ public:
 # endif
         return col_major;
     }
+    /// compressed sparse row format
+    void get_csr(
+        SizeVector& row_ptr, SizeVector& col_ind, SizeVector& row_major
+    ) const
+    {   if( row_major.size() == 0 )
+        {   row_major.resize(nnz_);
+            row_major = this->row_major();
+        }
+        compressed(row_, col_, nr_, row_major, row_ptr, col_ind);
+    }
+    /// compressed sparse column format
+    void get_csc(
+        SizeVector& col_ptr, SizeVector& row_ind, SizeVector& col_major
+    ) const
+    {   if( col_major.size() == 0 )
+        {   col_major.resize(nnz_);
+            col_major = this->col_major();
+        }
+        compressed(col_, row_, nc_, col_major, col_ptr, row_ind);
+    }
+private:
+    /// convert to compressed format where major (minor) is the row or
+    /// column index that is compressed (not compressed)
+    void compressed(
+        const SizeVector& major     ,
+        const SizeVector& minor     ,
+        size_t            n_major   ,
+        const SizeVector& order     ,
+        SizeVector&       ptr       ,
+        SizeVector&       ind       ) const
+    {   CPPAD_ASSERT_KNOWN(
+            size_t( order.size() ) == nnz_,
+            "sparse_rc: get_csr or get_csc: major order has wrong size"
+        );
+        ptr.resize(n_major + 1);
+        ind.resize(nnz_);
+        size_t ell = 0;
+        for(size_t i = 0; i < n_major; ++i)
+        {   ptr[i] = ell;
+            while( ell < nnz_ && major[ order[ell] ] == i )
+            {   ind[ell] = minor[ order[ell] ];
+                ++ell;
+            }
+        }
+        CPPAD_ASSERT_UNKNOWN( ell == nnz_ );
+        ptr[n_major] = ell;
+    }
 };
 
 } // END_CPPAD_NAMESPACE
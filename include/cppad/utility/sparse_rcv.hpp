@@ -27,6 +27,10 @@ $spell
     rcv
     rc
     Eigen
+    csr
+    csc
+    ind
+    ptr
 $$
 $section Sparse Matrix Row, Column, Value Representation$$
 
@@ -59,6 +63,10 @@ $icode%row_major% = %matrix%.row_major()
 %$$
 $icode%col_major% = %matrix%.col_major()
 %$$
+$icode%matrix%.get_csr(%row_ptr%, %col_ind%, %csr_val%, %row_major%)
+%$$
+$icode%matrix%.get_csc(%col_ptr%, %row_ind%, %csc_val%, %col_major%)
+%$$
 
 $head SizeVector$$
 We use $cref/SizeVector/sparse_rc/SizeVector/$$ to denote the
@@ -197,6 +205,28 @@ $codei%
 This routine generates an assert if there are two entries with the same
 row and column values (if $code NDEBUG$$ is not defined).
 
+$head get_csr$$
+This function converts $icode matrix$$ to compressed sparse row format.
+The arguments $icode row_ptr$$, $icode col_ind$$ and $icode row_major$$
+are the same as for the sparsity pattern version
+$cref/get_csr/sparse_rc/get_csr/$$.
+In particular, if $icode row_major$$ is not empty on input,
+it is used as the row-major order and not recomputed.
+The argument $icode csr_val$$ has prototype
+$codei%
+    %ValueVector%& %csr_val%
+%$$
+Upon return its size is $icode nnz$$ and
+$codei%
+    %csr_val%[%ell%] = %val%[ %row_major%[%ell%] ]
+%$$
+is the value corresponding to index $icode ell$$ in the compressed format.
+
+$head get_csc$$
+This function converts $icode matrix$$ to compressed sparse column format.
+It is the same as $code get_csr$$ with the roles of rows and columns
+exchanged; see $cref/get_csc/sparse_rc/get_csc/$$.
+
 $head Eigen Matrix$$
 If you have the $cref/eigen package/eigen_prefix/$$ in your include path,
 you can use $cref sparse2eigen$$ to convert a sparse matrix to eigen format.
@@ -282,6 +312,28 @@ public:
     /// column-major indices
     SizeVector col_major(void) const
     {   return pattern_.col_major(); }
+    /// compressed sparse row format
+    void get_csr(
+        SizeVector&  row_ptr   ,
+        SizeVector&  col_ind   ,
+        ValueVector& csr_val   ,
+        SizeVector&  row_major ) const
+    {   pattern_.get_csr(row_ptr, col_ind, row_major);
+        csr_val.resize( pattern_.nnz() );
+        for(size_t ell = 0; ell < pattern_.nnz(); ++ell)
+            csr_val[ell] = val_[ row_major[ell] ];
+    }
+    /// compressed sparse column format
+    void get_csc(
+        SizeVector&  col_ptr   ,
+        SizeVector&  row_ind   ,
+        ValueVector& csc_val   ,
+        SizeVector&  col_major ) const
+    {   pattern_.get_csc(col_ptr, row_ind, col_major);
+        csc_val.resize( pattern_.nnz() );
+        for(size_t ell = 0; ell < pattern_.nnz(); ++ell)
+            csc_val[ell] = val_[ col_major[ell] ];
+    }
 };
 
 } // END_CPPAD_NAMESPACE
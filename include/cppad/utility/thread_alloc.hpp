@@ -27,6 +27,9 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/define.hpp>
 # include <cppad/local/set_get_in_parallel.hpp>
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <atomic>
+# endif
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 /*!
 \file thread_alloc.hpp
@@ -88,6 +91,8 @@ private:
         size_t number;
         /// the different capacity values
         size_t value[CPPAD_MAX_NUM_CAPACITY];
+        /// index of first capacity value greater than or equal 2^b
+        size_t bit_index[ std::numeric_limits<size_t>::digits ];
         /// ctor
         capacity_t(void)
         {   // Cannot figure out how to call thread_alloc::in_parallel here.
@@ -104,6 +109,42 @@ private:
                 capacity        = 3 * ( (capacity + 1) / 2 );
             }
             CPPAD_ASSERT_UNKNOWN( number > 0 );
+            //
+            // bit_index
+            size_t c_index = 0;
+            for(int b = 0; b < std::numeric_limits<size_t>::digits; ++b)
+            {   size_t power = size_t(1) << b;
+                while( c_index + 1 < number && value[c_index] < power )
+                    ++c_index;
+                bit_index[b] = c_index;
+            }
+        }
+        /*!
+        Determine the index of the smallest capacity that holds min_bytes.
+        Each interval [ 2^b , 2^(b+1) ) contains at most two capacity
+        values, so this takes constant time.
+        */
+        size_t capacity_index(size_t min_bytes) const
+        {   if( min_bytes <= value[0] )
+                return 0;
+            // b = floor( log_2(min_bytes) )
+# if defined(__GNUC__)
+            int b = std::numeric_limits<unsigned long long>::digits - 1
+                - __builtin_clzll( (unsigned long long)(min_bytes) );
+# else
+            int b = 0;
+            for(int shift = std::numeric_limits<size_t>::digits / 2;
+                shift > 0; shift /= 2)
+            {   if( (min_bytes >> (b + shift)) != 0 )
+                    b += shift;
+            }
+# endif
+            size_t c_index = bit_index[b];
+            while( value[c_index] < min_bytes )
+            {   ++c_index;
+                CPPAD_ASSERT_UNKNOWN( c_index < number );
+            }
+            return c_index;
         }
     };
 
@@ -118,7 +159,8 @@ private:
         // -----------------------------------------------------------------
         /// make default constructor private. It is only used by constructor
         /// for `root arrays below.
-        block_t(void) : extra_(0), tc_index_(0), next_(CPPAD_NULL)
+        block_t(void)
+        : extra_(0), tc_index_(0), next_(CPPAD_NULL)
         { }
     };
 
@@ -383,27 +425,122 @@ private:
     \param set
     If set is true, then thread_num_new is becomes the most
     recent setting for this set_get_thread_num.
+
+    \param cache
+    If set is true, cache is the new setting for caching the thread number.
+    If caching is on, the value returned by thread_num_new for each system
+    thread is saved (in thread local storage) and it is not called again
+    for that system thread until the next time set is true.
+    Caching is only possible when C++11 is available.
     */
     static size_t set_get_thread_num(
         size_t (*thread_num_new)(void)  ,
-        bool set = false                )
+        bool set   = false              ,
+        bool cache = false              )
     {   static size_t (*thread_num_user)(void) = CPPAD_NULL;
+        static bool   cache_user               = false;
+        // number of times set has been true (so cache values are valid
+        // if their generation is equal to this value)
+        static size_t generation               = 0;
 
         if( set )
         {   thread_num_user = thread_num_new;
+            cache_user      = cache;
+            ++generation;
             return 0;
         }
 
         if( thread_num_user == CPPAD_NULL )
             return 0;
 
+# if CPPAD_USE_CPLUSPLUS_2011
+        static thread_local size_t cache_generation = 0;
+        static thread_local size_t cache_thread     = 0;
+        if( cache_user & (cache_generation == generation) )
+            return cache_thread;
+# endif
         size_t thread = thread_num_user();
         CPPAD_ASSERT_KNOWN(
             thread < set_get_num_threads(0) ,
             "parallel_setup: thread_num() >= num_threads"
         );
+# if CPPAD_USE_CPLUSPLUS_2011
+        if( cache_user )
+        {   cache_generation = generation;
+            cache_thread     = thread;
+        }
+# endif
         return thread;
     }
+    // ----------------------------------------------------------------------
+# if CPPAD_USE_CPLUSPLUS_2011
+    /*!
+    Root of the list of memory allocations that were returned by other
+    threads, while in parallel mode, and that are waiting to be returned
+    by the thread that owns them.
+
+    \param thread [in]
+    is the thread that owns the memory in the list.
+
+    \return
+    pointer to the root for this thread.
+    The list is linked using deferred_next for each block_t.
+    These are zero initialized static variables so they can be used
+    in parallel mode.
+    */
+    static std::atomic<void*>* deferred_root(size_t thread)
+    {   CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
+        static std::atomic<void*> root[CPPAD_MAX_NUM_THREADS];
+        return root + thread;
+    }
+    /*!
+    Link to the next memory allocation in a deferred return list.
+
+    \param node [in]
+    is a memory allocation that has been returned by a thread that does
+    not own it and is waiting in a deferred return list.
+
+    \return
+    reference to the link for this node.
+    The next_ field of a block_t is not used while the memory is in use,
+    except for the debugging list of memory in use.
+    In the debugging case, the link is stored at the beginning of
+    the memory (which has been returned and is at least one pointer long)
+    so that the owning thread can check the inuse list when it returns
+    the memory.
+    */
+    static void*& deferred_next(block_t* node)
+    {
+# if defined(NDEBUG) || defined(CPPAD_DEBUG_AND_RELEASE)
+        return node->next_;
+# else
+        return *reinterpret_cast<void**>(node + 1);
+# endif
+    }
+# endif
+    // ----------------------------------------------------------------------
+    /*!
+    Return the memory that other threads returned for this thread.
+
+    \param thread [in]
+    This must either be the thread currently executing, or we must be
+    in sequential (not parallel) execution mode.
+    */
+    static void return_deferred(size_t thread)
+    {
+# if CPPAD_USE_CPLUSPLUS_2011
+        std::atomic<void*>* root = deferred_root(thread);
+        if( root->load(std::memory_order_relaxed) == CPPAD_NULL )
+            return;
+        void* v_node = root->exchange(CPPAD_NULL, std::memory_order_acquire);
+        while( v_node != CPPAD_NULL )
+        {   // return_memory checks the inuse list (when debugging)
+            block_t* node = reinterpret_cast<block_t*>(v_node);
+            v_node        = deferred_next(node);
+            return_memory( reinterpret_cast<void*>(node + 1) );
+        }
+# endif
+    }
 // ============================================================================
 public:
 /*
@@ -421,6 +558,9 @@ $section Setup thread_alloc For Use in Multi-Threading Environment$$
 $head Syntax$$
 $codei%thread_alloc::parallel_setup(%num_threads%, %in_parallel%, %thread_num%)
 %$$
+$codei%thread_alloc::parallel_setup(
+    %num_threads%, %in_parallel%, %thread_num%, %cache_thread_num%
+)%$$
 
 $head Purpose$$
 By default there is only one thread and all execution is in sequential mode,
@@ -481,6 +621,25 @@ as soon as a new thread is executing,
 one must be certain that $icode thread_num()$$ will
 work for that thread.
 
+$head cache_thread_num$$
+This argument has prototype
+$codei%
+    bool %cache_thread_num%
+%$$
+If it is not present, it is false.
+If it is true, the value returned by $icode thread_num$$
+for each system thread is saved, in thread local storage,
+the first time it is needed after this call to $code parallel_setup$$.
+The saved value is used for all the $code thread_alloc$$ allocations,
+and calls to $cref/thread_alloc::thread_num/ta_thread_num/$$,
+by that system thread until the next call to $code parallel_setup$$.
+This is faster, but it requires that each system thread has the same
+thread number from the time it first uses $code thread_alloc$$
+until the next call to $code parallel_setup$$
+(this is not the case if the same system thread may have
+different thread numbers in different parallel regions).
+If C++11 is not available, $icode cache_thread_num$$ has no effect.
+
 $head Restrictions$$
 The function $code parallel_setup$$ must be called before
 the program enters $cref/parallel/ta_in_parallel/$$ execution mode.
@@ -507,11 +666,16 @@ $end
     \param thread_num [in]
     Is the routine that determines the current thread number
     (between zero and num_threads minus one).
+
+    \param cache_thread_num [in]
+    If true, the value returned by thread_num for each system thread
+    is saved the first time it is used.
     */
     static void parallel_setup(
-        size_t num_threads         ,
-        bool (*in_parallel)(void)  ,
-        size_t (*thread_num)(void) )
+        size_t num_threads                 ,
+        bool (*in_parallel)(void)          ,
+        size_t (*thread_num)(void)         ,
+        bool   cache_thread_num = false    )
     {
         // Special case where we go back to single thread mode right away
         // (previous settings may no longer be valid)
@@ -560,7 +724,7 @@ $end
             set_get_num_threads(num_threads);
             // emphasize that this routine is outside thread_alloc class
             CppAD::local::set_get_in_parallel(in_parallel, set);
-            set_get_thread_num(thread_num, set);
+            set_get_thread_num(thread_num, set, cache_thread_num);
         }
     }
 /*
@@ -731,6 +895,9 @@ $lnext
 The current $icode min_bytes$$ is between
 the previous $icode min_bytes$$ and previous $icode cap_bytes$$.
 $lend
+The time to determine $icode cap_bytes$$ does not depend on
+$icode min_bytes$$.
+See also $cref/cache_thread_num/ta_parallel_setup/cache_thread_num/$$.
 
 $head Alignment$$
 We call a memory allocation aligned if the address is a multiple
@@ -771,24 +938,23 @@ $end
             "get_memory(min_bytes, cap_bytes): min_bytes is too large"
         );
 
-        size_t num_cap = capacity_info()->number;
+        const capacity_t* capacity = capacity_info();
+        size_t num_cap = capacity->number;
         using std::cout;
         using std::endl;
 
         // determine the capacity for this request
-        size_t c_index   = 0;
-        const size_t* capacity_vec = capacity_info()->value;
-        while( capacity_vec[c_index] < min_bytes )
-        {   ++c_index;
-            CPPAD_ASSERT_UNKNOWN(c_index < num_cap );
-        }
-        cap_bytes = capacity_vec[c_index];
+        size_t c_index = capacity->capacity_index(min_bytes);
+        cap_bytes      = capacity->value[c_index];
 
         // determine the thread, capacity, and info for this thread
         size_t thread            = thread_num();
         size_t tc_index          = thread * num_cap + c_index;
         thread_alloc_info* info  = thread_info(thread);
 
+        // memory for this thread that other threads have returned
+        return_deferred(thread);
+
 # ifndef NDEBUG
         // trace allocation
         static bool first_trace = true;
@@ -903,6 +1069,17 @@ the corresponding call to $cref/get_memory/ta_get_memory/$$,
 or the current execution mode must be sequential
 (not $cref/parallel/ta_in_parallel/$$).
 
+$subhead C++11$$
+If C++11 is available, the memory can also be returned by
+a different thread while in parallel mode.
+In this case it is placed in a list (that can be used by multiple threads)
+and it is returned by the thread that allocated it
+during that thread's next call to $code get_memory$$ or
+$cref/free_available/ta_free_available/$$
+(or by $cref/free_all/ta_free_all/$$).
+Until then, it is still counted as $cref/inuse/ta_inuse/$$
+for the thread that allocated it.
+
 $head NDEBUG$$
 If $code NDEBUG$$ is defined, $icode v_ptr$$ is not checked (this is faster).
 Otherwise, a list of in use pointers is searched to make sure
@@ -939,11 +1116,28 @@ $end
         size_t capacity  = capacity_info()->value[c_index];
 
         CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
+# if CPPAD_USE_CPLUSPLUS_2011
+        if( in_parallel() )
+        {   if( thread != thread_num() )
+            {   // add node to the deferred list for the thread that owns it
+                std::atomic<void*>* root = deferred_root(thread);
+                void* v_node = reinterpret_cast<void*>(node);
+                void* head   = root->load(std::memory_order_relaxed);
+                do
+                    deferred_next(node) = head;
+                while( ! root->compare_exchange_weak( head, v_node,
+                    std::memory_order_release, std::memory_order_relaxed
+                ) );
+                return;
+            }
+        }
+# else
         CPPAD_ASSERT_KNOWN(
             thread == thread_num() || (! in_parallel()),
             "Attempt to return memory for a different thread "
             "while in parallel mode"
         );
+# endif
 
         thread_alloc_info* info = thread_info(thread);
 # ifndef NDEBUG
@@ -1061,6 +1255,9 @@ $end
             "while in parallel mode"
         );
 
+        // memory for this thread that other threads have returned
+        return_deferred(thread);
+
         size_t num_cap = capacity_info()->number;
         if( num_cap == 0 )
             return;
@@ -1497,7 +1694,8 @@ $end
         bool ok = true;
         size_t thread = CPPAD_MAX_NUM_THREADS;
         while(thread--)
-        {   ok &= inuse(thread) == 0;
+        {   return_deferred(thread);
+            ok &= inuse(thread) == 0;
             free_available(thread);
         }
         return ok;
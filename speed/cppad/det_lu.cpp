@@ -56,7 +56,7 @@ bool link_det_lu(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "optimize"};
+    const char* valid[] = { "memory", "optimize", "fast_eval"};
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -111,6 +111,8 @@ bool link_det_lu(
         f.Dependent(A, detA);
         if( global_option["optimize"] )
             f.optimize(optimize_options);
+        if( global_option["fast_eval"] )
+            f.prepare_fast_eval();
 
         // evaluate and return gradient using reverse mode
         f.Forward(0, matrix);
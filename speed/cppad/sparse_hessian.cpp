@@ -49,6 +49,9 @@ $srccode%cpp% */
 
 // Note that CppAD uses global_option["memory"] at the main program level
 # include <map>
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <thread>
+# endif
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
@@ -226,6 +229,22 @@ namespace {
         return;
     }
     // ------------------------------------------------------------------------
+    // number of threads used to evaluate the colors
+    size_t number_thread(void)
+    {   size_t n_thread = 1;
+# if CPPAD_USE_CPLUSPLUS_2011
+        if( global_option["multi_thread"] )
+        {   n_thread = size_t( std::thread::hardware_concurrency() );
+            n_thread = std::max<size_t>(n_thread, 1);
+            n_thread = std::min<size_t>(n_thread, CPPAD_MAX_NUM_THREADS);
+            //
+            // must be called before using more than one thread
+            CppAD::parallel_ad<double>();
+        }
+# endif
+        return n_thread;
+    }
+    // ------------------------------------------------------------------------
     size_t calc_hessian(
         d_vector&               hessian  ,
         const d_vector&         x        ,
@@ -243,10 +262,14 @@ namespace {
             std::string coloring = "cppad";
             if( global_option["colpack"] )
                 coloring = "colpack";
-            if( global_option["symmetric"] )
+            if( global_option["star"] )
+                coloring += ".star";
+            else if( global_option["symmetric"] )
                 coloring += ".symmetric";
             else
                 coloring += ".general";
+            if( global_option["smallest_last"] )
+                coloring += ".smallest_last";
             //
             // only one function component
             d_vector w(1);
@@ -254,7 +277,7 @@ namespace {
             //
             // compute hessian
             n_color = fun.sparse_hes(
-                x, w, subset, sparsity, coloring, hes_work
+                x, w, subset, sparsity, coloring, hes_work, number_thread()
             );
         }
         else
@@ -273,9 +296,12 @@ namespace {
                 if( global_option["colpack"] )
                     coloring = "colpack";
 # endif
+                if( global_option["smallest_last"] )
+                    coloring += ".smallest_last";
                 size_t group_max = 1;
                 n_color = fun.sparse_jac_for(
-                    group_max, x, subset, sparsity, coloring, jac_work
+                    group_max, x, subset, sparsity, coloring, jac_work,
+                    number_thread()
                 );
             }
         }
@@ -303,7 +329,8 @@ bool link_sparse_hessian(
     // check global options
     const char* valid[] = {
         "memory", "onetape", "optimize", "hes2jac", "subgraph",
-        "boolsparsity", "revsparsity", "symmetric"
+        "boolsparsity", "revsparsity", "symmetric", "multi_thread",
+        "smallest_last", "star"
 # if CPPAD_HAS_COLPACK
         , "colpack"
 # else
@@ -332,6 +359,19 @@ bool link_sparse_hessian(
     {   if( ! global_option["hes2jac"] )
             return false;
     }
+    // these orderings and colorings are only implemented for cppad coloring
+    if( global_option["smallest_last"] || global_option["star"] )
+    {   if( global_option["colpack"] )
+            return false;
+    }
+    // star coloring is only available when computing the Hessian directly
+    if( global_option["star"] )
+    {   if( global_option["symmetric"] || global_option["hes2jac"] )
+            return false;
+    }
+    // the cppad.symmetric method does not use an ordering
+    if( global_option["smallest_last"] && global_option["symmetric"] )
+        return false;
 # if ! CPPAD_HAS_COLPACK
     if( global_option["colpack"] )
         return false;
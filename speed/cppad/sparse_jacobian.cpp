@@ -44,6 +44,9 @@ $srccode%cpp% */
 
 // Note that CppAD uses global_option["memory"] at the main program level
 # include <map>
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <thread>
+# endif
 extern std::map<std::string, bool> global_option;
 // see comments in main program for this external
 extern size_t global_cppad_thread_alloc_inuse;
@@ -112,7 +115,8 @@ bool link_sparse_jacobian(
     // check global options
     const char* valid[] = {
         "memory", "onetape", "optimize", "subgraph",
-        "boolsparsity", "revsparsity", "subsparsity"
+        "boolsparsity", "revsparsity", "subsparsity", "multi_thread",
+        "smallest_last"
 # if CPPAD_HAS_COLPACK
         , "colpack"
 # endif
@@ -135,6 +139,8 @@ bool link_sparse_jacobian(
         ||  global_option["colpack"]  )
             return false;
     }
+    if( global_option["smallest_last"] && global_option["colpack"] )
+        return false;
     // ---------------------------------------------------------------------
     // optimization options: no conditional skips or compare operators
     std::string optimize_options =
@@ -171,6 +177,8 @@ bool link_sparse_jacobian(
     if( global_option["colpack"] )
         coloring = "colpack";
 # endif
+    if( global_option["smallest_last"] )
+        coloring += ".smallest_last";
     //
     // maximum number of colors at once
     //
@@ -179,6 +187,21 @@ bool link_sparse_jacobian(
     bool record_compare   = false;
     //
     size_t group_max = 25;
+    //
+    // number of threads used to evaluate the color groups
+    size_t n_thread = 1;
+# if CPPAD_USE_CPLUSPLUS_2011
+    if( global_option["multi_thread"] )
+    {   // one color per group so there are enough groups for all the threads
+        group_max = 1;
+        n_thread  = size_t( std::thread::hardware_concurrency() );
+        n_thread  = std::max<size_t>(n_thread, 1);
+        n_thread  = std::min<size_t>(n_thread, CPPAD_MAX_NUM_THREADS);
+        //
+        // must be called before using more than one thread
+        CppAD::parallel_ad<double>();
+    }
+# endif
     // ------------------------------------------------------
     if( ! global_option["onetape"] ) while(repeat--)
     {   // choose a value for x
@@ -217,7 +240,7 @@ bool link_sparse_jacobian(
             // calculate the Jacobian at this x
             // (use forward mode because m > n ?)
             n_color = f.sparse_jac_for(
-                group_max, x, subset, sparsity, coloring, work
+                group_max, x, subset, sparsity, coloring, work, n_thread
             );
         }
         for(size_t k = 0; k < nnz; k++)
@@ -264,7 +287,7 @@ bool link_sparse_jacobian(
             else
             {   // (use forward mode because m > n ?)
                 n_color = f.sparse_jac_for(
-                    group_max, x, subset, sparsity, coloring, work
+                    group_max, x, subset, sparsity, coloring, work, n_thread
                 );
             }
             for(size_t k = 0; k < nnz; k++)
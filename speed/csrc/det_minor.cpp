@@ -0,0 +1,124 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin csrc_det_minor.cpp$$
+$spell
+    csrc
+    onetape
+    cfun
+$$
+
+$section Csrc Speed: Gradient of Determinant by Minor Expansion$$
+
+$head Specifications$$
+See $cref link_det_minor$$.
+
+$head Implementation$$
+The function is compiled using $cref csrc_fun$$
+the first time this routine is called with a new $icode size$$.
+
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cppad/core/csrc_fun.hpp>
+# include <cppad/speed/det_by_minor.hpp>
+# include <cppad/speed/uniform_01.hpp>
+
+# include <map>
+extern std::map<std::string, bool> global_option;
+
+namespace {
+    // compiled version of the determinant for the previous size
+    CppAD::csrc_fun* previous_cfun = CPPAD_NULL;
+    size_t           previous_size = 0;
+}
+
+bool link_det_minor(
+    size_t                     size     ,
+    size_t                     repeat   ,
+    CppAD::vector<double>     &matrix   ,
+    CppAD::vector<double>     &gradient )
+{   assert( matrix.size() == size * size );
+    assert( gradient.size() == size * size );
+    // --------------------------------------------------------------------
+    // check global options
+    const char* valid[] = { "onetape", "optimize"};
+    size_t n_valid = sizeof(valid) / sizeof(valid[0]);
+    typedef std::map<std::string, bool>::iterator iterator;
+    //
+    for(iterator itr=global_option.begin(); itr!=global_option.end(); ++itr)
+    {   if( itr->second )
+        {   bool ok = false;
+            for(size_t i = 0; i < n_valid; i++)
+                ok |= itr->first == valid[i];
+            if( ! ok )
+                return false;
+        }
+    }
+    if( ! global_option["onetape"] )
+        return false;
+    // --------------------------------------------------------------------
+    // optimization options: no conditional skips or compare operators
+    std::string optimize_options =
+        "no_conditional_skip no_compare_op no_print_for_op";
+    // -----------------------------------------------------
+    // setup
+    size_t n = size * size; // number of independent variables
+    if( size != previous_size )
+    {   typedef CppAD::AD<double>       a_double;
+        typedef CppAD::vector<a_double> a_vector;
+        //
+        // choose a matrix
+        CppAD::uniform_01(n, matrix);
+        a_vector a_A(n), a_detA(1);
+        for(size_t j = 0; j < n; ++j)
+            a_A[j] = matrix[j];
+        //
+        // do not even record comparison operators
+        size_t abort_op_index = 0;
+        bool record_compare   = false;
+        CppAD::Independent(a_A, abort_op_index, record_compare);
+        //
+        // AD computation of the determinant
+        CppAD::det_by_minor<a_double> a_det(size);
+        a_detA[0] = a_det(a_A);
+        //
+        // create function object f : A -> detA
+        CppAD::ADFun<double> f(a_A, a_detA);
+        if( global_option["optimize"] )
+            f.optimize(optimize_options);
+        //
+        // compile f and its gradient
+        delete previous_cfun;
+        previous_cfun = new CppAD::csrc_fun(
+            "csrc_det_minor", f, matrix, "reverse_one"
+        );
+        previous_size = size;
+    }
+    // vectors of reverse mode weights
+    CppAD::vector<double> w(1);
+    w[0] = 1.;
+    // ------------------------------------------------------
+    while(repeat--)
+    {   // get the next matrix
+        CppAD::uniform_01(n, matrix);
+
+        // evaluate the determinant at the new matrix value
+        previous_cfun->Forward(0, matrix);
+
+        // evaluate and return gradient using reverse mode
+        gradient = previous_cfun->Reverse(1, w);
+    }
+    return true;
+}
+/* %$$
+$end
+*/
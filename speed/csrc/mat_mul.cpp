@@ -0,0 +1,42 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin csrc_mat_mul.cpp$$
+$spell
+    csrc
+$$
+
+$section Csrc Speed: Matrix Multiplication$$
+
+
+$head Specifications$$
+$cref link_mat_mul$$
+
+$head Implementation$$
+// a csrc version of this test is not yet implemented
+$srccode%cpp% */
+# include <map>
+# include <cppad/utility/vector.hpp>
+
+// list of possible options
+extern std::map<std::string, bool> global_option;
+
+bool link_mat_mul(
+    size_t                           size     ,
+    size_t                           repeat   ,
+    CppAD::vector<double>&           x        ,
+    CppAD::vector<double>&           z        ,
+    CppAD::vector<double>&           dz       )
+{   return false; }
+/* %$$
+$end
+*/
@@ -0,0 +1,128 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin csrc_ode.cpp$$
+$spell
+    csrc
+    onetape
+    cfun
+$$
+
+$section Csrc Speed: Gradient of Ode Solution$$
+
+$head Specifications$$
+See $cref link_ode$$.
+
+$head Implementation$$
+The function is compiled using $cref csrc_fun$$
+the first time this routine is called with a new $icode size$$.
+The Jacobian is computed using $icode%cfun%.sparse_jac%$$.
+
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cppad/core/csrc_fun.hpp>
+# include <cppad/speed/ode_evaluate.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include <cassert>
+
+# include <map>
+extern std::map<std::string, bool> global_option;
+
+namespace {
+    // compiled version of the ode solution for the previous size
+    CppAD::csrc_fun* previous_cfun = CPPAD_NULL;
+    size_t           previous_size = 0;
+}
+
+bool link_ode(
+    size_t                     size       ,
+    size_t                     repeat     ,
+    CppAD::vector<double>      &x         ,
+    CppAD::vector<double>      &jacobian
+)
+{   // --------------------------------------------------------------------
+    // check global options
+    const char* valid[] = { "onetape", "optimize"};
+    size_t n_valid = sizeof(valid) / sizeof(valid[0]);
+    typedef std::map<std::string, bool>::iterator iterator;
+    //
+    for(iterator itr=global_option.begin(); itr!=global_option.end(); ++itr)
+    {   if( itr->second )
+        {   bool ok = false;
+            for(size_t i = 0; i < n_valid; i++)
+                ok |= itr->first == valid[i];
+            if( ! ok )
+                return false;
+        }
+    }
+    if( ! global_option["onetape"] )
+        return false;
+    // --------------------------------------------------------------------
+    // optimization options: no conditional skips or compare operators
+    std::string optimize_options =
+        "no_conditional_skip no_compare_op no_print_for_op";
+    // --------------------------------------------------------------------
+    // setup
+    assert( x.size() == size );
+    assert( jacobian.size() == size * size );
+    size_t n = size;           // number of independent variables
+    size_t m = n;              // number of dependent variables
+    if( size != previous_size )
+    {   typedef CppAD::AD<double>       a_double;
+        typedef CppAD::vector<a_double> a_vector;
+        //
+        // an x value
+        CppAD::uniform_01(n, x);
+        a_vector a_x(n), a_y(m);
+        for(size_t j = 0; j < n; j++)
+            a_x[j] = x[j];
+        //
+        // do not even record comparison operators
+        size_t abort_op_index = 0;
+        bool record_compare   = false;
+        CppAD::Independent(a_x, abort_op_index, record_compare);
+        //
+        // evaluate function
+        size_t p = 0; // use ode to calculate function values
+        CppAD::ode_evaluate(a_x, p, a_y);
+        //
+        // create function object f : x -> y
+        CppAD::ADFun<double> f(a_x, a_y);
+        if( global_option["optimize"] )
+            f.optimize(optimize_options);
+        //
+        // compile f and its sparse Jacobian
+        delete previous_cfun;
+        previous_cfun = new CppAD::csrc_fun("csrc_ode", f, x, "sparse_jac");
+        previous_size = size;
+    }
+    typedef CppAD::sparse_rc< std::vector<size_t> > sparse_rc;
+    const sparse_rc& pattern = previous_cfun->jac_pattern();
+    size_t nnz = pattern.nnz();
+    CppAD::vector<double> val(nnz);
+    // -------------------------------------------------------------
+    while(repeat--)
+    {   // get next argument value
+        CppAD::uniform_01(n, x);
+
+        // evaluate the non-zero elements of the jacobian
+        previous_cfun->sparse_jac(x, val);
+        for(size_t k = 0; k < n * m; ++k)
+            jacobian[k] = 0.0;
+        for(size_t k = 0; k < nnz; ++k)
+            jacobian[ pattern.row()[k] * n + pattern.col()[k] ] = val[k];
+    }
+    return true;
+}
+/* %$$
+$end
+*/
@@ -0,0 +1,157 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin csrc_sparse_jacobian.cpp$$
+$spell
+    csrc
+    onetape
+    cfun
+    jac
+$$
+
+$section Csrc Speed: Sparse Jacobian$$
+
+$head Specifications$$
+See $cref link_sparse_jacobian$$.
+
+$head Implementation$$
+The function is compiled using $cref csrc_fun$$
+the first time this routine is called with a new $icode size$$.
+The Jacobian is computed using $icode%cfun%.sparse_jac%$$
+and its values are then placed in the order specified by
+$icode row$$ and $icode col$$.
+
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cppad/core/csrc_fun.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include <cppad/speed/sparse_jac_fun.hpp>
+
+# include <map>
+extern std::map<std::string, bool> global_option;
+
+namespace {
+    // compiled version of the function for the previous size
+    CppAD::csrc_fun* previous_cfun = CPPAD_NULL;
+    size_t           previous_size = 0;
+    //
+    // index in cfun.jac_pattern() corresponding to (row[k], col[k])
+    // (equal to nnz if (row[k], col[k]) is not in the pattern)
+    std::vector<size_t> previous_index;
+}
+
+bool link_sparse_jacobian(
+    size_t                           size     ,
+    size_t                           repeat   ,
+    size_t                           m        ,
+    const CppAD::vector<size_t>&     row      ,
+    const CppAD::vector<size_t>&     col      ,
+          CppAD::vector<double>&     x        ,
+          CppAD::vector<double>&     jacobian ,
+          size_t&                    n_color  )
+{   // --------------------------------------------------------------------
+    // check global options
+    const char* valid[] = { "onetape", "optimize"};
+    size_t n_valid = sizeof(valid) / sizeof(valid[0]);
+    typedef std::map<std::string, bool>::iterator iterator;
+    //
+    for(iterator itr=global_option.begin(); itr!=global_option.end(); ++itr)
+    {   if( itr->second )
+        {   bool ok = false;
+            for(size_t i = 0; i < n_valid; i++)
+                ok |= itr->first == valid[i];
+            if( ! ok )
+                return false;
+        }
+    }
+    if( ! global_option["onetape"] )
+        return false;
+    // --------------------------------------------------------------------
+    // optimization options: no conditional skips or compare operators
+    std::string optimize_options =
+        "no_conditional_skip no_compare_op no_print_for_op";
+    // --------------------------------------------------------------------
+    // setup
+    size_t n   = size;
+    size_t K   = row.size();
+    typedef CppAD::sparse_rc< std::vector<size_t> > sparse_rc;
+    if( size != previous_size )
+    {   typedef CppAD::AD<double>       a_double;
+        typedef CppAD::vector<a_double> a_vector;
+        //
+        // choose a value for x
+        CppAD::uniform_01(n, x);
+        a_vector a_x(n), a_y(m);
+        for(size_t j = 0; j < n; j++)
+            a_x[j] = x[j];
+        //
+        // do not even record comparison operators
+        size_t abort_op_index = 0;
+        bool record_compare   = false;
+        CppAD::Independent(a_x, abort_op_index, record_compare);
+        //
+        // AD computation of f(x)
+        size_t order = 0;
+        CppAD::sparse_jac_fun<a_double>(m, n, a_x, row, col, order, a_y);
+        //
+        // create function object f : x -> y
+        CppAD::ADFun<double> f(a_x, a_y);
+        if( global_option["optimize"] )
+            f.optimize(optimize_options);
+        //
+        // compile f and its sparse Jacobian
+        delete previous_cfun;
+        previous_cfun = new CppAD::csrc_fun(
+            "csrc_sparse_jacobian", f, x, "sparse_jac"
+        );
+        previous_size = size;
+        //
+        // map from (row[k], col[k]) to index in the pattern
+        const sparse_rc& pattern = previous_cfun->jac_pattern();
+        size_t nnz = pattern.nnz();
+        std::map<size_t, size_t> pattern_index;
+        for(size_t ell = 0; ell < nnz; ++ell)
+            pattern_index[ pattern.row()[ell] * n + pattern.col()[ell] ] = ell;
+        previous_index.resize(K);
+        for(size_t k = 0; k < K; ++k)
+        {   std::map<size_t, size_t>::iterator itr =
+                pattern_index.find( row[k] * n + col[k] );
+            if( itr == pattern_index.end() )
+                previous_index[k] = nnz;
+            else
+                previous_index[k] = itr->second;
+        }
+    }
+    const sparse_rc& pattern = previous_cfun->jac_pattern();
+    size_t nnz = pattern.nnz();
+    CppAD::vector<double> val(nnz);
+    // -------------------------------------------------------------
+    while(repeat--)
+    {   // choose a value for x
+        CppAD::uniform_01(n, x);
+        //
+        // evaluate the non-zero elements of the Jacobian
+        previous_cfun->sparse_jac(x, val);
+        for(size_t k = 0; k < K; ++k)
+        {   if( previous_index[k] == nnz )
+                jacobian[k] = 0.0;
+            else
+                jacobian[k] = val[ previous_index[k] ];
+        }
+    }
+    // no coloring is used for the compiled Jacobian
+    n_color = 0;
+    return true;
+}
+/* %$$
+$end
+*/
@@ -32,6 +32,9 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # ifdef CPPAD_CPPAD_SPEED
 # define AD_PACKAGE "cppad"
 # endif
+# ifdef CPPAD_CSRC_SPEED
+# define AD_PACKAGE "csrc"
+# endif
 # ifdef CPPAD_DOUBLE_SPEED
 # define AD_PACKAGE "double"
 # endif
@@ -81,6 +84,7 @@ $spell
     lu
     Jacobian
     cppadcg
+    csrc
 $$
 
 
@@ -103,7 +107,8 @@ $cref/adolc/speed_adolc/$$,
 $cref/cppad/speed_cppad/$$,
 $cref/fadbad/speed_fadbad/$$,
 $cref/sacado/speed_sacado/$$,
-$cref/cppadcg/speed_cppadcg/$$.
+$cref/cppadcg/speed_cppadcg/$$,
+$cref/csrc/speed_csrc/$$.
 You can extend this program to include other package;
 see $cref speed_xpackage$$.
 
@@ -215,6 +220,17 @@ If it is false, this optimization will not be done.
 Note that this option is usually slower unless it is combined with the
 $code onetape$$ option.
 
+$subhead fast_eval$$
+If this option is present,
+CppAD will call $cref prepare_fast_eval$$
+after the operation sequence is recorded (and optimized).
+So far, CppAD has only implemented
+the $cref/det_lu/link_det_lu/$$,
+$cref/ode/link_ode/$$, and
+$cref/poly/link_poly/$$ tests with this option.
+As with $code optimize$$, this option is usually slower unless it is
+combined with the $code onetape$$ option.
+
 $subhead atomic$$
 If this option is present,
 CppAD will use a user defined
@@ -240,6 +256,17 @@ test is implemented for this option.
 In addition, the CppAD $cref/sparse_hessian/link_sparse_hessian/$$
 test is implemented for this option when $code hes2jac$$ is present.
 
+$subhead multi_thread$$
+If this option is present,
+$cref speed_cppad$$ will use the
+$cref/n_thread/sparse_jac/n_thread/$$ argument to evaluate the
+colors for sparse Jacobians and Hessians using multiple threads.
+The number of threads is the number of concurrent threads
+supported by the hardware.
+So far, CppAD has only implemented
+the $cref/sparse_jacobian/link_sparse_jacobian/$$ and
+$cref/sparse_hessian/link_sparse_hessian/$$ tests with this option.
+
 $head Sparsity Options$$
 The following options only apply to the
 $cref/sparse_jacobian/link_sparse_jacobian/$$ and
@@ -281,6 +308,25 @@ The CppAD
 $cref/sparse_hessian/link_sparse_hessian/$$ test
 is implemented for this option.
 
+$subhead smallest_last$$
+If this option is present, CppAD will color the rows or columns
+in smallest last $cref/order/sparse_jac/coloring/Ordering/$$.
+Otherwise, it will color them in their natural order.
+The CppAD
+$cref/sparse_jacobian/link_sparse_jacobian/$$ and
+$cref/sparse_hessian/link_sparse_hessian/$$ tests
+are implemented for this option.
+
+$subhead star$$
+If this option is present, CppAD will use the
+$cref/cppad.star/sparse_hes/coloring/cppad.star/$$ coloring
+when computing sparse Hessians.
+The CppAD
+$cref/sparse_hessian/link_sparse_hessian/$$ test
+is implemented for this option.
+The number of colors for these options is reported by the
+$cref/n_color/speed_main/Speed Results/n_color/$$ output.
+
 $head Correctness Results$$
 One, but not both, of the following two output lines
 $codei%
@@ -409,14 +455,18 @@ namespace {
         "memory",
         "onetape",
         "optimize",
+        "fast_eval",
         "atomic",
         "hes2jac",
         "subgraph",
+        "multi_thread",
         "boolsparsity",
         "revsparsity",
         "subsparsity",
         "colpack",
-        "symmetric"
+        "symmetric",
+        "smallest_last",
+        "star"
     };
     size_t num_option = sizeof(option_list) / sizeof( option_list[0] );
     // ----------------------------------------------------------------
@@ -510,6 +560,10 @@ namespace {
                 cout << ", ";
             cout << std::flush;
             size_t size = size_vec[i];
+# ifdef CPPAD_CSRC_SPEED
+            // compile the source code for this size before timing
+            speed_case(size, 1);
+# endif
             double time = CppAD::time_test(speed_case, time_min, size);
             double rate = 1. / time;
             if( rate >= 1000 )
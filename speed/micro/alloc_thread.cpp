@@ -0,0 +1,222 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_alloc_thread.cpp$$
+$spell
+    alloc
+    num
+$$
+
+$section Speed Test of thread_alloc Using Multiple Threads$$
+
+$head Purpose$$
+Measures the rate at which $cref thread_alloc$$ can allocate and
+return memory when multiple threads use it at the same time.
+Each size is the number of threads,
+$cref/hold_memory/ta_hold_memory/$$ is true, and
+$cref/cache_thread_num/ta_parallel_setup/cache_thread_num/$$ is true.
+The rates are the number of allocations per second for each thread.
+
+$head Cases$$
+$table
+$code same$$ $cnext
+    each thread allocates a block of memory and then returns it
+$rnext
+$code cross$$ $cnext
+    each thread allocates a set of blocks, then each thread returns
+    the blocks allocated by another thread
+    (if there is only one thread, it returns its own blocks)
+$tend
+The sizes of the blocks vary between 8 and 8000 bytes.
+If C++11 is not available, only one thread is used for every size.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <vector>
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <thread>
+# endif
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    using CppAD::thread_alloc;
+    //
+    // number of allocations per thread per repeat
+    const size_t n_alloc_ = 10000;
+    //
+    // blocks allocated by each thread (for the cross case)
+    std::vector< std::vector<void*> > block_;
+    //
+    // thread_alloc in_parallel and thread_num routines
+    bool in_parallel_ = false;
+    bool in_parallel(void)
+    {   return in_parallel_; }
+# if CPPAD_USE_CPLUSPLUS_2011
+    size_t& thread_index(void)
+    {   static thread_local size_t index = 0;
+        return index;
+    }
+# else
+    size_t& thread_index(void)
+    {   static size_t index = 0;
+        return index;
+    }
+# endif
+    size_t thread_num(void)
+    {   return thread_index(); }
+    //
+    // number of bytes for the k-th allocation
+    size_t num_bytes(size_t k)
+    {   return 8 + (k * 997) % 7993; }
+    //
+    // work done by each thread
+    void work_same(size_t thread)
+    {   thread_index() = thread;
+        size_t cap_bytes;
+        for(size_t k = 0; k < n_alloc_; ++k)
+        {   void* v_ptr = thread_alloc::get_memory(num_bytes(k), cap_bytes);
+            thread_alloc::return_memory(v_ptr);
+        }
+    }
+    void work_get(size_t thread)
+    {   thread_index() = thread;
+        size_t cap_bytes;
+        std::vector<void*>& block( block_[thread] );
+        for(size_t k = 0; k < n_alloc_; ++k)
+            block[k] = thread_alloc::get_memory(num_bytes(k), cap_bytes);
+    }
+    void work_return(size_t thread)
+    {   thread_index() = thread;
+        size_t other = (thread + 1) % block_.size();
+        std::vector<void*>& block( block_[other] );
+        for(size_t k = 0; k < n_alloc_; ++k)
+            thread_alloc::return_memory( block[k] );
+    }
+    //
+    // run work(thread) for thread = 0, ..., n_thread-1
+    void run(size_t n_thread, void (*work)(size_t) )
+    {
+# if CPPAD_USE_CPLUSPLUS_2011
+        in_parallel_ = true;
+        std::vector<std::thread> team;
+        for(size_t thread = 0; thread < n_thread; ++thread)
+            team.push_back( std::thread(work, thread) );
+        for(size_t thread = 0; thread < n_thread; ++thread)
+            team[thread].join();
+        in_parallel_ = false;
+# else
+        work(0);
+# endif
+    }
+    //
+    // set up and terminate thread_alloc for n_thread threads
+    void setup(size_t n_thread)
+    {
+# if ! CPPAD_USE_CPLUSPLUS_2011
+        if( n_thread > 1 )
+            n_thread = 1;
+# endif
+        if( n_thread == 0 )
+        {   thread_alloc::parallel_setup(1, CPPAD_NULL, CPPAD_NULL);
+            thread_alloc::hold_memory(false);
+            thread_alloc::free_all();
+            block_.clear();
+            return;
+        }
+        thread_index() = 0;
+        bool cache_thread_num = true;
+        thread_alloc::parallel_setup(
+            n_thread, in_parallel, thread_num, cache_thread_num
+        );
+        thread_alloc::hold_memory(true);
+        block_.resize(n_thread);
+        for(size_t thread = 0; thread < n_thread; ++thread)
+            block_[thread].resize(n_alloc_);
+    }
+    void time_same(size_t size, size_t repeat)
+    {   setup(size);
+        while(repeat--)
+            run(block_.size(), work_same);
+        setup(0);
+    }
+    void time_cross(size_t size, size_t repeat)
+    {   setup(size);
+        while(repeat--)
+        {   run(block_.size(), work_get);
+            run(block_.size(), work_return);
+        }
+        setup(0);
+    }
+}
+
+bool alloc_thread(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 1;
+    size_vec[1] = 2;
+    size_vec[2] = 4;
+    //
+    // check correctness: the memory returned by other threads is
+    // available to the thread that allocated it
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   setup( size_vec[i] );
+        size_t n_thread = block_.size();
+        // memory in use before the test (e.g., size_vec uses thread zero)
+        std::vector<size_t> inuse(n_thread);
+        for(size_t thread = 0; thread < n_thread; ++thread)
+            inuse[thread] = thread_alloc::inuse(thread);
+        run(n_thread, work_get);
+        for(size_t thread = 0; thread < n_thread; ++thread)
+            ok &= thread_alloc::inuse(thread) > inuse[thread];
+        run(n_thread, work_return);
+        for(size_t thread = 0; thread < n_thread; ++thread)
+        {   thread_alloc::free_available(thread);
+            ok &= thread_alloc::inuse(thread) == inuse[thread];
+            ok &= thread_alloc::available(thread) == 0;
+        }
+        setup(0);
+    }
+    //
+    // rates
+    vector<double> rate_same( size_vec.size() );
+    vector<double> rate_cross( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size   = size_vec[i];
+        double time   = CppAD::time_test(time_same, time_min, size);
+        rate_same[i]  = double(n_alloc_) / time;
+        time          = CppAD::time_test(time_cross, time_min, size);
+        rate_cross[i] = double(n_alloc_) / time;
+    }
+    micro_output_size("alloc_thread", size_vec);
+    micro_output_rate("alloc_thread", "same", rate_same);
+    micro_output_rate("alloc_thread", "cross", rate_cross);
+    //
+    return ok;
+}
+// END C++
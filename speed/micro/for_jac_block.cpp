@@ -0,0 +1,158 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_for_jac_block.cpp$$
+$spell
+    jac
+    bool
+$$
+
+$section Speed Test of Blocked Forward Jacobian Sparsity$$
+
+$head Purpose$$
+Compares the rate for computing the sparsity pattern of a Jacobian
+using $cref for_jac_sparsity$$ with $icode internal_bool$$ true
+and different values of
+$cref/block_bits/for_jac_sparsity/block_bits/$$.
+The function has $icode size$$ independent and dependent variables and
+each dependent variable is a sum of products of ten independent variables;
+i.e., there are about $codei%20 * %size%$$ variables in the tape.
+The rates are the number of sparsity patterns per second.
+
+$head Cases$$
+$table
+$code full$$ $cnext
+    one sweep with the pattern for all $icode size$$ columns
+$rnext
+$code block_256$$ $cnext
+    a sweep for each block of 256 columns
+$rnext
+$code block_512$$ $cnext
+    a sweep for each block of 512 columns
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double>            a_double;
+    typedef CppAD::sparse_rc< vector<size_t> > sparsity;
+    //
+    // function and block size used by time_block
+    CppAD::ADFun<double> f_;
+    size_t               block_bits_;
+    //
+    // sparsity pattern for the identity matrix
+    void identity(size_t n, sparsity& pattern)
+    {   pattern.resize(n, n, n);
+        for(size_t k = 0; k < n; ++k)
+            pattern.set(k, k, k);
+    }
+    //
+    void setup(size_t size)
+    {   size_t n = size;
+        vector<a_double> ax(n), ay(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 1.0;
+        CppAD::Independent(ax);
+        for(size_t i = 0; i < n; ++i)
+        {   ay[i] = 0.0;
+            for(size_t k = 0; k < 10; ++k)
+                ay[i] += ax[ (i * 7 + k * 131) % n ] * ax[ (i + k) % n ];
+        }
+        f_.Dependent(ax, ay);
+    }
+    void time_block(size_t size, size_t repeat)
+    {   bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = true;
+        sparsity pattern_in, pattern_out;
+        identity(size, pattern_in);
+        while(repeat--)
+        {   f_.for_jac_sparsity(
+                pattern_in, transpose, dependency, internal_bool, pattern_out,
+                block_bits_
+            );
+        }
+    }
+}
+
+bool for_jac_block(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 1024;
+    size_vec[1] = 4096;
+    size_vec[2] = 8192;
+    //
+    // block sizes for each case
+    const char* name[] = { "full", "block_256", "block_512" };
+    size_t      bits[] = { 0,      256,         512         };
+    size_t n_case = sizeof(bits) / sizeof(bits[0]);
+    //
+    vector< vector<double> > rate(n_case);
+    for(size_t c = 0; c < n_case; ++c)
+        rate[c].resize( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        setup(size);
+        //
+        // check that the blocked pattern is the same as the full pattern
+        bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = true;
+        sparsity pattern_in, full, block;
+        identity(size, pattern_in);
+        f_.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, full
+        );
+        f_.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, block, 256
+        );
+        ok &= full.nnz() == block.nnz();
+        for(size_t k = 0; k < full.nnz() && ok; ++k)
+        {   ok &= full.row()[k] == block.row()[k];
+            ok &= full.col()[k] == block.col()[k];
+        }
+        //
+        for(size_t c = 0; c < n_case; ++c)
+        {   block_bits_ = bits[c];
+            rate[c][i]  = 1.0 / CppAD::time_test(time_block, time_min, size);
+        }
+    }
+    micro_output_size("for_jac_block", size_vec);
+    for(size_t c = 0; c < n_case; ++c)
+        micro_output_rate("for_jac_block", name[c], rate[c]);
+    //
+    // free memory used by this test
+    f_ = CppAD::ADFun<double>();
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,156 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_forward_batch.cpp$$
+$spell
+    det
+$$
+
+$section Speed Test of Zero Order Forward at Multiple Points$$
+
+$head Purpose$$
+Compares the time for $cref forward_batch$$ with the time for
+the corresponding loop over $cref/f.Forward(0, x)/forward_zero/$$.
+The function is the determinant of a matrix computed using
+$cref det_by_minor$$ and each size is the number of rows in the matrix.
+The rates are the number of points evaluated per second.
+
+$head Cases$$
+$table
+$code loop$$ $cnext
+    a loop over the points with one call to $code Forward(0, x)$$ each
+$rnext
+$code batch$$ $cnext
+    one call to $code forward_batch(N, xN)$$ for all the points
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/speed/det_by_minor.hpp>
+# include <cppad/speed/uniform_01.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    //
+    // number of points
+    const size_t N_ = 64;
+    //
+    // function object, points, and size corresponding to previous setup
+    CppAD::ADFun<double> f_;
+    vector<double>       xN_;
+    size_t               size_ = 0;
+    //
+    void setup(size_t size)
+    {   if( size == size_ )
+            return;
+        size_ = size;
+        if( size == 0 )
+        {   f_    = CppAD::ADFun<double>();
+            xN_.clear();
+            return;
+        }
+        // record the determinant function
+        size_t n = size * size;
+        vector< CppAD::AD<double> > ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        CppAD::det_by_minor< CppAD::AD<double> > det(size);
+        ay[0] = det(ax);
+        f_.Dependent(ax, ay);
+        //
+        // xN_[ N * j + k ] is j-th component of k-th point
+        xN_.resize(N_ * n);
+        CppAD::uniform_01(N_ * n, xN_);
+    }
+    // loop over Forward(0, x)
+    void time_loop(size_t size, size_t repeat)
+    {   setup(size);
+        size_t n = size * size;
+        vector<double> x(n), y(1);
+        while(repeat--)
+        {   for(size_t k = 0; k < N_; ++k)
+            {   for(size_t j = 0; j < n; ++j)
+                    x[j] = xN_[ N_ * j + k ];
+                y = f_.Forward(0, x);
+            }
+        }
+    }
+    // one call to forward_batch
+    void time_batch(size_t size, size_t repeat)
+    {   setup(size);
+        vector<double> yN(N_);
+        while(repeat--)
+            yN = f_.forward_batch(N_, xN_);
+    }
+}
+
+bool forward_batch(double time_min)
+{   bool ok = true;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 3;
+    size_vec[1] = 4;
+    size_vec[2] = 5;
+    //
+    // check correctness
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        size_t n    = size * size;
+        setup(size);
+        vector<double> x(n), y(1), yN(N_);
+        yN = f_.forward_batch(N_, xN_);
+        for(size_t k = 0; k < N_; ++k)
+        {   for(size_t j = 0; j < n; ++j)
+                x[j] = xN_[ N_ * j + k ];
+            y   = f_.Forward(0, x);
+            ok &= CppAD::NearEqual(yN[k], y[0], eps99, eps99);
+        }
+    }
+    //
+    // rates
+    vector<double> rate_loop( size_vec.size() );
+    vector<double> rate_batch( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size   = size_vec[i];
+        double time   = CppAD::time_test(time_loop, time_min, size);
+        rate_loop[i]  = double(N_) / time;
+        time          = CppAD::time_test(time_batch, time_min, size);
+        rate_batch[i] = double(N_) / time;
+    }
+    micro_output_size("forward_batch", size_vec);
+    micro_output_rate("forward_batch", "loop", rate_loop);
+    micro_output_rate("forward_batch", "batch", rate_batch);
+    //
+    // free static memory
+    setup(0);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,177 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_forward_dir.cpp$$
+$spell
+    det
+    jac
+$$
+
+$section Speed Test of First Order Forward in Multiple Directions$$
+
+$head Purpose$$
+Measures the time for
+$cref/f.Forward(1, r, xq)/forward_dir/$$ as the number of directions
+$icode r$$ grows.
+Each size is the number of directions $icode r$$
+and the rates are the number of directions per second; i.e.,
+$icode r$$ divided by the time for one call to $code Forward$$.
+The results for each direction are checked against a call to
+$code Forward(1, dx)$$ with the corresponding direction.
+
+$head Cases$$
+$table
+$code det_minor$$ $cnext
+    the determinant of a $icode%5% x %5%$$ matrix computed using
+    $cref det_by_minor$$
+$rnext
+$code sparse_jac$$ $cnext
+    the function $cref sparse_jac_fun$$ with 100 components in its
+    domain and range and three non-zeros in each row of its Jacobian
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/speed/det_by_minor.hpp>
+# include <cppad/speed/sparse_jac_fun.hpp>
+# include <cppad/speed/uniform_01.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // record the determinant of a 5 by 5 matrix
+    void record_det_minor(CppAD::ADFun<double>& f)
+    {   size_t size = 5;
+        size_t n    = size * size;
+        vector<a_double> ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        CppAD::det_by_minor<a_double> det(size);
+        ay[0] = det(ax);
+        f.Dependent(ax, ay);
+    }
+    // record a function with a sparse Jacobian
+    void record_sparse_jac(CppAD::ADFun<double>& f)
+    {   size_t n = 100, m = 100, K = 3 * m;
+        vector<size_t> row(K), col(K);
+        for(size_t k = 0; k < K; ++k)
+        {   row[k] = k % m;
+            col[k] = (7 * k + k / m) % n;
+        }
+        vector<a_double> ax(n), ay(m);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        size_t p = 0;
+        CppAD::sparse_jac_fun<a_double>(m, n, ax, row, col, p, ay);
+        f.Dependent(ax, ay);
+    }
+    //
+    // function, and direction vectors, for the current case
+    CppAD::ADFun<double> f_;
+    vector<double>       xq_;
+    //
+    // set up f_ and xq_ for r directions
+    void setup(size_t r)
+    {   size_t n = f_.Domain();
+        vector<double> x(n);
+        CppAD::uniform_01(n, x);
+        f_.Forward(0, x);
+        xq_.resize(n * r);
+        CppAD::uniform_01(n * r, xq_);
+    }
+    // time Forward(1, r, xq)
+    void time_dir(size_t r, size_t repeat)
+    {   setup(r);
+        vector<double> yq;
+        while(repeat--)
+            yq = f_.Forward(1, r, xq_);
+    }
+    // check Forward(1, r, xq) for the current case
+    bool check(size_t r)
+    {   bool ok = true;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        setup(r);
+        size_t n = f_.Domain();
+        size_t m = f_.Range();
+        vector<double> yq = f_.Forward(1, r, xq_);
+        vector<double> dx(n), dy(m);
+        for(size_t ell = 0; ell < r; ++ell)
+        {   for(size_t j = 0; j < n; ++j)
+                dx[j] = xq_[ j * r + ell ];
+            dy = f_.Forward(1, dx);
+            for(size_t i = 0; i < m; ++i)
+                ok &= CppAD::NearEqual(yq[i * r + ell], dy[i], eps99, eps99);
+        }
+        return ok;
+    }
+    // rates for the current case
+    bool compute_rate(
+        const vector<size_t>& size_vec, double time_min, vector<double>& rate)
+    {   bool ok = true;
+        for(size_t i = 0; i < size_vec.size(); ++i)
+        {   size_t r = size_vec[i];
+            ok      &= check(r);
+            rate[i]  = double(r) / CppAD::time_test(time_dir, time_min, r);
+        }
+        return ok;
+    }
+}
+
+bool forward_dir(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(4);
+    size_vec[0] = 1;
+    size_vec[1] = 4;
+    size_vec[2] = 16;
+    size_vec[3] = 64;
+    //
+    // det_minor
+    vector<double> rate_det_minor( size_vec.size() );
+    record_det_minor(f_);
+    ok &= compute_rate(size_vec, time_min, rate_det_minor);
+    //
+    // sparse_jac
+    vector<double> rate_sparse_jac( size_vec.size() );
+    record_sparse_jac(f_);
+    ok &= compute_rate(size_vec, time_min, rate_sparse_jac);
+    //
+    micro_output_size("forward_dir", size_vec);
+    micro_output_rate("forward_dir", "det_minor", rate_det_minor);
+    micro_output_rate("forward_dir", "sparse_jac", rate_sparse_jac);
+    //
+    // free static memory
+    f_ = CppAD::ADFun<double>();
+    xq_.clear();
+    //
+    return ok;
+}
+// END C++
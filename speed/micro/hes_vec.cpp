@@ -0,0 +1,172 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_hes_vec.cpp$$
+$spell
+    det
+    vec
+$$
+
+$section Speed Test of Hessian Times Vector Products$$
+
+$head Purpose$$
+Compares the rate for Hessian times vector products at a fixed
+argument value, as in the inner iterations of a truncated Newton method.
+The function is the determinant of a $icode%size% x %size%$$ matrix
+computed using $cref det_by_minor$$.
+The rates are the number of products per second.
+
+$head Cases$$
+$table
+$code forward$$ $cnext
+    $codei%Forward(0, %x%)%$$, $codei%Forward(1, %v%)%$$ and
+    $codei%Reverse(2, %w%)%$$ for each product
+$rnext
+$code hes_vec$$ $cnext
+    $codei%Forward(0, %x%)%$$ and then
+    $codei%hes_vec(%w%, %v%)%$$ for each product
+$rnext
+$code batch$$ $cnext
+    one $codei%hes_vec(%x%, %w%, %v%)%$$ for a batch of $icode n$$ products
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/speed/det_by_minor.hpp>
+# include <cppad/speed/uniform_01.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // function, argument, weight and vectors used by the timing routines
+    CppAD::ADFun<double> f_;
+    vector<double>       x_, w_, v_;
+    //
+    void setup(size_t size)
+    {   size_t n = size * size;
+        vector<a_double> ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        CppAD::det_by_minor<a_double> det(size);
+        ay[0] = det(ax);
+        f_.Dependent(ax, ay);
+        f_.optimize();
+        //
+        x_.resize(n);
+        v_.resize(n * n);
+        w_.resize(1);
+        CppAD::uniform_01(n, x_);
+        CppAD::uniform_01(n * n, v_);
+        w_[0] = 1.0;
+    }
+    void time_forward(size_t size, size_t repeat)
+    {   size_t n = size * size;
+        vector<double> v(n), ddw(2 * n), hv(n);
+        while(repeat--)
+        {   for(size_t k = 0; k < n; ++k)
+            {   for(size_t j = 0; j < n; ++j)
+                    v[j] = v_[k * n + j];
+                f_.Forward(0, x_);
+                f_.Forward(1, v);
+                ddw = f_.Reverse(2, w_);
+                for(size_t j = 0; j < n; ++j)
+                    hv[j] = ddw[j * 2 + 1];
+            }
+        }
+    }
+    void time_hes_vec(size_t size, size_t repeat)
+    {   size_t n = size * size;
+        vector<double> v(n), hv(n);
+        while(repeat--)
+        {   f_.Forward(0, x_);
+            for(size_t k = 0; k < n; ++k)
+            {   for(size_t j = 0; j < n; ++j)
+                    v[j] = v_[k * n + j];
+                hv = f_.hes_vec(w_, v);
+            }
+        }
+    }
+    void time_batch(size_t size, size_t repeat)
+    {   size_t n = size * size;
+        vector<double> hv(n * n);
+        while(repeat--)
+            hv = f_.hes_vec(x_, w_, v_);
+    }
+}
+
+bool hes_vec(double time_min)
+{   bool ok = true;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 3;
+    size_vec[1] = 4;
+    size_vec[2] = 5;
+    //
+    vector<double> rate_forward( size_vec.size() );
+    vector<double> rate_hes_vec( size_vec.size() );
+    vector<double> rate_batch( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        size_t n    = size * size;
+        setup(size);
+        //
+        // check correctness against the Hessian
+        vector<double> hes = f_.Hessian(x_, w_);
+        vector<double> hv  = f_.hes_vec(x_, w_, v_);
+        for(size_t k = 0; k < n; ++k)
+        {   for(size_t i1 = 0; i1 < n; ++i1)
+            {   double check = 0.0;
+                for(size_t j = 0; j < n; ++j)
+                    check += hes[i1 * n + j] * v_[k * n + j];
+                ok &= CppAD::NearEqual(hv[k * n + i1], check, eps99, eps99);
+            }
+        }
+        //
+        // number of products for each repeat is n
+        double dn       = double(n);
+        rate_forward[i] = dn / CppAD::time_test(time_forward, time_min, size);
+        rate_hes_vec[i] = dn / CppAD::time_test(time_hes_vec, time_min, size);
+        rate_batch[i]   = dn / CppAD::time_test(time_batch,   time_min, size);
+    }
+    micro_output_size("hes_vec", size_vec);
+    micro_output_rate("hes_vec", "forward", rate_forward);
+    micro_output_rate("hes_vec", "hes_vec", rate_hes_vec);
+    micro_output_rate("hes_vec", "batch",   rate_batch);
+    //
+    // free memory used by this test
+    f_ = CppAD::ADFun<double>();
+    x_.clear();
+    w_.clear();
+    v_.clear();
+    //
+    return ok;
+}
+// END C++
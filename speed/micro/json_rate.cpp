@@ -0,0 +1,215 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_json_rate.cpp$$
+$spell
+    json
+    det
+    ode
+$$
+
+$section Speed Test of Writing and Reading Json AD Graphs$$
+
+$head Purpose$$
+Measures the rate, in millions of bytes of Json per second,
+for $cref to_json$$ and $cref from_json$$.
+The rates are the length of the Json for the function times the
+number of conversions per second, divided by $code 1e6$$.
+
+$head Cases$$
+$table
+$code det_to_json$$ $cnext
+    $icode%fun%.to_json()%$$ where $icode fun$$ is the determinant
+    of a $icode%size% x %size%$$ matrix computed using
+    $cref det_by_minor$$
+$rnext
+$code det_from_json$$ $cnext
+    $icode%fun%.from_json(%json%)%$$ for the determinant function
+$rnext
+$code ode_to_json$$ $cnext
+    $icode%fun%.to_json()%$$ where $icode fun$$ is the function
+    $cref ode_evaluate$$ with $icode%n% = %size%$$
+$rnext
+$code ode_from_json$$ $cnext
+    $icode%fun%.from_json(%json%)%$$ for the ode function
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/speed/det_by_minor.hpp>
+# include <cppad/speed/ode_evaluate.hpp>
+# include <cppad/speed/uniform_01.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // function, its json, and size for previous setup
+    CppAD::ADFun<double> det_fun_, ode_fun_;
+    std::string          det_json_, ode_json_;
+    size_t               det_size_ = 0, ode_size_ = 0;
+    //
+    void det_setup(size_t size)
+    {   if( size == det_size_ )
+            return;
+        det_size_ = size;
+        if( size == 0 )
+        {   det_fun_  = CppAD::ADFun<double>();
+            det_json_ = std::string();
+            return;
+        }
+        size_t n = size * size;
+        vector<a_double> ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        CppAD::det_by_minor<a_double> det(size);
+        ay[0] = det(ax);
+        det_fun_.Dependent(ax, ay);
+        det_json_ = det_fun_.to_json();
+    }
+    void ode_setup(size_t size)
+    {   if( size == ode_size_ )
+            return;
+        ode_size_ = size;
+        if( size == 0 )
+        {   ode_fun_  = CppAD::ADFun<double>();
+            ode_json_ = std::string();
+            return;
+        }
+        size_t n = size;
+        vector<a_double> ax(n), ay(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 1.0;
+        CppAD::Independent(ax);
+        size_t p = 0;
+        CppAD::ode_evaluate(ax, p, ay);
+        ode_fun_.Dependent(ax, ay);
+        ode_json_ = ode_fun_.to_json();
+    }
+    void time_det_to_json(size_t size, size_t repeat)
+    {   det_setup(size);
+        std::string json;
+        while(repeat--)
+            json = det_fun_.to_json();
+    }
+    void time_det_from_json(size_t size, size_t repeat)
+    {   det_setup(size);
+        CppAD::ADFun<double> fun;
+        while(repeat--)
+            fun.from_json(det_json_);
+    }
+    void time_ode_to_json(size_t size, size_t repeat)
+    {   ode_setup(size);
+        std::string json;
+        while(repeat--)
+            json = ode_fun_.to_json();
+    }
+    void time_ode_from_json(size_t size, size_t repeat)
+    {   ode_setup(size);
+        CppAD::ADFun<double> fun;
+        while(repeat--)
+            fun.from_json(ode_json_);
+    }
+    // check that a function converted to json and back has same values
+    bool check_round_trip(CppAD::ADFun<double>& f, const std::string& json)
+    {   bool ok = true;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        //
+        CppAD::ADFun<double> g;
+        g.from_json(json);
+        ok &= g.Domain() == f.Domain();
+        ok &= g.Range()  == f.Range();
+        //
+        size_t n = f.Domain();
+        vector<double> x(n), yf, yg;
+        CppAD::uniform_01(n, x);
+        yf = f.Forward(0, x);
+        yg = g.Forward(0, x);
+        for(size_t i = 0; i < yf.size(); ++i)
+            ok &= CppAD::NearEqual(yf[i], yg[i], eps99, eps99);
+        //
+        // writing the function again gives the same json
+        ok &= g.to_json() == json;
+        return ok;
+    }
+}
+
+bool json_rate(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 3;
+    size_vec[1] = 5;
+    size_vec[2] = 7;
+    //
+    // check correctness
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        det_setup(size);
+        ok &= check_round_trip(det_fun_, det_json_);
+        ode_setup(size);
+        ok &= check_round_trip(ode_fun_, ode_json_);
+    }
+    //
+    // rates in millions of bytes per second
+    vector<double> rate_det_to( size_vec.size() );
+    vector<double> rate_det_from( size_vec.size() );
+    vector<double> rate_ode_to( size_vec.size() );
+    vector<double> rate_ode_from( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        double time;
+        //
+        det_setup(size);
+        double mb        = double( det_json_.size() ) / 1e6;
+        time             = CppAD::time_test(time_det_to_json, time_min, size);
+        rate_det_to[i]   = mb / time;
+        time             = CppAD::time_test(time_det_from_json, time_min, size);
+        rate_det_from[i] = mb / time;
+        //
+        ode_setup(size);
+        mb               = double( ode_json_.size() ) / 1e6;
+        time             = CppAD::time_test(time_ode_to_json, time_min, size);
+        rate_ode_to[i]   = mb / time;
+        time             = CppAD::time_test(time_ode_from_json, time_min, size);
+        rate_ode_from[i] = mb / time;
+    }
+    micro_output_size("json_rate", size_vec);
+    micro_output_rate("json_rate", "det_to_json", rate_det_to);
+    micro_output_rate("json_rate", "det_from_json", rate_det_from);
+    micro_output_rate("json_rate", "ode_to_json", rate_ode_to);
+    micro_output_rate("json_rate", "ode_from_json", rate_ode_from);
+    //
+    // free static memory
+    det_setup(0);
+    ode_setup(0);
+    //
+    return ok;
+}
+// END C++
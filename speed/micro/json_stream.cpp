@@ -0,0 +1,173 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_json_stream.cpp$$
+$spell
+    json
+$$
+
+$section Speed Test of Reading a Json AD Graph From a File$$
+
+$head Purpose$$
+Compares the time for $cref from_json$$ using a string
+with the time for $code from_json$$ using a stream.
+The graph is a synthetic function where each operator uses the result
+of the previous operator and one of ten independent variables.
+It is written to a file (in the current directory) and
+each size is the number of operators in the graph.
+The rates are the number of graphs converted to $code ADFun$$ objects
+per second.
+
+$head Cases$$
+$table
+$code string$$ $cnext
+    read the entire file into a string and then call
+    $icode%fun%.from_json(%json%)%$$
+$rnext
+$code stream$$ $cnext
+    open the file as a stream $icode is$$ and call
+    $icode%fun%.from_json(%is%)%$$
+$tend
+The $code stream$$ case does not hold the text for the entire graph
+in memory at the same time.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <fstream>
+# include <sstream>
+# include <cstdio>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    //
+    // file that contains the graph and size for previous setup
+    const char* file_name_ = "json_stream.json";
+    size_t      size_      = 0;
+    //
+    // number of independent variables
+    const size_t n_ = 10;
+    //
+    void setup(size_t size)
+    {   if( size == size_ )
+            return;
+        size_ = size;
+        if( size == 0 )
+        {   std::remove(file_name_);
+            return;
+        }
+        // record the function
+        vector< CppAD::AD<double> > ax(n_), ay(1);
+        for(size_t j = 0; j < n_; ++j)
+            ax[j] = double(j + 1) / double(n_);
+        CppAD::Independent(ax);
+        CppAD::AD<double> asum = ax[0];
+        for(size_t k = 0; k < size; ++k)
+        {   if( k % 3 == 0 )
+                asum = asum * ax[k % n_];
+            else if( k % 3 == 1 )
+                asum = asum + ax[k % n_];
+            else
+                asum = sin( asum );
+        }
+        ay[0] = asum;
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // write its graph to the file
+        std::ofstream os(file_name_);
+        os << f.to_json();
+    }
+    // read the graph as one string
+    void from_string(CppAD::ADFun<double>& fun)
+    {   std::ifstream is(file_name_);
+        std::stringstream ss;
+        ss << is.rdbuf();
+        std::string json = ss.str();
+        fun.from_json(json);
+    }
+    // read the graph from a stream
+    void from_stream(CppAD::ADFun<double>& fun)
+    {   std::ifstream is(file_name_);
+        fun.from_json(is);
+    }
+    void time_string(size_t size, size_t repeat)
+    {   setup(size);
+        CppAD::ADFun<double> fun;
+        while(repeat--)
+            from_string(fun);
+    }
+    void time_stream(size_t size, size_t repeat)
+    {   setup(size);
+        CppAD::ADFun<double> fun;
+        while(repeat--)
+            from_stream(fun);
+    }
+}
+
+bool json_stream(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 1000;
+    size_vec[1] = 10000;
+    size_vec[2] = 100000;
+    //
+    // check correctness
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   setup( size_vec[i] );
+        CppAD::ADFun<double> f_string, f_stream;
+        from_string(f_string);
+        from_stream(f_stream);
+        ok &= f_string.size_op()  == f_stream.size_op();
+        ok &= f_string.size_var() == f_stream.size_var();
+        ok &= f_string.size_par() == f_stream.size_par();
+        vector<double> x(n_), y_string, y_stream;
+        for(size_t j = 0; j < n_; ++j)
+            x[j] = double(j + 1) / double(n_);
+        y_string = f_string.Forward(0, x);
+        y_stream = f_stream.Forward(0, x);
+        ok &= y_string[0] == y_stream[0];
+    }
+    //
+    // rates
+    vector<double> rate_string( size_vec.size() );
+    vector<double> rate_stream( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        rate_string[i] = 1.0 / CppAD::time_test(time_string, time_min, size);
+        rate_stream[i] = 1.0 / CppAD::time_test(time_stream, time_min, size);
+    }
+    micro_output_size("json_stream", size_vec);
+    micro_output_rate("json_stream", "string", rate_string);
+    micro_output_rate("json_stream", "stream", rate_stream);
+    //
+    // remove the file
+    setup(0);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,152 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_level_eval.cpp$$
+$spell
+    eval
+$$
+
+$section Speed Test of Forward and Reverse Using Multiple Threads$$
+
+$head Purpose$$
+Compares the rate for evaluating a function and its gradient using
+$cref/forward_level(x, n_thread)/level_eval/forward_level/$$ and
+$cref/reverse_level(w, n_thread)/level_eval/reverse_level/$$
+for different values of $icode n_thread$$.
+The function has $icode size$$ independent variables.
+Each component of $icode x$$ is used by a short chain of operations
+and the function value is the sum of the results of the chains; i.e.,
+it is a wide function like the sum of many independent terms.
+The rates are the number of function and gradient evaluations per second.
+
+$head Cases$$
+$table
+$code thread1$$ $cnext $icode%n_thread% = 1%$$
+    (uses $codei%Forward(0, %x%)%$$ and $codei%Reverse(1, %w%)%$$)
+$rnext
+$code thread2$$ $cnext $icode%n_thread% = 2%$$
+$rnext
+$code thread4$$ $cnext $icode%n_thread% = 4%$$
+$tend
+Scaling is limited by the number of processors.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // number of operations in the chain for each independent variable
+    const size_t n_chain_ = 10;
+    //
+    // function and number of threads used by time_eval
+    CppAD::ADFun<double> f_;
+    size_t               n_thread_;
+    //
+    void setup(size_t size, CppAD::ADFun<double>& f)
+    {   vector<a_double> ax(size), ay(1);
+        for(size_t j = 0; j < size; ++j)
+            ax[j] = double(j + 1) / double(size);
+        CppAD::Independent(ax);
+        a_double asum = 0.0;
+        for(size_t j = 0; j < size; ++j)
+        {   a_double aterm = ax[j];
+            for(size_t k = 0; k < n_chain_; ++k)
+                aterm = sin(aterm) * ax[j] + 0.5;
+            asum += aterm;
+        }
+        ay[0] = asum;
+        f.Dependent(ax, ay);
+        f.optimize();
+    }
+    void time_eval(size_t size, size_t repeat)
+    {   vector<double> x(size), y(1), w(1), dw(size);
+        w[0] = 1.0;
+        while(repeat--)
+        {   for(size_t j = 0; j < size; ++j)
+                x[j] = double(j + repeat % 7) / double(size);
+            y  = f_.forward_level(x, n_thread_);
+            dw = f_.reverse_level(w, n_thread_);
+        }
+    }
+}
+
+bool level_eval(double time_min)
+{   bool ok = true;
+    //
+    // must be called before using more than one thread
+    CppAD::parallel_ad<double>();
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 1000;
+    size_vec[1] = 10000;
+    size_vec[2] = 100000;
+    //
+    const char* name[]   = { "thread1", "thread2", "thread4" };
+    size_t      thread[] = { 1, 2, 4 };
+    size_t n_case = sizeof(thread) / sizeof(thread[0]);
+    //
+    vector< vector<double> > rate(n_case);
+    for(size_t c = 0; c < n_case; ++c)
+        rate[c].resize( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        //
+        // check the results using a function without levels
+        setup(size, f_);
+        ok &= f_.prepare_level_eval();
+        CppAD::ADFun<double> g;
+        setup(size, g);
+        vector<double> x(size), y(1), check(1), w(1), dw(size), dw_check(size);
+        for(size_t j = 0; j < size; ++j)
+            x[j] = double(j + 2) / double(size);
+        w[0]     = 1.0;
+        y        = f_.forward_level(x, 4);
+        dw       = f_.reverse_level(w, 4);
+        check    = g.Forward(0, x);
+        dw_check = g.Reverse(1, w);
+        ok      &= CppAD::NearEqual(y[0], check[0], 1e-10, 1e-10);
+        for(size_t j = 0; j < size; ++j)
+            ok &= CppAD::NearEqual(dw[j], dw_check[j], 1e-10, 1e-10);
+        //
+        for(size_t c = 0; c < n_case; ++c)
+        {   n_thread_  = thread[c];
+            rate[c][i] = 1.0 / CppAD::time_test(time_eval, time_min, size);
+        }
+    }
+    micro_output_size("level_eval", size_vec);
+    for(size_t c = 0; c < n_case; ++c)
+        micro_output_rate("level_eval", name[c], rate[c]);
+    //
+    // free memory used by this test
+    f_ = CppAD::ADFun<double>();
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,209 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_micro$$
+$spell
+    cmake
+    cppad
+    CppAD
+    min
+$$
+
+$section Speed Tests of Specific CppAD Features$$
+
+$head Purpose$$
+The $cref speed_main$$ tests compare different AD packages
+on the same set of problems.
+The tests in this directory time specific CppAD features,
+usually by comparing a feature with the operations it replaces.
+Each test also checks that its results are correct.
+
+$head Running Tests$$
+To build these speed tests, and run their correctness tests,
+execute the following commands starting in the
+$cref/build directory/cmake/Build Directory/$$:
+$codei%
+    cd speed/micro
+    make check_speed_micro VERBOSE=1
+%$$
+You can then run the corresponding speed tests
+with the following command
+$codei%
+    ./speed_micro %test% %time_min%
+%$$
+
+$head test$$
+is the name of the test that is run, or $code all$$
+if all the tests are run.
+
+$head time_min$$
+is the minimum time in seconds used to compute each rate
+(the default value is one).
+The $code check_speed_micro$$ target uses a small value for
+$icode time_min$$ so that it mainly checks for correctness.
+
+$head Output$$
+Each test outputs the sizes it uses,
+and the corresponding rates, in the same form as $cref speed_main$$; e.g.,
+$codei%
+    micro_%test%_size = [ %...% ]
+    micro_%test%_%case%_rate = [ %...% ]
+%$$
+
+$childtable%
+    speed/micro/alloc_thread.cpp%
+    speed/micro/for_jac_block.cpp%
+    speed/micro/forward_batch.cpp%
+    speed/micro/forward_dir.cpp%
+    speed/micro/hes_vec.cpp%
+    speed/micro/json_rate.cpp%
+    speed/micro/json_stream.cpp%
+    speed/micro/level_eval.cpp%
+    speed/micro/record_hint.cpp%
+    speed/micro/simd_base.cpp%
+    speed/micro/slot_eval.cpp%
+    speed/micro/sparse_jac_thread.cpp%
+    speed/micro/update_eval.cpp
+%$$
+
+$end
+*/
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <iomanip>
+
+// BEGIN_SORT_THIS_LINE_PLUS_1
+extern bool alloc_thread(double time_min);
+extern bool for_jac_block(double time_min);
+extern bool forward_batch(double time_min);
+extern bool forward_dir(double time_min);
+extern bool hes_vec(double time_min);
+extern bool json_rate(double time_min);
+extern bool json_stream(double time_min);
+extern bool level_eval(double time_min);
+extern bool record_hint(double time_min);
+extern bool simd_base(double time_min);
+extern bool slot_eval(double time_min);
+extern bool sparse_jac_thread(double time_min);
+extern bool update_eval(double time_min);
+// END_SORT_THIS_LINE_MINUS_1
+
+// --------------------------------------------------------------------------
+// output sizes for a test in same format as speed/main.cpp
+void micro_output_size(
+    const std::string&            test     ,
+    const CppAD::vector<size_t>&  size_vec )
+{   std::cout << "micro_" << test << "_size = [ ";
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   if( i > 0 )
+            std::cout << ", ";
+        std::cout << size_vec[i];
+    }
+    std::cout << " ]" << std::endl;
+}
+// output rates for one case of a test in same format as speed/main.cpp
+void micro_output_rate(
+    const std::string&            test     ,
+    const std::string&            name     ,
+    const CppAD::vector<double>&  rate_vec )
+{   std::cout << "micro_" << test << "_" << name << "_rate = [ ";
+    std::cout << std::fixed;
+    for(size_t i = 0; i < rate_vec.size(); ++i)
+    {   if( i > 0 )
+            std::cout << ", ";
+        if( rate_vec[i] >= 1000. )
+            std::cout << std::setprecision(0) << rate_vec[i];
+        else
+            std::cout << std::setprecision(2) << rate_vec[i];
+    }
+    std::cout << " ]" << std::endl;
+}
+// --------------------------------------------------------------------------
+namespace {
+    using std::cout;
+    using std::endl;
+    //
+    // function that runs one test
+    size_t Run_ok_count    = 0;
+    size_t Run_error_count = 0;
+    bool Run(
+        bool               test(double) ,
+        const char*        name         ,
+        const std::string& which        ,
+        double             time_min     )
+    {   if( which != "all" && which != name )
+            return true;
+        //
+        bool ok = test(time_min);
+        cout << "micro_" << name << "_correct = ";
+        if( ok )
+        {   cout << "true" << endl;
+            Run_ok_count++;
+        }
+        else
+        {   cout << "false" << endl;
+            Run_error_count++;
+        }
+        return ok;
+    }
+}
+
+// main program that runs the tests
+int main(int argc, char* argv[])
+{   bool ok = true;
+    //
+    const char* usage = "usage: speed_micro test [time_min]";
+    if( argc < 2 || 3 < argc )
+    {   cout << usage << endl;
+        return 1;
+    }
+    std::string which = argv[1];
+    double time_min   = 1.0;
+    if( argc == 3 )
+        time_min = std::atof( argv[2] );
+    if( time_min <= 0.0 )
+    {   cout << usage << endl;
+        return 1;
+    }
+    //
+    // BEGIN_SORT_THIS_LINE_PLUS_1
+    ok &= Run( alloc_thread, "alloc_thread", which, time_min);
+    ok &= Run( for_jac_block, "for_jac_block", which, time_min);
+    ok &= Run( forward_batch, "forward_batch", which, time_min);
+    ok &= Run( forward_dir, "forward_dir", which, time_min);
+    ok &= Run( hes_vec, "hes_vec", which, time_min);
+    ok &= Run( json_rate, "json_rate", which, time_min);
+    ok &= Run( json_stream, "json_stream", which, time_min);
+    ok &= Run( level_eval, "level_eval", which, time_min);
+    ok &= Run( record_hint, "record_hint", which, time_min);
+    ok &= Run( simd_base, "simd_base", which, time_min);
+    ok &= Run( slot_eval, "slot_eval", which, time_min);
+    ok &= Run( sparse_jac_thread, "sparse_jac_thread", which, time_min);
+    ok &= Run( update_eval, "update_eval", which, time_min);
+    // END_SORT_THIS_LINE_MINUS_1
+    //
+    if( Run_ok_count + Run_error_count == 0 )
+    {   cout << "speed_micro: " << which << " is not a valid test" << endl;
+        return 1;
+    }
+    // check for memory leak in previous calculations
+    if( ! CppAD::thread_alloc::free_all() )
+    {   ok = false;
+        cout << "Error: memroy leak detected" << endl;
+    }
+    if( ok )
+        cout << "All " << Run_ok_count << " correctness tests passed.\n";
+    else
+        cout << Run_error_count << " correctness tests failed.\n";
+    //
+    return static_cast<int>( ! ok );
+}
@@ -0,0 +1,133 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_record_hint.cpp$$
+$spell
+    det
+$$
+
+$section Speed Test of Recording With a Size Hint$$
+
+$head Purpose$$
+Compares the time to record the determinant of a
+$icode%size% x %size%$$ matrix, computed using $cref det_by_minor$$,
+with and without a $cref/hint/Independent/hint/$$ for the
+size of the recording.
+The rates are the number of recordings per second.
+The memory that is no longer used is held by $cref thread_alloc$$
+(see $cref/hold_memory/ta_hold_memory/$$)
+so the cost of the system allocator is not included.
+
+$head Cases$$
+$table
+$code none$$ $cnext
+    $codei%Independent(%ax%)%$$
+$rnext
+$code hint$$ $cnext
+    $codei%Independent(%ax%, %hint%)%$$ where $icode hint$$ is the
+    previous recording of the same function
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/speed/det_by_minor.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // record the determinant function in f (hint is null for no hint)
+    void record(
+        size_t                      size ,
+        CppAD::ADFun<double>&       f    ,
+        const CppAD::ADFun<double>* hint )
+    {   size_t n = size * size;
+        vector<a_double> ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 0.0;
+        if( hint != CPPAD_NULL )
+            CppAD::Independent(ax, *hint);
+        else
+            CppAD::Independent(ax);
+        CppAD::det_by_minor<a_double> det(size);
+        ay[0] = det(ax);
+        f.Dependent(ax, ay);
+    }
+    void time_none(size_t size, size_t repeat)
+    {   CppAD::ADFun<double> f;
+        while(repeat--)
+            record(size, f, CPPAD_NULL);
+    }
+    void time_hint(size_t size, size_t repeat)
+    {   CppAD::ADFun<double> f;
+        record(size, f, CPPAD_NULL);
+        while(repeat--)
+            record(size, f, &f);
+    }
+}
+
+bool record_hint(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 4;
+    size_vec[1] = 6;
+    size_vec[2] = 8;
+    //
+    // check correctness
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   CppAD::ADFun<double> f, g;
+        record(size_vec[i], f, CPPAD_NULL);
+        record(size_vec[i], g, &f);
+        ok &= f.size_op()     == g.size_op();
+        ok &= f.size_op_arg() == g.size_op_arg();
+        ok &= f.size_par()    == g.size_par();
+    }
+    //
+    // hold memory during the timing
+    bool hold_memory = true;
+    CppAD::thread_alloc::hold_memory(hold_memory);
+    //
+    // rates
+    vector<double> rate_none( size_vec.size() );
+    vector<double> rate_hint( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size  = size_vec[i];
+        rate_none[i] = 1.0 / CppAD::time_test(time_none, time_min, size);
+        rate_hint[i] = 1.0 / CppAD::time_test(time_hint, time_min, size);
+    }
+    micro_output_size("record_hint", size_vec);
+    micro_output_rate("record_hint", "none", rate_none);
+    micro_output_rate("record_hint", "hint", rate_hint);
+    //
+    hold_memory = false;
+    CppAD::thread_alloc::hold_memory(hold_memory);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,254 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_simd_base.cpp$$
+$spell
+    simd
+    det
+    lu
+    ode
+$$
+
+$section Speed Test of AD<simd_double<4>> Versus AD<double>$$
+
+$head Purpose$$
+Compares the number of scenarios per second that can be evaluated
+using $code AD<double>$$, one scenario per sweep,
+and $code AD< simd_double<4> >$$, four scenarios per sweep;
+see $cref base_simd.hpp$$.
+Each size is the size of the problem, and the rates are the number
+of scenarios per second.
+The results for each lane of the $code simd$$ cases are checked
+against the corresponding $code double$$ results.
+
+$head Cases$$
+$table
+$code det_lu_double$$ $cnext
+    record the determinant of a $icode%size% x %size%$$ matrix,
+    computed using $cref LuFactor$$, and compute its gradient
+    using $cref/Forward(0)/forward_zero/$$ and
+    $cref/Reverse(1)/reverse_one/$$
+    (as in $cref cppad_det_lu.cpp$$)
+$rnext
+$code det_lu_simd$$ $cnext
+    same as $code det_lu_double$$ but for four matrices at once
+$rnext
+$code ode_double$$ $cnext
+    record the solution of the ODE in $cref ode_evaluate$$ once,
+    with $icode size$$ components,
+    then compute its Jacobian for each scenario
+    (as in $cref cppad_ode.cpp$$ with the $code onetape$$ option)
+$rnext
+$code ode_simd$$ $cnext
+    same as $code ode_double$$ but for four scenarios at once
+$tend
+
+$head det_by_lu$$
+The $code det_lu$$ cases use the product of the pivots returned by
+$cref LuFactor$$ instead of $cref det_by_lu$$.
+This is because $code det_by_lu$$ uses the logarithm of the
+absolute value of the pivots and one sign for all the lanes.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/example/base_simd.hpp>
+# include <cppad/cppad.hpp>
+# include <cppad/speed/ode_evaluate.hpp>
+# include <cppad/speed/uniform_01.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    //
+    // number of lanes
+    const size_t n_lane_ = 4;
+    typedef CppAD::simd_double<n_lane_> simd;
+    //
+    // value of lane ell
+    double lane(const simd& x, size_t ell)
+    {   return x[ell]; }
+    //
+    // a random matrix for each lane
+    void random(vector<double>& x)
+    {   CppAD::uniform_01(x.size(), x); }
+    void random(vector<simd>& x)
+    {   vector<double> x_lane( x.size() );
+        for(size_t ell = 0; ell < n_lane_; ++ell)
+        {   CppAD::uniform_01(x.size(), x_lane);
+            for(size_t j = 0; j < x.size(); ++j)
+                x[j][ell] = x_lane[j];
+        }
+    }
+    //
+    // gradient of the determinant of the matrix x
+    template <class Scalar>
+    void det_lu(
+        size_t size, const vector<Scalar>& x, vector<Scalar>& gradient)
+    {   typedef CppAD::AD<Scalar> a_scalar;
+        size_t n = size * size;
+        vector<a_scalar> ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x[j];
+        size_t abort_op_index = 0;
+        bool   record_compare = false;
+        CppAD::Independent(ax, abort_op_index, record_compare);
+        //
+        // determinant is the sign times the product of the pivots
+        vector<a_scalar> alu(ax);
+        vector<size_t>   ip(size), jp(size);
+        int sign = CppAD::LuFactor(ip, jp, alu);
+        ay[0]    = a_scalar( double(sign) );
+        for(size_t p = 0; p < size; ++p)
+            ay[0] *= alu[ ip[p] * size + jp[p] ];
+        CppAD::ADFun<Scalar> f(ax, ay);
+        vector<Scalar> w(1);
+        w[0] = Scalar(1.0);
+        f.Forward(0, x);
+        gradient = f.Reverse(1, w);
+    }
+    //
+    // record the solution of the ode
+    template <class Scalar>
+    void ode_record(size_t size, CppAD::ADFun<Scalar>& f)
+    {   typedef CppAD::AD<Scalar> a_scalar;
+        vector<a_scalar> ax(size), ay(size);
+        for(size_t j = 0; j < size; ++j)
+            ax[j] = 0.0;
+        size_t abort_op_index = 0;
+        bool   record_compare = false;
+        CppAD::Independent(ax, abort_op_index, record_compare);
+        size_t p = 0;
+        CppAD::ode_evaluate(ax, p, ay);
+        f.Dependent(ax, ay);
+    }
+    //
+    // timing routines
+    template <class Scalar>
+    void time_det_lu(size_t size, size_t repeat)
+    {   vector<Scalar> x(size * size), gradient;
+        random(x);
+        while(repeat--)
+            det_lu(size, x, gradient);
+    }
+    template <class Scalar>
+    void time_ode(size_t size, size_t repeat)
+    {   CppAD::ADFun<Scalar> f;
+        ode_record(size, f);
+        vector<Scalar> x(size), jacobian;
+        random(x);
+        while(repeat--)
+            jacobian = f.Jacobian(x);
+    }
+    //
+    // check that each lane of the simd results agrees with double
+    bool check(size_t size)
+    {   bool ok = true;
+        double eps = 100. * std::numeric_limits<double>::epsilon();
+        //
+        // det_lu
+        size_t n = size * size;
+        vector<simd> x_simd(n), g_simd;
+        random(x_simd);
+        det_lu(size, x_simd, g_simd);
+        for(size_t ell = 0; ell < n_lane_; ++ell)
+        {   vector<double> x_double(n), g_double;
+            for(size_t j = 0; j < n; ++j)
+                x_double[j] = lane(x_simd[j], ell);
+            det_lu(size, x_double, g_double);
+            for(size_t j = 0; j < n; ++j)
+            {   double g = lane(g_simd[j], ell);
+                ok &= CppAD::NearEqual(g, g_double[j], eps, eps);
+            }
+        }
+        //
+        // ode
+        CppAD::ADFun<simd>   f_simd;
+        CppAD::ADFun<double> f_double;
+        ode_record(size, f_simd);
+        ode_record(size, f_double);
+        x_simd.resize(size);
+        random(x_simd);
+        vector<simd> jac_simd = f_simd.Jacobian(x_simd);
+        for(size_t ell = 0; ell < n_lane_; ++ell)
+        {   vector<double> x_double(size);
+            for(size_t j = 0; j < size; ++j)
+                x_double[j] = lane(x_simd[j], ell);
+            vector<double> jac_double = f_double.Jacobian(x_double);
+            for(size_t k = 0; k < size * size; ++k)
+            {   double jac = lane(jac_simd[k], ell);
+                ok &= CppAD::NearEqual(jac, jac_double[k], eps, eps);
+            }
+        }
+        return ok;
+    }
+}
+
+bool simd_base(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 3;
+    size_vec[1] = 6;
+    size_vec[2] = 9;
+    //
+    // check correctness
+    for(size_t i = 0; i < size_vec.size(); ++i)
+        ok &= check( size_vec[i] );
+    //
+    // rates
+    size_t n_size = size_vec.size();
+    vector<double> rate_det_double(n_size), rate_det_simd(n_size);
+    vector<double> rate_ode_double(n_size), rate_ode_simd(n_size);
+    double lanes = double(n_lane_);
+    for(size_t i = 0; i < n_size; ++i)
+    {   size_t size = size_vec[i];
+        double time;
+        time               = CppAD::time_test(
+            time_det_lu<double>, time_min, size
+        );
+        rate_det_double[i] = 1.0 / time;
+        time               = CppAD::time_test(
+            time_det_lu<simd>, time_min, size
+        );
+        rate_det_simd[i]   = lanes / time;
+        time               = CppAD::time_test(
+            time_ode<double>, time_min, size
+        );
+        rate_ode_double[i] = 1.0 / time;
+        time               = CppAD::time_test(
+            time_ode<simd>, time_min, size
+        );
+        rate_ode_simd[i]   = lanes / time;
+    }
+    micro_output_size("simd_base", size_vec);
+    micro_output_rate("simd_base", "det_lu_double", rate_det_double);
+    micro_output_rate("simd_base", "det_lu_simd",   rate_det_simd);
+    micro_output_rate("simd_base", "ode_double",    rate_ode_double);
+    micro_output_rate("simd_base", "ode_simd",      rate_ode_simd);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,153 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_slot_eval.cpp$$
+$spell
+    eval
+$$
+
+$section Speed Test of Zero Order Forward Using Slots$$
+
+$head Purpose$$
+Compares the rate for evaluating a function using
+$cref/Forward(0, x)/forward_zero/$$ and
+$cref/forward_slot(x)/slot_eval/forward_slot/$$.
+The function has ten independent variables and one dependent variable.
+It is a chain of $icode size$$ steps where each step uses the
+previous two steps; i.e., there are about $codei%4 * %size%$$
+variables in the tape and only a few of them are live at any time.
+The rates are the number of function evaluations per second.
+
+$head Cases$$
+$table
+$code forward_0$$ $cnext
+    $codei%f%.Forward(0, %x%)%$$
+$rnext
+$code fast_eval$$ $cnext
+    $codei%f%.Forward(0, %x%)%$$ after
+    $cref/f.prepare_fast_eval()/prepare_fast_eval/$$
+$rnext
+$code slot_eval$$ $cnext
+    $codei%f%.forward_slot(%x%)%$$ after
+    $codei%f%.prepare_slot_eval()%$$
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // number of independent variables
+    const size_t n_ = 10;
+    //
+    // function and case used by time_eval
+    CppAD::ADFun<double> f_;
+    size_t               case_;
+    //
+    void setup(size_t size, CppAD::ADFun<double>& f)
+    {   vector<a_double> ax(n_), ay(1);
+        for(size_t j = 0; j < n_; ++j)
+            ax[j] = double(j + 1) / double(n_);
+        CppAD::Independent(ax);
+        a_double a = ax[0];
+        a_double b = ax[1];
+        for(size_t k = 0; k < size; ++k)
+        {   a_double c = sin(a) * ax[k % n_] + b * 0.5;
+            b = a;
+            a = c;
+        }
+        ay[0] = a + b;
+        f.Dependent(ax, ay);
+    }
+    void time_eval(size_t size, size_t repeat)
+    {   vector<double> x(n_), y(1);
+        for(size_t j = 0; j < n_; ++j)
+            x[j] = double(j + 2) / double(n_);
+        while(repeat--)
+        {   if( case_ == 2 )
+                y = f_.forward_slot(x);
+            else
+                y = f_.Forward(0, x);
+        }
+    }
+}
+
+bool slot_eval(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 10000;
+    size_vec[1] = 100000;
+    size_vec[2] = 1000000;
+    //
+    const char* name[] = { "forward_0", "fast_eval", "slot_eval" };
+    size_t n_case = sizeof(name) / sizeof(name[0]);
+    //
+    vector< vector<double> > rate(n_case);
+    for(size_t c = 0; c < n_case; ++c)
+        rate[c].resize( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        //
+        // value of the function without slots
+        CppAD::ADFun<double> g;
+        setup(size, g);
+        vector<double> x(n_), check(1), y(1);
+        for(size_t j = 0; j < n_; ++j)
+            x[j] = double(j + 2) / double(n_);
+        check = g.Forward(0, x);
+        //
+        for(size_t c = 0; c < n_case; ++c)
+        {   setup(size, f_);
+            if( c == 1 )
+                ok &= f_.prepare_fast_eval();
+            if( c == 2 )
+            {   ok &= f_.prepare_slot_eval();
+                ok &= f_.size_slot() < 100;
+                y   = f_.forward_slot(x);
+                ok &= y[0] == check[0];
+                //
+                // the slot evaluation does not use the Taylor coefficients
+                f_.capacity_order(0);
+            }
+            case_      = c;
+            rate[c][i] = 1.0 / CppAD::time_test(time_eval, time_min, size);
+        }
+    }
+    micro_output_size("slot_eval", size_vec);
+    for(size_t c = 0; c < n_case; ++c)
+        micro_output_rate("slot_eval", name[c], rate[c]);
+    //
+    // free memory used by this test
+    f_ = CppAD::ADFun<double>();
+    //
+    return ok;
+}
+// END C++
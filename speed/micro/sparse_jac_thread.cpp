@@ -0,0 +1,191 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_sparse_jac_thread.cpp$$
+$spell
+    jac
+    Jacobians
+$$
+
+$section Speed Test of Sparse Jacobians Using Multiple Threads$$
+
+$head Purpose$$
+Compares the time for $cref sparse_jac_for$$ using different values of
+$cref/n_thread/sparse_jac/n_thread/$$.
+The function is $cref sparse_jac_fun$$ with five randomly chosen
+columns for each row of the Jacobian and one color per group.
+Each size is the number of rows (and columns) in the Jacobian.
+The rates are the number of Jacobians evaluated per second.
+
+$head Cases$$
+$table
+$code thread1$$ $cnext $icode%n_thread% = 1%$$
+$rnext
+$code thread2$$ $cnext $icode%n_thread% = 2%$$
+$rnext
+$code thread4$$ $cnext $icode%n_thread% = 4%$$
+$tend
+Scaling is limited by the number of processors and by the zero order
+forward sweep, which is always done by one thread.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/speed/sparse_jac_fun.hpp>
+# include <cppad/speed/uniform_01.hpp>
+# include <vector>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    // std::vector so pattern_ does not hold thread_alloc memory after setup(0)
+    typedef std::vector<size_t> s_vector;
+    typedef std::vector<double> d_vector;
+    //
+    // function object, point, sparsity, work, and size for previous setup
+    CppAD::ADFun<double>                   f_;
+    d_vector                               x_;
+    CppAD::sparse_rc<s_vector>             pattern_;
+    CppAD::sparse_jac_work                 work_;
+    size_t                                 size_ = 0;
+    //
+    void setup(size_t size)
+    {   if( size == size_ )
+            return;
+        size_ = size;
+        work_.clear();
+        if( size == 0 )
+        {   f_       = CppAD::ADFun<double>();
+            x_.clear();
+            pattern_ = CppAD::sparse_rc<s_vector>();
+            return;
+        }
+        size_t m = size;
+        size_t n = size;
+        //
+        // choose five different columns for each row
+        size_t n_col = 5;
+        vector<size_t> row(m * n_col), col(m * n_col);
+        d_vector random(1);
+        CppAD::uniform_01(1);
+        for(size_t i = 0; i < m; ++i)
+        {   for(size_t ell = 0; ell < n_col; ++ell)
+            {   bool duplicate = true;
+                size_t j       = 0;
+                while( duplicate )
+                {   CppAD::uniform_01(1, random);
+                    j         = std::min(size_t(random[0] * double(n)), n-1);
+                    duplicate = false;
+                    for(size_t k = 0; k < ell; ++k)
+                        duplicate |= col[ i * n_col + k ] == j;
+                }
+                row[ i * n_col + ell ] = i;
+                col[ i * n_col + ell ] = j;
+            }
+        }
+        //
+        // record the function
+        vector< CppAD::AD<double> > ax(n), ay(m);
+        x_.resize(n);
+        CppAD::uniform_01(n, x_);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = x_[j];
+        CppAD::Independent(ax);
+        size_t order = 0;
+        typedef CppAD::AD<double> a_double;
+        CppAD::sparse_jac_fun<a_double>(m, n, ax, row, col, order, ay);
+        f_.Dependent(ax, ay);
+        //
+        // sparsity pattern for the Jacobian
+        size_t nnz = row.size();
+        pattern_.resize(m, n, nnz);
+        for(size_t k = 0; k < nnz; ++k)
+            pattern_.set(k, row[k], col[k]);
+    }
+    // compute the Jacobian using n_thread threads
+    size_t jacobian(size_t n_thread, d_vector& val)
+    {   CppAD::sparse_rcv<s_vector, d_vector> subset( pattern_ );
+        size_t group_max = 1;
+        size_t n_color   = f_.sparse_jac_for(
+            group_max, x_, subset, pattern_, "cppad", work_, n_thread
+        );
+        val = subset.val();
+        return n_color;
+    }
+    template <size_t n_thread>
+    void time_thread(size_t size, size_t repeat)
+    {   setup(size);
+        d_vector val;
+        while(repeat--)
+            jacobian(n_thread, val);
+    }
+}
+
+bool sparse_jac_thread(double time_min)
+{   bool ok = true;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // must be called before using more than one thread
+    CppAD::parallel_ad<double>();
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 100;
+    size_vec[1] = 400;
+    size_vec[2] = 1000;
+    //
+    // check correctness
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   setup( size_vec[i] );
+        d_vector val1, val4;
+        size_t n_color1 = jacobian(1, val1);
+        size_t n_color4 = jacobian(4, val4);
+        ok &= n_color1 == n_color4;
+        ok &= val1.size() == val4.size();
+        for(size_t k = 0; k < val1.size(); ++k)
+            ok &= CppAD::NearEqual(val1[k], val4[k], eps99, eps99);
+    }
+    //
+    // rates
+    vector<double> rate1( size_vec.size() );
+    vector<double> rate2( size_vec.size() );
+    vector<double> rate4( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        rate1[i] = 1.0 / CppAD::time_test(time_thread<1>, time_min, size);
+        rate2[i] = 1.0 / CppAD::time_test(time_thread<2>, time_min, size);
+        rate4[i] = 1.0 / CppAD::time_test(time_thread<4>, time_min, size);
+    }
+    micro_output_size("sparse_jac_thread", size_vec);
+    micro_output_rate("sparse_jac_thread", "thread1", rate1);
+    micro_output_rate("sparse_jac_thread", "thread2", rate2);
+    micro_output_rate("sparse_jac_thread", "thread4", rate4);
+    //
+    // free static memory
+    setup(0);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,174 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin micro_update_eval.cpp$$
+$spell
+    eval
+$$
+
+$section Speed Test of Zero Order Forward When Only Some Arguments Change$$
+
+$head Purpose$$
+Compares the rate for evaluating a function using
+$cref/Forward(0, x)/forward_zero/$$ and
+$cref/forward_update(changed, value)/update_eval/forward_update/$$
+when one, ten, and one hundred percent of the components of $icode x$$
+change between evaluations.
+The function has $icode size$$ independent variables.
+Each component of $icode x$$ is used by a short chain of operations
+and the function value is the sum of the results of the chains; i.e.,
+it is a wide function like the sum of many independent terms.
+The rates are the number of function evaluations per second.
+
+$head Cases$$
+$table
+$code fast_eval$$ $cnext
+    $codei%f%.Forward(0, %x%)%$$ after
+    $cref/f.prepare_fast_eval()/prepare_fast_eval/$$
+$rnext
+$code update_1$$ $cnext
+    $codei%f%.forward_update(%changed%, %value%)%$$ after
+    $codei%f%.prepare_update_eval()%$$ where
+    one percent of the components of $icode x$$ change
+$rnext
+$code update_10$$ $cnext
+    same as above with ten percent
+$rnext
+$code update_100$$ $cnext
+    same as above with one hundred percent
+$tend
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+// see micro.cpp
+extern void micro_output_size(
+    const std::string& test, const CppAD::vector<size_t>& size_vec
+);
+extern void micro_output_rate(
+    const std::string& test,
+    const std::string& name,
+    const CppAD::vector<double>& rate_vec
+);
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::AD<double> a_double;
+    //
+    // number of operations in the chain for each independent variable
+    const size_t n_chain_ = 10;
+    //
+    // function and case used by time_eval
+    CppAD::ADFun<double> f_;
+    size_t               case_;
+    //
+    // percent of the independent variables that change for each case
+    const size_t percent_[] = { 100, 1, 10, 100 };
+    //
+    void setup(size_t size, CppAD::ADFun<double>& f)
+    {   vector<a_double> ax(size), ay(1);
+        for(size_t j = 0; j < size; ++j)
+            ax[j] = double(j + 1) / double(size);
+        CppAD::Independent(ax);
+        a_double asum = 0.0;
+        for(size_t j = 0; j < size; ++j)
+        {   a_double aterm = ax[j];
+            for(size_t k = 0; k < n_chain_; ++k)
+                aterm = sin(aterm) * ax[j] + 0.5;
+            asum += aterm;
+        }
+        ay[0] = asum;
+        f.Dependent(ax, ay);
+        f.optimize();
+    }
+    void time_eval(size_t size, size_t repeat)
+    {   vector<double> x(size), y(1);
+        for(size_t j = 0; j < size; ++j)
+            x[j] = double(j + 2) / double(size);
+        //
+        // components of x that change
+        size_t stride = 100 / percent_[case_];
+        vector<size_t> changed( (size + stride - 1) / stride );
+        vector<double> value( changed.size() );
+        for(size_t k = 0; k < changed.size(); ++k)
+            changed[k] = k * stride;
+        //
+        if( case_ > 0 )
+            y = f_.Forward(0, x);
+        while(repeat--)
+        {   if( case_ == 0 )
+                y = f_.Forward(0, x);
+            else
+            {   for(size_t k = 0; k < value.size(); ++k)
+                    value[k] = double(repeat % 7) / double(size);
+                y = f_.forward_update(changed, value);
+            }
+        }
+    }
+}
+
+bool update_eval(double time_min)
+{   bool ok = true;
+    //
+    // sizes for this test
+    vector<size_t> size_vec(3);
+    size_vec[0] = 1000;
+    size_vec[1] = 10000;
+    size_vec[2] = 100000;
+    //
+    const char* name[] = { "fast_eval", "update_1", "update_10", "update_100" };
+    size_t n_case = sizeof(name) / sizeof(name[0]);
+    //
+    vector< vector<double> > rate(n_case);
+    for(size_t c = 0; c < n_case; ++c)
+        rate[c].resize( size_vec.size() );
+    for(size_t i = 0; i < size_vec.size(); ++i)
+    {   size_t size = size_vec[i];
+        //
+        // check the updated value using a function without updates
+        setup(size, f_);
+        ok &= f_.prepare_update_eval();
+        CppAD::ADFun<double> g;
+        setup(size, g);
+        vector<double> x(size), y(1), check(1);
+        for(size_t j = 0; j < size; ++j)
+            x[j] = double(j + 2) / double(size);
+        y = f_.Forward(0, x);
+        vector<size_t> changed(1);
+        vector<double> value(1);
+        changed[0] = size / 2;
+        value[0]   = 0.25;
+        x[size/2]  = value[0];
+        y          = f_.forward_update(changed, value);
+        check      = g.Forward(0, x);
+        ok        &= CppAD::NearEqual(y[0], check[0], 1e-10, 1e-10);
+        //
+        for(size_t c = 0; c < n_case; ++c)
+        {   case_      = c;
+            rate[c][i] = 1.0 / CppAD::time_test(time_eval, time_min, size);
+        }
+    }
+    micro_output_size("update_eval", size_vec);
+    for(size_t c = 0; c < n_case; ++c)
+        micro_output_rate("update_eval", name[c], rate[c]);
+    //
+    // free memory used by this test
+    f_ = CppAD::ADFun<double>();
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,271 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+// Test from_binary with input that is not a valid binary representation.
+// A valid input is tested by example/general/binary_io.cpp
+
+# include <cppad/cppad.hpp>
+# include <sstream>
+# include <cstring>
+
+namespace {
+    // number of errors reported by from_binary
+    size_t n_error_ = 0;
+    //
+    // error handler that returns (from_binary must then return
+    // without changing the function object)
+    void count_handler(
+        bool known       ,
+        int  line        ,
+        const char *file ,
+        const char *exp  ,
+        const char *msg  )
+    {   ++n_error_; }
+    //
+    // stream buffer that does not support seeking
+    class no_seek_buf : public std::streambuf {
+    private:
+        std::string data_;
+    public:
+        no_seek_buf(const std::string& data) : data_(data)
+        {   char* begin = &data_[0];
+            setg(begin, begin, begin + data_.size() );
+        }
+    };
+    //
+    // read a binary representation into g, return number of errors
+    size_t read(
+        CppAD::ADFun<double>& g, const std::string& data, bool seek
+    )
+    {   n_error_ = 0;
+        if( seek )
+        {   std::stringstream stream(
+                data, std::ios::in | std::ios::out | std::ios::binary
+            );
+            g.from_binary(stream);
+        }
+        else
+        {   no_seek_buf  buf(data);
+            std::istream stream(&buf);
+            g.from_binary(stream);
+        }
+        return n_error_;
+    }
+    //
+    // offset in data of the element after the vector that starts at offset
+    size_t skip_vec(const std::string& data, size_t offset, size_t element)
+    {   size_t length;
+        std::memcpy(&length, data.data() + offset, sizeof(length) );
+        return offset + sizeof(length) + length * element;
+    }
+    //
+    // change the value of type Type at offset in data
+    template <class Type>
+    std::string change(const std::string& data, size_t offset, Type value)
+    {   std::string result = data;
+        std::memcpy(&result[offset], &value, sizeof(value) );
+        return result;
+    }
+    //
+    // test from_binary with indices that are out of range
+    bool check_index(void)
+    {   bool ok = true;
+        using CppAD::AD;
+        using CppAD::addr_t;
+        typedef CppAD::local::opcode_t opcode_t;
+        //
+        // f(x; p) = [ v[x_1 - x_1] + sin(p_0) * x_0 , exp(x_0) * x_1 ]
+        size_t n = 2, m = 2;
+        CPPAD_TESTVECTOR(AD<double>) ax(n), ap(1), ay(m);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1);
+        ap[0] = 3.0;
+        CppAD::Independent(ax, ap);
+        CppAD::VecAD<double> av(2);
+        AD<double> zero = 0.0, one = 1.0;
+        av[zero] = ax[0];
+        av[one]  = 4.0;
+        ay[0] = av[ ax[1] - ax[1] ] + sin( ap[0] ) * ax[0];
+        ay[1] = exp( ax[0] ) * ax[1];
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        std::stringstream stream(
+            std::ios::in | std::ios::out | std::ios::binary
+        );
+        f.to_binary(stream);
+        std::string data = stream.str();
+        //
+        // offsets in data: header, function name, has_been_optimized,
+        // ind_taddr, dep_taddr, dep_parameter, num_dynamic_ind,
+        // num_var_rec, num_var_load_rec, op_vec, arg_vec, all_par_vec,
+        // dyn_par_is, dyn_par_op, dyn_par_arg
+        size_t offset = 8 + 8 * sizeof(unsigned);
+        offset = skip_vec(data, offset, 1);
+        size_t optimized_offset = offset;
+        offset = offset + 1;
+        offset = skip_vec(data, offset, sizeof(size_t) );
+        offset = skip_vec(data, offset, sizeof(size_t) );
+        offset = skip_vec(data, offset, 1);
+        size_t load_offset = offset + 2 * sizeof(size_t);
+        offset = offset + 3 * sizeof(size_t);
+        size_t op_offset = offset;
+        offset = skip_vec(data, offset, sizeof(opcode_t) );
+        size_t arg_offset = offset;
+        offset = skip_vec(data, offset, sizeof(addr_t) );
+        offset = skip_vec(data, offset, sizeof(double) );
+        offset = skip_vec(data, offset, 1);
+        size_t dyn_op_offset = offset;
+        offset = skip_vec(data, offset, sizeof(opcode_t) );
+        size_t dyn_arg_offset = offset;
+        offset = skip_vec(data, offset, sizeof(addr_t) );
+        ok &= offset < data.size();
+        //
+        CppAD::ADFun<double> g;
+        ok &= read(g, data, true) == 0;
+        ok &= g.size_var() == f.size_var();
+        //
+        // has_been_optimized is not zero or one
+        ok &= read(g, change(data, optimized_offset, char(2)), true) > 0;
+        //
+        // number of load operators is not num_var_load_rec
+        size_t num_load;
+        std::memcpy(&num_load, data.data() + load_offset, sizeof(num_load));
+        ok &= num_load == 1;
+        ok &= read(g, change(data, load_offset, num_load + 1), true) > 0;
+        //
+        // each operator argument is out of range
+        addr_t large = std::numeric_limits<addr_t>::max() / 2;
+        size_t n_arg;
+        std::memcpy(&n_arg, data.data() + arg_offset, sizeof(n_arg) );
+        for(size_t k = 0; k < n_arg; ++k)
+        {   size_t k_offset = arg_offset + sizeof(size_t) + k * sizeof(addr_t);
+            ok &= read(g, change(data, k_offset, large), true) > 0;
+        }
+        //
+        // each dynamic parameter operator is out of range
+        size_t n_dyn;
+        std::memcpy(&n_dyn, data.data() + dyn_op_offset, sizeof(n_dyn) );
+        ok &= n_dyn == 2;
+        opcode_t number_dyn = opcode_t( CppAD::local::number_dyn );
+        for(size_t k = 0; k < n_dyn; ++k)
+        {   size_t k_offset =
+                dyn_op_offset + sizeof(size_t) + k * sizeof(opcode_t);
+            ok &= read(g, change(data, k_offset, number_dyn), true) > 0;
+        }
+        //
+        // each dynamic parameter argument is out of range
+        std::memcpy(&n_arg, data.data() + dyn_arg_offset, sizeof(n_arg) );
+        ok &= n_arg == 1;
+        for(size_t k = 0; k < n_arg; ++k)
+        {   size_t k_offset =
+                dyn_arg_offset + sizeof(size_t) + k * sizeof(addr_t);
+            ok &= read(g, change(data, k_offset, large), true) > 0;
+        }
+        //
+        // a variable argument that is not less than the index of the
+        // first result for its operator; i.e., the sin(p_0) * x_0
+        // operator using its own result as an argument
+        size_t n_op;
+        std::memcpy(&n_op, data.data() + op_offset, sizeof(n_op) );
+        size_t i_arg = 0, i_var = 0;
+        for(size_t i_op = 0; i_op < n_op; ++i_op)
+        {   opcode_t op;
+            std::memcpy(&op,
+                data.data() + op_offset + sizeof(size_t) + i_op * sizeof(op),
+                sizeof(op)
+            );
+            if( op == opcode_t( CppAD::local::MulpvOp ) )
+            {   size_t k_offset = arg_offset + sizeof(size_t)
+                    + (i_arg + 1) * sizeof(addr_t);
+                std::string bad = change(data, k_offset, addr_t(i_var) );
+                ok &= read(g, bad, true) > 0;
+                bad = change(data, k_offset, addr_t(i_var - 1) );
+                ok &= read(g, bad, true) == 0;
+            }
+            i_arg += CppAD::local::NumArg( CppAD::local::OpCode(op) );
+            i_var += CppAD::local::NumRes( CppAD::local::OpCode(op) );
+        }
+        return ok;
+    }
+}
+
+bool binary_io(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x) = [ exp(x_0) * x_1 , sum_j x_j ]
+    size_t n = 3, m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = exp( ax[0] ) * ax[1];
+    ay[1] = ax[0] + ax[1] + ax[2];
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+    //
+    // valid binary representation of f
+    std::stringstream stream(
+        std::ios::in | std::ios::out | std::ios::binary
+    );
+    f.to_binary(stream);
+    std::string data = stream.str();
+    //
+    // g is the same function without optimization
+    CppAD::Independent(ax);
+    ay[0] = exp( ax[0] ) * ax[1];
+    ay[1] = ax[0] + ax[1] + ax[2];
+    CppAD::ADFun<double> g(ax, ay);
+    size_t size_var = g.size_var();
+    ok &= size_var != f.size_var();
+    //
+    CppAD::ErrorHandler info(count_handler);
+    for(size_t seek = 0; seek < 2; ++seek)
+    {   // valid input
+        CppAD::ADFun<double> h;
+        ok &= read(h, data, seek == 1) == 0;
+        ok &= h.size_var() == f.size_var();
+        //
+        // input that is not a binary representation
+        ok &= read(g, "not a CppAD binary file", seek == 1) > 0;
+        ok &= g.size_var() == size_var;
+        //
+        // input that ends before the operation sequence is complete
+        for(size_t length = 0; length < data.size(); ++length)
+        {   ok &= read(g, data.substr(0, length), seek == 1) > 0;
+            ok &= g.size_var() == size_var;
+        }
+        //
+        // change the length of the first vector (the function name)
+        // to a large value; it follows the 8 character magic value
+        // and 8 unsigned values in the header
+        size_t offset = 8 + 8 * sizeof(unsigned);
+        size_t length;
+        std::memcpy(&length, data.data() + offset, sizeof(length) );
+        ok &= length == 0; // f does not have a name
+        std::string bad = data;
+        size_t large = size_t(1) << (4 * sizeof(size_t) + 8);
+        std::memcpy(&bad[offset], &large, sizeof(large) );
+        ok &= read(g, bad, seek == 1) > 0;
+        ok &= g.size_var() == size_var;
+    }
+    // g still has its original operation sequence
+    CPPAD_TESTVECTOR(double) x(n), y(m);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 1);
+    y   = g.Forward(0, x);
+    ok &= CppAD::NearEqual(y[1], x[0] + x[1] + x[2], 1e-10, 1e-10);
+    //
+    // indices that are out of range
+    ok &= check_index();
+    //
+    return ok;
+}
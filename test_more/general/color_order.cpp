@@ -0,0 +1,188 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+Test the coloring orderings for sparse_jac and the cppad.star coloring
+for sparse_hes.
+*/
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+typedef CPPAD_TESTVECTOR(size_t)                     s_vector;
+typedef CPPAD_TESTVECTOR(double)                     d_vector;
+typedef CPPAD_TESTVECTOR( CppAD::AD<double> )        a_vector;
+typedef CppAD::sparse_rc<s_vector>                   sparsity;
+typedef CppAD::sparse_rcv<s_vector, d_vector>        sparse_matrix;
+
+const char* ordering[] = {
+    "natural", "largest_first", "smallest_last", "incidence_degree", "random"
+};
+const size_t n_ordering = sizeof(ordering) / sizeof(ordering[0]);
+
+// all the entries in a dense matrix, in row major order, that are non-zero
+void dense2sparse(size_t nr, size_t nc, const d_vector& dense, sparsity& rc)
+{   size_t nnz = 0;
+    for(size_t k = 0; k < nr * nc; ++k)
+        if( dense[k] != 0.0 )
+            ++nnz;
+    rc.resize(nr, nc, nnz);
+    size_t ell = 0;
+    for(size_t k = 0; k < nr * nc; ++k)
+        if( dense[k] != 0.0 )
+            rc.set(ell++, k / nc, k % nc);
+}
+
+// Jacobian that is a band matrix except for two dense rows
+bool jacobian(void)
+{   bool ok = true;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    size_t n = 20, m = n;
+    a_vector ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    ay[1] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+    {   ay[0] += ax[j] * ax[j];
+        ay[1] += sin( ax[j] );
+    }
+    for(size_t i = 2; i < m; ++i)
+    {   ay[i] = ax[i-1] * ax[i];
+        if( i + 1 < n )
+            ay[i] += cos( ax[i+1] );
+    }
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    d_vector x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 1) / double(n);
+    d_vector jac = f.Jacobian(x);
+    //
+    sparsity pattern;
+    dense2sparse(m, n, jac, pattern);
+    //
+    for(size_t i_order = 0; i_order < n_ordering; ++i_order)
+    {   std::string coloring = std::string("cppad.") + ordering[i_order];
+        for(size_t i_mode = 0; i_mode < 2; ++i_mode)
+        {   sparse_matrix subset(pattern);
+            CppAD::sparse_jac_work work;
+            size_t n_color;
+            if( i_mode == 0 )
+            {   n_color = f.sparse_jac_rev(
+                    x, subset, pattern, coloring, work
+                );
+                // two dense rows and three rows in the band
+                ok &= n_color == 5;
+            }
+            else
+            {   size_t group_max = 4;
+                n_color = f.sparse_jac_for(
+                    group_max, x, subset, pattern, coloring, work
+                );
+                // all the columns are in the dense rows
+                ok &= n_color == n;
+            }
+            const s_vector& row( subset.row() );
+            const s_vector& col( subset.col() );
+            const d_vector& val( subset.val() );
+            for(size_t k = 0; k < subset.nnz(); ++k)
+            {   double check = jac[ row[k] * n + col[k] ];
+                ok &= CppAD::NearEqual(val[k], check, eps99, eps99);
+            }
+        }
+    }
+    return ok;
+}
+
+// Hessian that is tridiagonal except for a dense first row and column
+bool hessian(void)
+{   bool ok = true;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    size_t n = 20;
+    a_vector ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        ay[0] += ax[0] * ax[j] * ax[j];
+    for(size_t j = 0; j + 1 < n; ++j)
+        ay[0] += ax[j] * ax[j+1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    d_vector x(n), w(1);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 1) / double(n);
+    w[0] = 1.0;
+    d_vector hes = f.Hessian(x, w);
+    //
+    sparsity pattern;
+    dense2sparse(n, n, hes, pattern);
+    //
+    // subset is the lower triangle of the Hessian
+    size_t nnz = 0;
+    for(size_t k = 0; k < pattern.nnz(); ++k)
+        if( pattern.row()[k] >= pattern.col()[k] )
+            ++nnz;
+    sparsity lower(n, n, nnz);
+    nnz = 0;
+    for(size_t k = 0; k < pattern.nnz(); ++k)
+        if( pattern.row()[k] >= pattern.col()[k] )
+            lower.set(nnz++, pattern.row()[k], pattern.col()[k]);
+    //
+    for(size_t i_order = 0; i_order <= n_ordering; ++i_order)
+    {   // the first case uses the default ordering
+        std::string coloring = "cppad.star";
+        if( i_order > 0 )
+            coloring += std::string(".") + ordering[i_order - 1];
+        for(size_t i_subset = 0; i_subset < 2; ++i_subset)
+        {   sparse_matrix subset( i_subset == 0 ? pattern : lower );
+            CppAD::sparse_hes_work work;
+            size_t n_color = f.sparse_hes(
+                x, w, subset, pattern, coloring, work
+            );
+            // one color for the first row and a star coloring of the
+            // tridiagonal part (a general coloring requires n colors)
+            ok &= 3 <= n_color && n_color <= 4;
+            const s_vector& row( subset.row() );
+            const s_vector& col( subset.col() );
+            const d_vector& val( subset.val() );
+            for(size_t k = 0; k < subset.nnz(); ++k)
+            {   double check = hes[ row[k] * n + col[k] ];
+                ok &= CppAD::NearEqual(val[k], check, eps99, eps99);
+            }
+        }
+    }
+    // general coloring with an ordering
+    sparse_matrix subset(pattern);
+    CppAD::sparse_hes_work work;
+    std::string coloring = "cppad.general.smallest_last";
+    size_t n_color = f.sparse_hes(x, w, subset, pattern, coloring, work);
+    ok &= n_color == n;
+    for(size_t k = 0; k < subset.nnz(); ++k)
+    {   double check = hes[ subset.row()[k] * n + subset.col()[k] ];
+        ok &= CppAD::NearEqual(subset.val()[k], check, eps99, eps99);
+    }
+    return ok;
+}
+
+} // END_EMPTY_NAMESPACE
+
+bool color_order(void)
+{   bool ok = true;
+    ok &= jacobian();
+    ok &= hessian();
+    return ok;
+}
@@ -0,0 +1,84 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+Test that an exception thrown by one of the threads used by forward_level
+is thrown by the current thread and that thread_alloc is returned to
+single thread mode.
+*/
+# include <cppad/cppad.hpp>
+# include <stdexcept>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+// discrete function that throws an exception when its argument is negative
+double check_sign(const double& x)
+{   if( x < 0.0 )
+        throw std::runtime_error("check_sign: x is negative");
+    return x;
+}
+CPPAD_DISCRETE_FUNCTION(double, check_sign)
+
+} // END_EMPTY_NAMESPACE
+
+bool color_thread(void)
+{   bool ok = true;
+# if CPPAD_USE_CPLUSPLUS_2011
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+    //
+    // f(x) = sum_j check_sign( x_j * x_j - 1 ) * x_j
+    size_t n = 20, m = 1;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 2);
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        ay[0] += check_sign( ax[j] * ax[j] - 1.0 ) * ax[j];
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+    ok &= f.prepare_level_eval();
+    //
+    // must be called before using more than one thread
+    CppAD::parallel_ad<double>();
+    //
+    size_t n_thread = 2;
+    CPPAD_TESTVECTOR(double) x(n), y(m);
+    // do the test twice to check that the state after the exception is valid
+    for(size_t repeat = 0; repeat < 2; ++repeat)
+    {   // the last argument to check_sign is negative
+        for(size_t j = 0; j < n; ++j)
+            x[j] = double(j + 2);
+        x[n - 1] = 0.5;
+        bool thrown = false;
+        try
+        {   y = f.forward_level(x, n_thread); }
+        catch(const std::runtime_error& e)
+        {   thrown = std::string( e.what() ) == "check_sign: x is negative"; }
+        ok &= thrown;
+        //
+        // thread_alloc is back in single thread mode
+        ok &= ! CppAD::thread_alloc::in_parallel();
+        ok &= CppAD::thread_alloc::num_threads() == 1;
+        //
+        // the function can still be evaluated using multiple threads
+        x[n - 1] = double(n + 1);
+        y        = f.forward_level(x, n_thread);
+        double check = 0.0;
+        for(size_t j = 0; j < n; ++j)
+            check += (x[j] * x[j] - 1.0) * x[j];
+        ok &= NearEqual(y[0], check, eps, eps);
+    }
+# endif
+    return ok;
+}
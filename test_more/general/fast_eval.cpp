@@ -0,0 +1,103 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+// Test pre-decoded evaluation for recordings that need 16 and 32 bit indices.
+// The case that is smaller than 2^16 is also tested by example/fast_eval.cpp
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    //
+    // record a function with about 5 * n_loop operators
+    void record(CppAD::ADFun<double>& f, size_t n_loop)
+    {   size_t n = 2;
+        CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(3);
+        ax[0] = 0.5;
+        ax[1] = 0.25;
+        CppAD::Independent(ax);
+        AD<double> au   = ax[0];
+        AD<double> asum = 0.0;
+        for(size_t k = 0; k < n_loop; ++k)
+        {   // use a different constant for each k
+            au    = sin(au) * ax[1] + double(k) / double(n_loop);
+            asum += CppAD::CondExpLt(au, ax[0], au, ax[1]);
+        }
+        ay[0] = asum;
+        ay[1] = au;
+        ay[2] = 3.0;
+        f.Dependent(ax, ay);
+    }
+    //
+    // n_byte is the expected number of bytes for the pre-decoded indices
+    bool check(size_t n_loop, size_t n_byte)
+    {   bool ok = true;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        //
+        // f uses pre-decoded operations, g does not
+        CppAD::ADFun<double> f, g;
+        record(f, n_loop);
+        record(g, n_loop);
+        ok &= f.size_fast_index() == 0;
+        ok &= f.prepare_fast_eval();
+        ok &= f.size_fast_index() == n_byte;
+        ok &= g.size_fast_index() == 0;
+        //
+        // zero order forward
+        CPPAD_TESTVECTOR(double) x(2), yf, yg;
+        x[0] = 0.3;
+        x[1] = 0.7;
+        yf = f.Forward(0, x);
+        yg = g.Forward(0, x);
+        for(size_t i = 0; i < yf.size(); ++i)
+            ok &= NearEqual(yf[i], yg[i], eps99, eps99);
+        //
+        // first order reverse
+        CPPAD_TESTVECTOR(double) w(3), dwf, dwg;
+        w[0] = 1.0;
+        w[1] = 2.0;
+        w[2] = 3.0;
+        dwf = f.Reverse(1, w);
+        dwg = g.Reverse(1, w);
+        for(size_t j = 0; j < dwf.size(); ++j)
+            ok &= NearEqual(dwf[j], dwg[j], eps99, eps99);
+        //
+        return ok;
+    }
+}
+
+bool fast_eval(void)
+{   bool ok = true;
+    //
+    // 16 bit indices
+    ok &= check(100, sizeof(unsigned short) );
+    //
+    // 32 bit indices
+    size_t n_loop = std::numeric_limits<unsigned short>::max() / 4;
+    ok &= check(n_loop, sizeof(unsigned int) );
+    //
+    // type chosen for each of the limits (a recording that needs
+    // 64 bit indices is too large for this test)
+    using CppAD::local::play::fast_address_type;
+    using CppAD::local::play::unsigned_short_enum;
+    using CppAD::local::play::unsigned_int_enum;
+    using CppAD::local::play::size_t_enum;
+    size_t max_short = std::numeric_limits<unsigned short>::max();
+    size_t max_int   = std::numeric_limits<unsigned int>::max();
+    ok &= fast_address_type(max_short, 1, 1, 1) == unsigned_short_enum;
+    ok &= fast_address_type(1, 1, max_short + 1, 1) == unsigned_int_enum;
+    ok &= fast_address_type(1, 1, 1, max_int) == unsigned_int_enum;
+    if( max_int < std::numeric_limits<size_t>::max() )
+        ok &= fast_address_type(1, max_int + 1, 1, 1) == size_t_enum;
+    //
+    return ok;
+}
@@ -0,0 +1,154 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+// Test fun_context objects that share one ADFun object and are used by
+// different threads at the same time.
+// The sequential case is tested by example/general/fun_context.cpp
+
+# include <cppad/cppad.hpp>
+
+# if CPPAD_USE_CPLUSPLUS_2011
+# include <thread>
+# include <atomic>
+
+namespace {
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    //
+    // number of threads in the team
+    const size_t n_thread_ = 4;
+    //
+    // number of times each thread evaluates the function
+    const size_t n_repeat_ = 50;
+    //
+    // thread number for the current thread
+    size_t& thread_index(void)
+    {   static thread_local size_t index = 0;
+        return index;
+    }
+    //
+    // are the threads running
+    bool in_parallel_ = false;
+    //
+    // used by thread_alloc
+    bool in_parallel(void)
+    {   return in_parallel_; }
+    size_t thread_number(void)
+    {   return thread_index(); }
+    //
+    // the function shared by all the threads
+    CppAD::ADFun<double>* f_ = CPPAD_NULL;
+    //
+    // the threads wait for this flag so they run at the same time
+    std::atomic<bool> start_(false);
+    //
+    // result for each thread
+    bool ok_thread_[n_thread_];
+    //
+    // work done by one thread
+    void worker(size_t thread)
+    {   thread_index() = thread;
+        while( ! start_ )
+            std::this_thread::yield();
+        //
+        double eps = 10. * std::numeric_limits<double>::epsilon();
+        bool ok    = true;
+        size_t n   = 2;
+        size_t m   = 2;
+        CppAD::fun_context<double> context(*f_);
+        CPPAD_TESTVECTOR(double) x(n), y(m), dx(n), dy(m), w(m), dw(n);
+        for(size_t k = 0; k < n_repeat_; ++k)
+        {   // a different point for each thread and repetition,
+            // x[0] < x[1] for even threads and x[0] > x[1] for odd threads
+            double t = double(thread + 1) + double(k) / double(n_repeat_);
+            x[0]     = t;
+            x[1]     = t + ( thread % 2 == 0 ? 0.5 : -0.5 );
+            y        = context.Forward(0, x);
+            double v = x[0] < x[1] ? x[0] : x[1];
+            ok &= NearEqual(y[0], exp(x[0]) * x[1], eps, eps);
+            ok &= NearEqual(y[1], v * x[0], eps, eps);
+            //
+            // derivative with respect to x[0]
+            dx[0] = 1.0;
+            dx[1] = 0.0;
+            dy    = context.Forward(1, dx);
+            double dv = x[0] < x[1] ? 2.0 * x[0] : x[1];
+            ok &= NearEqual(dy[0], exp(x[0]) * x[1], eps, eps);
+            ok &= NearEqual(dy[1], dv, eps, eps);
+            //
+            // first order reverse for y[1]
+            w[0] = 0.0;
+            w[1] = 1.0;
+            dw   = context.Reverse(1, w);
+            ok &= NearEqual(dw[0], dv, eps, eps);
+            ok &= NearEqual(dw[1], x[0] < x[1] ? 0.0 : x[0], eps, eps);
+        }
+        // return the memory for this context to this thread
+        context.clear();
+        ok_thread_[thread] = ok;
+    }
+}
+
+bool fun_context_thread(void)
+{   bool ok = true;
+    //
+    // record a function that uses a VecAD object and a conditional
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    AD<double> azero(0), aone(1);
+    av[azero] = ax[0];
+    av[aone]  = ax[1];
+    AD<double> aindex = CppAD::CondExpLt(ax[0], ax[1], azero, aone);
+    size_t m = 2;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = exp( ax[0] ) * ax[1];
+    ay[1] = av[aindex] * ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    f_ = &f;
+    //
+    // set up for multi-threading
+    thread_index() = 0;
+    thread_alloc::parallel_setup(n_thread_, in_parallel, thread_number);
+    CppAD::parallel_ad<double>();
+    in_parallel_ = true;
+    //
+    // start the threads and wait for them to finish
+    start_ = false;
+    std::thread team[n_thread_];
+    for(size_t thread = 0; thread < n_thread_; ++thread)
+    {   ok_thread_[thread] = false;
+        team[thread] = std::thread(worker, thread);
+    }
+    start_ = true;
+    for(size_t thread = 0; thread < n_thread_; ++thread)
+        team[thread].join();
+    in_parallel_ = false;
+    for(size_t thread = 0; thread < n_thread_; ++thread)
+        ok &= ok_thread_[thread];
+    //
+    // return to single thread mode
+    for(size_t thread = 1; thread < n_thread_; ++thread)
+        thread_alloc::free_available(thread);
+    thread_alloc::parallel_setup(1, CPPAD_NULL, CPPAD_NULL);
+    CppAD::parallel_ad<double>();
+    f_ = CPPAD_NULL;
+    //
+    return ok;
+}
+# else
+bool fun_context_thread(void)
+{   return true; }
+# endif
@@ -40,10 +40,13 @@ extern bool atomic_three(void);
 extern bool azmul(void);
 extern bool base_adolc(void);
 extern bool base_alloc_test(void);
+extern bool binary_io(void);
 extern bool bool_sparsity(void);
 extern bool check_simple_vector(void);
 extern bool chkpoint_one(void);
 extern bool chkpoint_two(void);
+extern bool color_order(void);
+extern bool color_thread(void);
 extern bool compare_change(void);
 extern bool Compare(void);
 extern bool CondExpAD(void);
@@ -64,11 +67,13 @@ extern bool erf(void);
 extern bool expm1(void);
 extern bool Exp(void);
 extern bool fabs(void);
+extern bool fast_eval(void);
 extern bool ForHess(void);
 extern bool for_sparse_hes(void);
 extern bool for_sparse_jac(void);
 extern bool forward_dir(void);
 extern bool forward_order(void);
+extern bool fun_context_thread(void);
 extern bool Forward(void);
 extern bool FromBase(void);
 extern bool FunCheck(void);
@@ -122,6 +127,7 @@ extern bool Sub(void);
 extern bool SubZero(void);
 extern bool tan(void);
 extern bool test_vector(void);
+extern bool to_csrc(void);
 extern bool to_string(void);
 extern bool Value(void);
 extern bool VecADPar(void);
@@ -157,10 +163,13 @@ int main(void)
     Run( atanh,           "atanh"          );
     Run( atomic_three,    "atomic_three"   );
     Run( azmul,           "azmul"          );
+    Run( binary_io,       "binary_io"      );
     Run( bool_sparsity,   "bool_sparsity"  );
     Run( check_simple_vector, "check_simple_vector" );
     Run( chkpoint_one,    "chkpoint_one"   );
     Run( chkpoint_two,    "chkpoint_two"   );
+    Run( color_order,     "color_order"    );
+    Run( color_thread,    "color_thread"   );
     Run( compare_change,  "compare_change" );
     Run( Compare,         "Compare"        );
     Run( CondExpAD,       "CondExpAD"      );
@@ -179,12 +188,14 @@ int main(void)
     Run( Exp,             "Exp"            );
     Run( expm1,           "expm1"          );
     Run( fabs,            "fabs"           );
+    Run( fast_eval,       "fast_eval"      );
     Run( ForHess,         "ForHess"        );
     Run( for_sparse_hes,  "for_sparse_hes" );
     Run( for_sparse_jac,  "for_sparse_jac" );
     Run( forward_dir,     "forward_dir"    );
     Run( Forward,         "Forward"        );
     Run( forward_order,   "forward_order"  );
+    Run( fun_context_thread, "fun_context_thread" );
     Run( FromBase,        "FromBase"       );
     Run( FunCheck,        "FunCheck"       );
     Run( hes_sparsity,    "hes_sparsity"   );
@@ -235,6 +246,7 @@ int main(void)
     Run( Sub,             "Sub"            );
     Run( SubZero,         "SubZero"        );
     Run( tan,             "tan"            );
+    Run( to_csrc,         "to_csrc"        );
     Run( to_string,       "to_string"      );
     Run( Value,           "Value"          );
     Run( VecADPar,        "VecADPar"       );
@@ -11,6 +11,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 ---------------------------------------------------------------------------- */
 
 # include <cppad/cppad.hpp>
+# include <sstream>
 
 bool json_lexer(void)
 {   bool ok = true;
@@ -275,6 +276,39 @@ bool json_lexer(void)
     // -----------------------------------------------------------------------
     // }
     json_lexer.check_next_char('}');
+    // -----------------------------------------------------------------------
+    // A graph that is one long line read from a stream
+    // (the stream is read in chunks and the line is longer than a chunk)
+    size_t n_float = 50000;
+    std::string line = "{ 'constant_vec' : [ " + CppAD::to_string(n_float);
+    line += ", [ ";
+    for(size_t i = 0; i < n_float; ++i)
+    {   line += CppAD::to_string( double(i) + 0.5 );
+        line += i + 1 < n_float ? ", " : " ] ] }";
+    }
+    for(size_t i = 0; i < line.size(); ++i)
+        if( line[i] == '\'' ) line[i] = '"';
+    std::istringstream line_is(line);
+    CppAD::local::graph::json_lexer line_lexer(line_is);
+    line_lexer.check_next_string("constant_vec");
+    line_lexer.check_next_char(':');
+    line_lexer.check_next_char('[');
+    line_lexer.next_non_neg_int();
+    ok &= line_lexer.token2size_t() == n_float;
+    line_lexer.check_next_char(',');
+    line_lexer.check_next_char('[');
+    for(size_t i = 0; i < n_float; ++i)
+    {   line_lexer.next_float();
+        ok &= line_lexer.token2double() == double(i) + 0.5;
+        if( i + 1 == n_float )
+            line_lexer.check_next_char(']');
+        else
+            line_lexer.check_next_char(',');
+    }
+    line_lexer.check_next_char(']');
+    line_lexer.check_next_char('}');
+    ok &= line_lexer.line_number() == 1;
+    ok &= line_lexer.char_number() == line.size();
     //
     return ok;
 }
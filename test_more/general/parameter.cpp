@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -62,12 +62,50 @@ bool test_repeat(void)
     return ok;
 }
 
+// more constants than CPPAD_HASH_TABLE_SIZE
+template <class Float>
+bool test_many(void)
+{   bool ok = true;
+    using namespace CppAD;
+
+    // number of different constant parameters
+    size_t n_constant = 3 * CPPAD_HASH_TABLE_SIZE;
+
+    // independent variable vector
+    size_t n = 1;
+    CPPAD_TESTVECTOR(AD<Float>) ax(n);
+    ax[0] = 0.0;
+    Independent(ax);
+
+    // dependent variable vector; each constant is used twice
+    size_t m = 2 * n_constant;
+    CPPAD_TESTVECTOR(AD<Float>) ay(m);
+    for(size_t i = 0; i < m; i++)
+        ay[i] = ax[0] + Float( i % n_constant + 1 );
+
+    // create f: ax -> ay
+    ADFun<Float> f(ax, ay);
+
+    // add one for the phantom parameter at index zero
+    ok &= f.size_par() == 1 + n_constant;
+
+    // hash table statistics
+    ok &= f.size_con_par_put()   == 1 + m;
+    ok &= f.size_con_par_slot()  >= 2 * n_constant;
+    ok &= f.size_con_par_probe() >= f.size_con_par_put();
+    ok &= f.size_con_par_probe() <= 4 * f.size_con_par_put();
+
+    return ok;
+}
+
 } // END empty namespace
 
 bool parameter(void)
 {   bool ok = true;
     ok &= test_repeat<double>();
     ok &= test_repeat<float>();
+    ok &= test_many<double>();
+    ok &= test_many<float>();
     //
     return ok;
 }
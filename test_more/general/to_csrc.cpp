@@ -0,0 +1,74 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+Test that to_csrc reports an error, and does not write any source code,
+when the function contains an operator that cannot be converted.
+Also check that the source code does not allocate memory.
+*/
+# include <cppad/cppad.hpp>
+# include <sstream>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+// number of errors reported by to_csrc
+size_t n_error_ = 0;
+//
+// error handler that returns (to_csrc must then return false)
+void count_handler(
+    bool known       ,
+    int  line        ,
+    const char *file ,
+    const char *exp  ,
+    const char *msg  )
+{   ++n_error_; }
+//
+// discrete function (cannot be converted to C source code)
+double floor_fun(const double& x)
+{   return std::floor(x); }
+CPPAD_DISCRETE_FUNCTION(double, floor_fun)
+
+} // END_EMPTY_NAMESPACE
+
+bool to_csrc(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    CPPAD_TESTVECTOR( AD<double> ) ax(2), ay(1);
+    ax[0] = 1.5;
+    ax[1] = 2.0;
+    //
+    // f(x) = x_0 * x_1 can be converted
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g(x) = floor_fun(x_0) * x_1 cannot be converted
+    CppAD::Independent(ax);
+    ay[0] = floor_fun(ax[0]) * ax[1];
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    CppAD::ErrorHandler info(count_handler);
+    n_error_ = 0;
+    //
+    std::stringstream f_os;
+    ok &= f.to_csrc(f_os, "f_csrc");
+    ok &= n_error_ == 0;
+    ok &= f_os.str().size() > 0;
+    ok &= f_os.str().find("malloc") == std::string::npos;
+    //
+    std::stringstream g_os;
+    ok &= ! g.to_csrc(g_os, "g_csrc");
+    ok &= n_error_ == 1;
+    ok &= g_os.str().size() == 0;
+    //
+    return ok;
+}